@@ -29,6 +29,7 @@
 
 #include <boost/regex.hpp>
 
+#include "Application.h"
 #include "ComplexGeoData.h"
 #include "ElementMap.h"
 #include "ElementNamingUtils.h"
@@ -644,8 +645,19 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
-        _elementMap->save(writer.Stream());
+        // The binary layout is much faster to restore, but cannot be read by
+        // versions before its introduction, so it has to be enabled explicitly
+        bool binary = App::GetApplication()
+                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+                          ->GetBool("BinaryElementMap", false);
+        if (binary) {
+            writer.Stream() << "BeginElementMap v2\n";
+            _elementMap->saveBinary(writer.Stream());
+        }
+        else {
+            writer.Stream() << "BeginElementMap v1\n";
+            _elementMap->save(writer.Stream());
+        }
     }
 }
 
@@ -657,14 +669,19 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
-        if (ver != "v1") {
-            FC_WARN("Unknown element map format");  // NOLINT
-        }
-        else {
+        if (ver == "v1") {
             resetElementMap(std::make_shared<ElementMap>());
             _elementMap = _elementMap->restore(Hasher, reader);
             return;
         }
+        if (ver == "v2") {
+            // skip the line break ending the marker, the binary data follows
+            reader.get();
+            resetElementMap(std::make_shared<ElementMap>());
+            _elementMap = _elementMap->restoreBinary(Hasher, reader);
+            return;
+        }
+        FC_WARN("Unknown element map format");  // NOLINT
     }
     auto count = atoll(marker.c_str());  // Try to prevent UB if the number is unreasonably large
     if (count < 0 || count > std::numeric_limits<int>::max()) {
@@ -1138,6 +1138,9 @@ void Document::Save(Base::Writer& writer) const
     }
     beforeSave();
 
+    // Drop the string IDs no longer referenced by anything, so that the table written out (and
+    // the one kept in memory) only holds what the saved objects can still use
+    d->Hasher->compact();
     d->Hasher->Save(writer);
 
     writer.decInd();
@@ -1,5 +1,8 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -10,6 +13,7 @@
 
 #include "App/Application.h"
 #include "Base/Console.h"
+#include "Base/Stream.h"
 #include "Document.h"
 #include "DocumentObject.h"
 
@@ -448,7 +452,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                this->mappedNames.insert(ref->name, idx);
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -500,6 +504,498 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
     return shared_from_this();
 }
 
+// Binary layout written by saveBinary(), checked by restoreBinary()
+static constexpr uint32_t binaryMapMagic {0x50414d45};  // "EMAP"
+static constexpr uint32_t binaryMapVersion {1};
+// Upper bound of a single string or list in a binary map: almost certainly a bug beyond
+static constexpr uint32_t binaryMapMaxCount {1 << 28};
+// The counts are read from the file, so memory is only reserved up to this limit and
+// grows with the data that is actually read
+static constexpr uint32_t binaryMapReserveLimit {4096};
+
+static void writeBinaryBytes(Base::OutputStream& stream, const QByteArray& bytes)
+{
+    const auto size = static_cast<int>(bytes.size());
+    stream << static_cast<uint32_t>(size);
+    stream.write(bytes.constData(), size);
+}
+
+// Reads \a size bytes in chunks and appends them to \a res unless it is null
+static void readBinaryData(Base::InputStream& stream, uint64_t size, std::string* res)
+{
+    constexpr uint64_t chunkSize {4096};
+    char chunk[chunkSize];
+    while (size > 0) {
+        const auto count = static_cast<int>(std::min(size, chunkSize));
+        stream.read(chunk, count);
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, "Unexpected end of element map");  // NOLINT
+        }
+        if (res) {
+            res->append(chunk, count);
+        }
+        size -= count;
+    }
+}
+
+static std::string readBinaryBytes(Base::InputStream& stream)
+{
+    uint32_t size = 0;
+    stream >> size;
+    if (!stream || size > binaryMapMaxCount) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map string");  // NOLINT
+    }
+    std::string res;
+    readBinaryData(stream, size, &res);
+    return res;
+}
+
+static void writeBinaryIDs(Base::OutputStream& stream, const ElementIDRefs& sids)
+{
+    uint32_t count = 0;
+    for (auto& sid : sids) {
+        if (sid.isMarked()) {
+            ++count;
+        }
+    }
+    stream << count;
+    for (auto& sid : sids) {
+        if (sid.isMarked()) {
+            stream << static_cast<int64_t>(sid.value());
+        }
+    }
+}
+
+static std::vector<int64_t> readBinaryIDs(Base::InputStream& stream)
+{
+    uint32_t count = 0;
+    stream >> count;
+    if (!stream || count > binaryMapMaxCount) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map string id count");  // NOLINT
+    }
+    std::vector<int64_t> ids;
+    ids.reserve(std::min(count, binaryMapReserveLimit));
+    for (uint32_t i = 0; i < count; ++i) {
+        int64_t id = 0;
+        stream >> id;
+        if (!stream) {
+            FC_THROWM(Base::RuntimeError, "Unexpected end of element map");  // NOLINT
+        }
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+void ElementMap::saveBinary(std::ostream& stream) const
+{
+    std::map<const ElementMap*, int> childMapSet;
+    std::vector<const ElementMap*> childMaps;
+    std::map<QByteArray, int> postfixMap;
+    std::vector<QByteArray> postfixes;
+
+    collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+    Base::OutputStream out(stream);
+    out << binaryMapMagic << binaryMapVersion << static_cast<uint32_t>(this->_id)
+        << static_cast<uint32_t>(postfixes.size());
+    for (auto& postfix : postfixes) {
+        writeBinaryBytes(out, postfix);
+    }
+    out << static_cast<uint32_t>(childMaps.size());
+    int index = 0;
+    for (auto& elementMap : childMaps) {
+        elementMap->saveBinary(out, ++index, childMapSet, postfixMap);
+    }
+}
+
+void ElementMap::saveBinary(Base::OutputStream& stream,
+                            int index,
+                            const std::map<const ElementMap*, int>& childMapSet,
+                            const std::map<QByteArray, int>& postfixMap) const
+{
+    // Each map is prefixed with its size, so that restoring can skip a map
+    // that has already been loaded
+    std::ostringstream buffer;
+    Base::OutputStream out(buffer);
+
+    out << static_cast<int32_t>(index) << static_cast<uint32_t>(this->_id)
+        << static_cast<uint32_t>(this->indexedNames.size());
+
+    for (auto& [type, indices] : this->indexedNames) {
+        writeBinaryBytes(out, QByteArray::fromRawData(type, static_cast<int>(qstrlen(type))));
+
+        out << static_cast<uint32_t>(indices.children.size());
+        for (auto& vv : indices.children) {
+            auto& child = vv.second;
+            int mapIndex = 0;
+            if (child.elementMap) {
+                auto it = childMapSet.find(child.elementMap.get());
+                if (it == childMapSet.end() || it->second == 0) {
+                    FC_ERR("Invalid child element map");  // NOLINT
+                }
+                else {
+                    mapIndex = it->second;
+                }
+            }
+            out << static_cast<int32_t>(child.indexedName.getIndex())
+                << static_cast<int32_t>(child.offset) << static_cast<int32_t>(child.count)
+                << static_cast<int64_t>(child.tag) << static_cast<int32_t>(mapIndex);
+            writeBinaryBytes(out, child.postfix);
+            writeBinaryIDs(out, child.sids);
+        }
+
+        out << static_cast<uint32_t>(indices.names.size());
+        for (auto& mappedNameRef : indices.names) {
+            uint32_t count = 0;
+            for (auto ref = &mappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ++count;
+            }
+            out << count;
+            for (auto ref = &mappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                writeBinaryBytes(out, ref->name.dataBytes());
+
+                int32_t postfixIndex = 0;
+                const QByteArray& postfix = ref->name.postfixBytes();
+                if (!postfix.isEmpty()) {
+                    auto it = postfixMap.find(postfix);
+                    assert(it != postfixMap.end());
+                    postfixIndex = it->second;
+                }
+                out << postfixIndex;
+                writeBinaryIDs(out, ref->sids);
+            }
+        }
+    }
+
+    const std::string data = buffer.str();
+    stream << static_cast<uint64_t>(data.size());
+    stream.write(data.data(), static_cast<int>(data.size()));
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream)
+{
+    const char* msg = "Invalid element map";
+
+    Base::InputStream in(stream);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t id = 0;
+    uint32_t count = 0;
+    in >> magic >> version >> id >> count;
+    if (!in || magic != binaryMapMagic || version != binaryMapVersion
+        || count > binaryMapMaxCount) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+
+    auto& map = _idToElementMap[id];
+    if (map) {
+        return map;
+    }
+
+    std::vector<std::string> postfixes;
+    postfixes.reserve(std::min(count, binaryMapReserveLimit));
+    for (uint32_t i = 0; i < count; ++i) {
+        postfixes.push_back(readBinaryBytes(in));
+    }
+
+    in >> count;
+    if (!in || count == 0 || count > binaryMapMaxCount) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+    std::vector<ElementMapPtr> childMaps;
+    childMaps.reserve(std::min(count - 1, binaryMapReserveLimit));
+    for (uint32_t i = 0; i < count - 1; ++i) {
+        childMaps.push_back(
+            std::make_shared<ElementMap>()->restoreBinary(hasherRef, in, childMaps, postfixes));
+    }
+
+    return restoreBinary(hasherRef, in, childMaps, postfixes);
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef,
+                                        Base::InputStream& stream,
+                                        std::vector<ElementMapPtr>& childMaps,
+                                        const std::vector<std::string>& postfixes)
+{
+    uint64_t size = 0;
+    int32_t index = 0;
+    uint32_t id = 0;
+    uint32_t typeCount = 0;
+    stream >> size >> index >> id >> typeCount;
+    constexpr uint32_t maxTypeCount(1000);
+    if (!stream || typeCount > maxTypeCount) {
+        FC_THROWM(Base::RuntimeError, "Bad type count in element map, ignoring map");  // NOLINT
+    }
+
+    auto& map = _idToElementMap[id];
+    if (map) {
+        // skip the rest of the map, the size includes the fields read above
+        constexpr uint64_t headerSize {sizeof(index) + sizeof(id) + sizeof(typeCount)};
+        if (size < headerSize) {
+            FC_THROWM(Base::RuntimeError, "Invalid element map");  // NOLINT
+        }
+        readBinaryData(stream, size - headerSize, nullptr);
+        return map;
+    }
+
+    const char* hasherWarn = nullptr;
+    const char* hasherIDWarn = nullptr;
+    const char* postfixWarn = nullptr;
+    const char* childSIDWarn = nullptr;
+
+    for (uint32_t i = 0; i < typeCount; ++i) {
+        IndexedName idx(readBinaryBytes(stream).c_str(), 1);
+        auto& indices = this->indexedNames[idx.getType()];
+
+        uint32_t childCount = 0;
+        stream >> childCount;
+        if (!stream || childCount > binaryMapMaxCount) {
+            FC_THROWM(Base::RuntimeError, "missing element child count");  // NOLINT
+        }
+        for (uint32_t j = 0; j < childCount; ++j) {
+            int32_t cIndex = 0;
+            int32_t offset = 0;
+            int32_t count = 0;
+            int64_t tag = 0;
+            int32_t mapIndex = 0;
+            stream >> cIndex >> offset >> count >> tag >> mapIndex;
+            if (!stream) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child");  // NOLINT
+            }
+            if (cIndex < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child index");  // NOLINT
+            }
+            if (offset < 0) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child offset");  // NOLINT
+            }
+            if (mapIndex >= index || mapIndex < 0 || mapIndex > (int)childMaps.size()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child map index");  // NOLINT
+            }
+            auto& child = indices.children[cIndex + offset + count];
+            child.indexedName = IndexedName::fromConst(idx.getType(), cIndex);
+            child.offset = offset;
+            child.count = count;
+            child.tag = static_cast<long>(tag);
+            if (mapIndex > 0) {
+                child.elementMap = childMaps[mapIndex - 1];
+            }
+            else {
+                child.elementMap = nullptr;
+            }
+            child.postfix = QByteArray::fromStdString(readBinaryBytes(stream));
+            this->childElements[child.postfix].childMap = &child;
+            this->childElementSize += child.count;
+
+            auto ids = readBinaryIDs(stream);
+            child.sids.reserve(static_cast<int>(ids.size()));
+            for (auto childID : ids) {
+                ::App::StringIDRef sid;
+                if (hasherRef) {
+                    sid = hasherRef->getID(static_cast<long>(childID));
+                }
+                if (!sid) {
+                    childSIDWarn = "Missing element child string id";
+                }
+                else {
+                    child.sids.push_back(sid);
+                }
+            }
+        }
+
+        uint32_t nameCount = 0;
+        stream >> nameCount;
+        if (!stream || nameCount > binaryMapMaxCount) {
+            FC_THROWM(Base::RuntimeError, "missing element name count");  // NOLINT
+        }
+        for (uint32_t j = 0; j < nameCount; ++j) {
+            idx.setIndex(static_cast<int>(j));
+            auto* ref = &indices.names.emplace_back();
+            uint32_t refCount = 0;
+            stream >> refCount;
+            if (!stream || refCount > binaryMapMaxCount) {
+                FC_THROWM(Base::RuntimeError, "Failed to read element name");  // NOLINT
+            }
+            for (uint32_t k = 0; k < refCount; ++k) {
+                if (k != 0) {
+                    ref->next = std::make_unique<MappedNameRef>();
+                    ref = ref->next.get();
+                }
+                ref->name = MappedName(readBinaryBytes(stream));
+                int32_t postfixIndex = 0;
+                stream >> postfixIndex;
+                if (postfixIndex != 0) {
+                    if (postfixIndex < 0 || postfixIndex > (int)postfixes.size()) {
+                        postfixWarn = "Invalid element postfix index";
+                    }
+                    else {
+                        ref->name += postfixes[postfixIndex - 1];
+                    }
+                }
+
+                this->mappedNames.insert(ref->name, idx);
+
+                auto ids = readBinaryIDs(stream);
+                if (!hasherRef) {
+                    if (!ids.empty()) {
+                        hasherWarn = "No hasherRef";
+                    }
+                    continue;
+                }
+                ref->sids.reserve(static_cast<int>(ids.size()));
+                for (auto nameID : ids) {
+                    auto sid = hasherRef->getID(static_cast<long>(nameID));
+                    if (!sid) {
+                        hasherIDWarn = "Invalid element name string id";
+                    }
+                    else {
+                        ref->sids.push_back(sid);
+                    }
+                }
+            }
+        }
+    }
+    if (hasherWarn) {
+        FC_WARN(hasherWarn);  // NOLINT
+    }
+    if (hasherIDWarn) {
+        FC_WARN(hasherIDWarn);  // NOLINT
+    }
+    if (postfixWarn) {
+        FC_WARN(postfixWarn);  // NOLINT
+    }
+    if (childSIDWarn) {
+        FC_WARN(childSIDWarn);  // NOLINT
+    }
+
+    return shared_from_this();
+}
+
+std::size_t ElementMap::MappedNameTable::hash(const MappedName& name)
+{
+    // FNV-1a over data and postfix as one string, since the same name may be
+    // split differently between the two
+    uint64_t hash = 14695981039346656037ULL;
+    auto combine = [&hash](const QByteArray& bytes) {
+        for (char c : bytes) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+    };
+    combine(name.dataBytes());
+    combine(name.postfixBytes());
+    return static_cast<std::size_t>(hash);
+}
+
+void ElementMap::MappedNameTable::reserve(std::size_t size)
+{
+    // keep the load factor at most one half, which keeps the probe sequences short
+    std::size_t slotCount = slots.empty() ? 16 : slots.size();
+    while (slotCount < size * 2) {
+        slotCount *= 2;
+    }
+    if (slotCount != slots.size()) {
+        rehash(slotCount);
+    }
+    entries.reserve(size);
+}
+
+void ElementMap::MappedNameTable::rehash(std::size_t slotCount)
+{
+    std::vector<Handle> oldSlots(slotCount, npos);
+    oldSlots.swap(slots);
+    std::size_t mask = slots.size() - 1;
+    for (Handle handle : oldSlots) {
+        if (handle == npos) {
+            continue;
+        }
+        std::size_t pos = entries[handle].hash & mask;
+        while (slots[pos] != npos) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = handle;
+    }
+}
+
+ElementMap::MappedNameTable::Handle ElementMap::MappedNameTable::find(const MappedName& name) const
+{
+    if (count == 0) {
+        return npos;
+    }
+    std::size_t nameHash = hash(name);
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t pos = nameHash & mask; slots[pos] != npos; pos = (pos + 1) & mask) {
+        const Entry& entry = entries[slots[pos]];
+        if (entry.hash == nameHash && entry.name == name) {
+            return slots[pos];
+        }
+    }
+    return npos;
+}
+
+std::pair<ElementMap::MappedNameTable::Handle, bool>
+ElementMap::MappedNameTable::insert(const MappedName& name, const IndexedName& idx)
+{
+    if ((count + 1) * 2 > slots.size()) {
+        rehash(slots.empty() ? 16 : slots.size() * 2);
+    }
+    std::size_t nameHash = hash(name);
+    std::size_t mask = slots.size() - 1;
+    std::size_t pos = nameHash & mask;
+    for (; slots[pos] != npos; pos = (pos + 1) & mask) {
+        const Entry& entry = entries[slots[pos]];
+        if (entry.hash == nameHash && entry.name == name) {
+            return {slots[pos], false};
+        }
+    }
+
+    Handle handle = 0;
+    if (!freeEntries.empty()) {
+        handle = freeEntries.back();
+        freeEntries.pop_back();
+    }
+    else {
+        handle = static_cast<Handle>(entries.size());
+        entries.emplace_back();
+    }
+    Entry& entry = entries[handle];
+    entry.name = name;
+    entry.idx = idx;
+    entry.hash = nameHash;
+    slots[pos] = handle;
+    ++count;
+    return {handle, true};
+}
+
+void ElementMap::MappedNameTable::erase(Handle handle)
+{
+    std::size_t mask = slots.size() - 1;
+    std::size_t pos = entries[handle].hash & mask;
+    while (slots[pos] != handle) {
+        pos = (pos + 1) & mask;
+    }
+
+    // Shift the following handles of the probe sequence back into the hole,
+    // unless their home position lies cyclically within (hole, next]
+    std::size_t next = pos;
+    while (true) {
+        next = (next + 1) & mask;
+        if (slots[next] == npos) {
+            break;
+        }
+        std::size_t home = entries[slots[next]].hash & mask;
+        bool stays = pos <= next ? (pos < home && home <= next) : (pos < home || home <= next);
+        if (!stays) {
+            slots[pos] = slots[next];
+            pos = next;
+        }
+    }
+    slots[pos] = npos;
+
+    entries[handle] = Entry();
+    freeEntries.push_back(handle);
+    --count;
+}
+
 MappedName ElementMap::addName(MappedName& name,
                                const IndexedName& idx,
                                const ElementIDRefs& sids,
@@ -515,25 +1011,26 @@ MappedName ElementMap::addName(MappedName& name,
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        auto ret = mappedNames.insert(name, idx);
+        const MappedName& interned = mappedNames.name(ret.first);
+        if (ret.second) {        // element just inserted did not exist yet in the map
+            interned.compact();  // FIXME see MappedName.cpp
+            mappedRef(idx).append(interned, sids);
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return interned;
         }
-        if (ret.first->second == idx) {
+        if (mappedNames.indexedName(ret.first) == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return interned;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = mappedNames.indexedName(ret.first);
             }
             return {};
         }
 
-        erase(ret.first->first);
+        erase(MappedName(interned));
     };
 }
 
@@ -781,16 +1278,16 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    auto handle = this->mappedNames.find(name);
+    if (handle == MappedNameTable::npos) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(this->mappedNames.indexedName(handle));
     if (!ref) {
         return;
     }
     ref->erase(name);
-    this->mappedNames.erase(it);
+    this->mappedNames.erase(handle);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -805,7 +1302,10 @@ void ElementMap::erase(const IndexedName& idx)
     }
     auto& ref = indices.names[idx.getIndex()];
     for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
-        this->mappedNames.erase(nameRef->name);
+        auto handle = this->mappedNames.find(nameRef->name);
+        if (handle != MappedNameTable::npos) {
+            this->mappedNames.erase(handle);
+        }
     }
     ref.clear();
 }
@@ -822,8 +1322,8 @@ bool ElementMap::empty() const
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    auto handle = mappedNames.find(name);
+    if (handle == MappedNameTable::npos) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -859,8 +1359,9 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
         return IndexedName();
     }
 
+    const IndexedName& idx = mappedNames.indexedName(handle);
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
+        const MappedNameRef* ref = findMappedRef(idx);
         for (; ref; ref = ref->next.get()) {
             if (ref->name == name) {
                 if (sids->empty()) {
@@ -873,7 +1374,7 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
             }
         }
     }
-    return nameIter->second;
+    return idx;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1076,8 +1577,12 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& mappedNameRef : indexedName.second.names) {
+            for (auto ref = &mappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                addPostfix(ref->name.constPostfix(), postfixMap, postfixes);
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1307,8 +1812,12 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (auto& [type, indices] : this->indexedNames) {
+        for (int i = 0; i < (int)indices.names.size(); ++i) {
+            for (auto ref = &indices.names[i]; ref && ref->name; ref = ref->next.get()) {
+                ret.emplace_back(ref->name, IndexedName::fromConst(type, i));
+            }
+        }
     }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
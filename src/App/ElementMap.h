@@ -31,12 +31,19 @@
 #include "MappedElement.h"
 #include "StringHasher.h"
 
+#include <cstdint>
 #include <cstring>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
 
 namespace Data
 {
@@ -75,7 +82,10 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
  * - `indexedNames` maps a string to both a name queue and children.  Each of
  * those children store an IndexedName, offset details, postfix, ids, and
  * possibly a recursive elementmap.
- * - `mappedNames` maps a MappedName to a specific IndexedName.
+ * - `mappedNames` interns each MappedName in a flat open addressing table
+ * and maps it to a specific IndexedName. Anything that exposes its content,
+ * such as getAll() and save(), walks `indexedNames` instead, so the order
+ * does not depend on the hashing.
  */
 class AppExport ElementMap
     : public std::enable_shared_from_this<ElementMap>  // TODO can remove shared_from_this?
@@ -127,6 +137,25 @@ public:
      */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /**
+     * @brief Serialize this map in binary form.
+     *
+     * Stores the same content as save() with Base::OutputStream, which avoids
+     * formatting and tokenizing the names. The result can only be read back by
+     * restoreBinary().
+     *
+     * @param[in,out] stream The stream to serialize to.
+     */
+    void saveBinary(std::ostream& stream) const;
+
+    /**
+     * @brief Deserialize and restore a map written by saveBinary().
+     *
+     * @param[in] hasherRef Where all the StringIDs are stored.
+     * @param[in,out] stream The stream to deserialize from.
+     */
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream);
+
     /**
      * @brief Add a sub-element name mapping.
      *
@@ -329,6 +358,18 @@ private:
                           std::vector<ElementMapPtr>& childMaps,
                           const std::vector<std::string>& postfixes);
 
+    /// Binary counterpart of save(std::ostream&, int, ...)
+    void saveBinary(Base::OutputStream& stream,
+                    int index,
+                    const std::map<const ElementMap*, int>& childMapSet,
+                    const std::map<QByteArray, int>& postfixMap) const;
+
+    /// Binary counterpart of restore(::App::StringHasherRef, std::istream&, ...)
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef,
+                                Base::InputStream& stream,
+                                std::vector<ElementMapPtr>& childMaps,
+                                const std::vector<std::string>& postfixes);
+
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
      * @param idx: the indexed name that \c name will be bound to
@@ -399,7 +440,66 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /**
+     * Open addressing table from MappedName to IndexedName.
+     *
+     * Each name is interned once in a flat entry array and addressed by an
+     * integer handle. A lookup probes a contiguous array of handles instead of
+     * following hash nodes. Erased entries are recycled through a free list,
+     * so the handles of the other names stay valid.
+     */
+    class MappedNameTable
+    {
+    public:
+        using Handle = uint32_t;
+        static constexpr Handle npos = ~Handle(0);
+
+        /// Bind @p name to @p idx, returns the handle of the name and whether it is new
+        std::pair<Handle, bool> insert(const MappedName& name, const IndexedName& idx);
+        /// Return the handle of @p name, or npos
+        Handle find(const MappedName& name) const;
+        /// Remove the name of @p handle, which must be valid
+        void erase(Handle handle);
+
+        const MappedName& name(Handle handle) const
+        {
+            return entries[handle].name;
+        }
+        const IndexedName& indexedName(Handle handle) const
+        {
+            return entries[handle].idx;
+        }
+        std::size_t size() const
+        {
+            return count;
+        }
+        bool empty() const
+        {
+            return count == 0;
+        }
+        /// Make room for @p size names without rehashing
+        void reserve(std::size_t size);
+
+    private:
+        /// Hashes the concatenation of data and postfix, in line with MappedName::operator==()
+        static std::size_t hash(const MappedName& name);
+        void rehash(std::size_t slotCount);
+
+        struct Entry
+        {
+            MappedName name;
+            IndexedName idx;
+            std::size_t hash = 0;
+        };
+
+        std::vector<Entry> entries;
+        std::vector<Handle> freeEntries;
+        /// Handles by hash position, with linear probing. The size is zero or a power of two.
+        std::vector<Handle> slots;
+        std::size_t count = 0;
+    };
+
+    MappedNameTable mappedNames;
 
     struct ChildMapInfo
     {
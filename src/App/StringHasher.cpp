@@ -23,7 +23,11 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <array>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -82,6 +86,53 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+
+    /// Content lookup table used in concurrent mode. The entries are split by hash value into
+    /// shards, each guarded by its own reader/writer lock, so that threads looking up existing
+    /// strings only ever take a shared lock, and writers only block the shard they insert into.
+    struct Shard
+    {
+        std::shared_mutex mutex;
+        std::unordered_set<StringID*, StringIDHasher, StringIDHasher> entries;
+    };
+    static constexpr std::size_t shardCount = 32;
+    using Shards = std::array<Shard, shardCount>;
+
+    /// Null unless the owner hasher is in concurrent mode
+    std::unique_ptr<Shards> shards;
+
+    /// Guards the underlying bimap in concurrent mode. Lock order is shard first, then this one.
+    std::shared_mutex mutex;
+
+    Shard& shardOf(const StringID* sid)
+    {
+        std::size_t hash = StringIDHasher()(sid);
+        // Use different bits than the buckets inside the shard
+        return (*shards)[(hash ^ (hash >> 16)) % shardCount];
+    }
+
+    bool eraseID(long id)
+    {
+        auto it = right.find(id);
+        if (it == right.end()) {
+            return false;
+        }
+        if (shards) {
+            shardOf(it->second).entries.erase(it->second);
+        }
+        right.erase(it);
+        return true;
+    }
+
+    void clearAll()
+    {
+        HashMapBase::clear();
+        if (shards) {
+            for (auto& shard : *shards) {
+                shard.entries.clear();
+            }
+        }
+    }
 };
 
 ///////////////////////////////////////////////////////////
@@ -91,7 +142,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
-        _hasher->_hashes->right.erase(_id);
+        _hasher->_hashes->eraseID(_id);
     }
 }
 
@@ -189,6 +240,26 @@ void StringHasher::setSaveAll(bool enable)
     compact();
 }
 
+void StringHasher::setConcurrent(bool enable)
+{
+    if (enable == isConcurrent()) {
+        return;
+    }
+    if (!enable) {
+        _hashes->shards.reset();
+        return;
+    }
+    _hashes->shards = std::make_unique<HashMap::Shards>();
+    for (auto& hasher : _hashes->right) {
+        _hashes->shardOf(hasher.second).entries.insert(hasher.second);
+    }
+}
+
+bool StringHasher::isConcurrent() const
+{
+    return _hashes->shards != nullptr;
+}
+
 void StringHasher::compact()
 {
     if (_hashes->SaveAll) {
@@ -209,7 +280,7 @@ void StringHasher::compact()
         StringIDRef sid = pendings.front();
         pendings.pop_front();
         // Try to erase the map entry for this StringID
-        if (_hashes->right.erase(sid.value()) == 0U) {
+        if (!_hashes->eraseID(sid.value())) {
             continue;  // If nothing was erased, there's nothing more to do
         }
         sid._sid->_hasher = nullptr;
@@ -277,9 +348,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    if (StringIDRef res = lookup(&dataID)) {
+        return res;
     }
 
     if (!hashed && !nocopy) {
@@ -294,8 +364,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    StringIDRef sid(new StringID(0, dataID._data, flags));
+    return {insertNew(sid)};
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -321,9 +391,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
+    if (StringIDRef res = lookup(&tempID)) {
         if (indexed) {
             res._index = indexed.getIndex();
         }
@@ -349,7 +417,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -429,7 +497,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
-    return {insert(newStringIDRef), indexed.getIndex()};
+    return {insertNew(newStringIDRef), indexed.getIndex()};
 }
 
 StringIDRef StringHasher::getID(long id, int index) const
@@ -437,6 +505,10 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock<std::shared_mutex> lock;
+    if (isConcurrent()) {
+        lock = std::shared_lock(_hashes->mutex);
+    }
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -597,7 +669,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     std::string ver;
     reader >> marker;
     std::size_t count = 0;
-    _hashes->clear();
+    _hashes->clearAll();
     if (marker == "StringTableStart") {
         reader >> ver >> count;
         if (ver != "v1") {
@@ -613,7 +685,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
-    _hashes->clear();
+    _hashes->clearAll();
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
@@ -726,6 +798,44 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
     }
 }
 
+StringIDRef StringHasher::lookup(StringID* key) const
+{
+    if (!isConcurrent()) {
+        auto it = _hashes->left.find(key);
+        if (it == _hashes->left.end()) {
+            return {};
+        }
+        return {it->first};
+    }
+    auto& shard = _hashes->shardOf(key);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return {};
+    }
+    return {*it};
+}
+
+StringID* StringHasher::insertNew(const StringIDRef& sid)
+{
+    if (!isConcurrent()) {
+        sid._sid->_id = lastID() + 1;
+        return insert(sid);
+    }
+    // Another thread may have added the same string after our failed lookup(), so check again
+    // while holding the shard exclusively. The ID is taken only once we know we are inserting, so
+    // that IDs stay dense.
+    auto& shard = _hashes->shardOf(sid._sid);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.entries.find(sid._sid);
+    if (it != shard.entries.end()) {
+        return *it;
+    }
+    std::unique_lock idLock(_hashes->mutex);
+    sid._sid->_id = lastID() + 1;
+    return insert(sid);
+}
+
 StringID* StringHasher::insert(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
@@ -738,12 +848,15 @@ StringID* StringHasher::insert(const StringIDRef& sid)
         hasher._hasher = nullptr;
         hasher.unref();
     }
+    else if (_hashes->shards) {
+        _hashes->shardOf(&hasher).entries.insert(&hasher);
+    }
     return res->second;
 }
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
-    _hashes->clear();
+    _hashes->clearAll();
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
         int32_t id = 0;
@@ -766,11 +879,15 @@ void StringHasher::clear()
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
     }
-    _hashes->clear();
+    _hashes->clearAll();
 }
 
 size_t StringHasher::size() const
 {
+    std::shared_lock<std::shared_mutex> lock;
+    if (isConcurrent()) {
+        lock = std::shared_lock(_hashes->mutex);
+    }
     return _hashes->size();
 }
 
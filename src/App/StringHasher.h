@@ -766,11 +766,28 @@ public:
     /// Compact string storage by eliminating unused strings from the table.
     void compact();
 
+    /** Enable/disable concurrent mode
+     *
+     * In concurrent mode the getID() and size() functions may be called from several threads at
+     * the same time. Lookups of existing strings go through a sharded table and only take a shared
+     * lock on one shard. New IDs are still assigned one after another, so the IDs (and hence the
+     * saved table) depend on the order in which new strings arrive; callers that need reproducible
+     * files should create new IDs in a deterministic order.
+     *
+     * All other functions, including the persistence ones, compact() and clear(), must not run
+     * concurrently with anything else. The mode itself must be switched while no other thread is
+     * using this hasher.
+     */
+    void setConcurrent(bool enable);
+    bool isConcurrent() const;
+
     class HashMap;
     friend class StringID;
 
 protected:
     StringID* insert(const StringIDRef& sid);
+    StringID* insertNew(const StringIDRef& sid);
+    StringIDRef lookup(StringID* key) const;
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
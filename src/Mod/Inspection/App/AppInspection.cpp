@@ -23,8 +23,12 @@
  ***************************************************************************/
 
 
+#include <array>
+
+#include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Base/PyObjectBase.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
 
 #include "InspectionFeature.h"
 
@@ -37,10 +41,82 @@ public:
     Module()
         : Py::ExtensionModule<Module>("Inspection")
     {
+        add_keyword_method(
+            "inspectFile",
+            &Module::inspectFile,
+            "inspectFile(File, Nominals, SearchRadius, [DistanceFile, ChunkSize, Bins]) -> dict\n"
+            "Inspects the points of an ASC, PLY or E57 file against the nominal objects\n"
+            "without loading the whole file. If DistanceFile is given the distances are written\n"
+            "to it as 32-bit floats in the order of the points."
+        );
         initialize("This module is the Inspection module.");  // register with Python
     }
 
 private:
+    Py::Object inspectFile(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        static const std::array<const char*, 7>
+            kwlist {"File", "Nominals", "SearchRadius", "DistanceFile", "ChunkSize", "Bins", nullptr};
+        char* fileName {};
+        PyObject* nominals {};
+        double radius {};
+        char* distanceFile {};
+        Py_ssize_t chunkSize = 1000000;
+        int bins = 20;
+        // clang-format off
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "etOd|etni", kwlist,
+                                                 "utf-8", &fileName, &nominals, &radius,
+                                                 "utf-8", &distanceFile, &chunkSize, &bins)) {
+            throw Py::Exception();
+        }
+        // clang-format on
+        std::string encodedName(fileName);
+        PyMem_Free(fileName);
+        std::string encodedOutput(distanceFile ? distanceFile : "");
+        PyMem_Free(distanceFile);
+
+        std::vector<App::DocumentObject*> objects;
+        Py::Sequence list(nominals);
+        for (const auto& it : list) {
+            if (!PyObject_TypeCheck(it.ptr(), &App::DocumentObjectPy::Type)) {
+                throw Py::TypeError("Nominals must be a list of document objects");
+            }
+            objects.push_back(
+                static_cast<App::DocumentObjectPy*>(it.ptr())->getDocumentObjectPtr()
+            );
+        }
+
+        try {
+            StreamInspection inspection(objects, static_cast<float>(radius));
+            inspection.setChunkSize(static_cast<std::size_t>(std::max<Py_ssize_t>(chunkSize, 1)));
+            inspection.setHistogramBins(bins);
+            inspection.setDistanceFile(encodedOutput);
+            DistanceStatistics stats = inspection.perform(encodedName);
+
+            Py::List histogram;
+            for (auto it : stats.histogram) {
+                histogram.append(Py::Long(static_cast<unsigned long>(it)));
+            }
+
+            Py::Dict dict;
+            dict.setItem("Count", Py::Long(static_cast<unsigned long>(stats.count)));
+            dict.setItem("Inside", Py::Long(static_cast<unsigned long>(stats.numValid)));
+            if (stats.numValid > 0) {
+                dict.setItem("Min", Py::Float(stats.minDist));
+                dict.setItem("Max", Py::Float(stats.maxDist));
+            }
+            dict.setItem("Mean", Py::Float(stats.getMean()));
+            dict.setItem("RMS", Py::Float(stats.getRMS()));
+            dict.setItem("Histogram", histogram);
+            return dict;
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+        catch (const std::exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
 };
 
 PyObject* initModule()
@@ -23,17 +23,28 @@
  ***************************************************************************/
 
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <numeric>
 #include <limits>
 
-#include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepClass3d_SolidClassifier.hxx>
-#include <BRepExtrema_DistShapeShape.hxx>
-#include <BRepGProp_Face.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepClass_FaceClassifier.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <Bnd_Box.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Geom_Surface.hxx>
+#include <Poly_Triangle.hxx>
+#include <Precision.hxx>
 #include <TopExp.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
 
 #include <QEventLoop>
 #include <QFuture>
@@ -41,6 +52,8 @@
 #include <QtConcurrentMap>
 
 #include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
@@ -50,6 +63,8 @@
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
+#include <Mod/Points/App/PointsAlgos.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -474,86 +489,189 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+struct InspectNominalShape::FaceData
+{
+    TopoDS_Face face;
+    Handle(Geom_Surface) surface;
+    Standard_Real u1 {0}, u2 {0}, v1 {0}, v2 {0};
+};
+
+struct InspectNominalShape::Projectors
+{
+    /// One projector per face, initialized on first use
+    std::vector<std::unique_ptr<GeomAPI_ProjectPointOnSurf>> faces;
+};
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float offset, bool refine)
     : _rShape(shape)
+    , _mesh(new MeshCore::MeshKernel())
+    , _refine(refine)
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
-
-    // When having a solid then use its shell because otherwise the distance
-    // for inner points will always be zero
-    if (!_rShape.IsNull() && _rShape.ShapeType() == TopAbs_SOLID) {
-        TopExp_Explorer xp;
-        xp.Init(_rShape, TopAbs_SHELL);
-        if (xp.More()) {
-            distss->LoadS1(xp.Current());
-            isSolid = true;
-        }
-    }
-    // distss->SetDeflection(radius);
+    tessellate(offset);
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
-    delete distss;
+    delete _pGrid;
+    delete _mesh;
 }
 
-float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+void InspectNominalShape::tessellate(float offset)
 {
-    gp_Pnt pnt3d(point.x, point.y, point.z);
-    BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
+    if (_rShape.IsNull()) {
+        return;
+    }
 
-    float fMinDist = std::numeric_limits<float>::max();
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
-        // the shape is a solid, check if the vertex is inside
-        if (isSolid) {
-            if (isInsideSolid(pnt3d)) {
-                fMinDist = -fMinDist;
-            }
+    // The tessellation must be fine enough to find the right face. With a search radius
+    // that is small compared to the shape a coarse mesh would dominate the error.
+    Bnd_Box bounds = Part::Tools::getBounds(_rShape);
+    Standard_Real deflection = Part::Tools::getDeflection(bounds, 0.1);
+    deflection = std::min<Standard_Real>(deflection, 0.1 * offset);
+    deflection = std::max<Standard_Real>(deflection, Part::Tools::getDeflection(bounds, 0.01));
+    _deflection = static_cast<float>(deflection);
+
+    // Mesh a copy that shares the geometry, so that the nominal shape keeps its triangulation
+    TopoDS_Shape shape = BRepBuilderAPI_Copy(_rShape, Standard_False, Standard_False).Shape();
+    BRepMesh_IncrementalMesh(shape, deflection, Standard_False, 0.1, Standard_True);
+
+    // Collect the triangles of all faces and remember to which face they belong
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    TopTools_IndexedMapOfShape mapOfFaces;
+    TopExp::MapShapes(shape, TopAbs_FACE, mapOfFaces);
+    _faces.reserve(mapOfFaces.Extent());
+    for (int i = 1; i <= mapOfFaces.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(mapOfFaces(i));
+        std::vector<gp_Pnt> nodes;
+        std::vector<Poly_Triangle> triangles;
+        if (!Part::Tools::getTriangulation(face, nodes, triangles)) {
+            continue;
         }
-        else if (fMinDist > 0) {
-            // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
-                fMinDist = -fMinDist;
-            }
+
+        FaceData data;
+        data.face = face;
+        data.surface = BRep_Tool::Surface(face);
+        BRepTools::UVBounds(face, data.u1, data.u2, data.v1, data.v2);
+        int faceIndex = static_cast<int>(_faces.size());
+        _faces.push_back(data);
+
+        auto base = static_cast<MeshCore::PointIndex>(points.size());
+        for (const auto& it : nodes) {
+            points.emplace_back(float(it.X()), float(it.Y()), float(it.Z()));
+        }
+        for (const auto& it : triangles) {
+            Standard_Integer n1, n2, n3;
+            it.Get(n1, n2, n3);
+            facets.emplace_back(base + n1, base + n2, base + n3);
+            _facetToFace.push_back(faceIndex);
         }
     }
+
+    _mesh->Adopt(points, facets);
+    if (_mesh->CountFacets() == 0) {
+        return;
+    }
+
+    // Max. limit of grid elements
+    float fMaxGridElements = 8000000.0f;
+    _box = _mesh->GetBoundBox();
+    float fMinGridLen = (float)pow(
+        (_box.LengthX() * _box.LengthY() * _box.LengthZ() / fMaxGridElements),
+        0.3333f
+    );
+    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(*_mesh).GetAverageEdgeLength();
+    fGridLen = std::max<float>(fMinGridLen, fGridLen);
+
+    _pGrid = new MeshCore::MeshFacetGrid(*_mesh, fGridLen);
+    _box.Enlarge(offset);
+}
+
+float InspectNominalShape::getDistance(const Base::Vector3f& point) const
+{
+    if (!_pGrid || !_box.IsInBox(point)) {
+        return std::numeric_limits<float>::max();  // must be inside bbox
+    }
+
+    MeshCore::FacetIndex facet = _pGrid->SearchNearestFromPoint(point);
+    if (facet == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
+    }
+
+    // The sign is taken from the oriented triangle. For solids the triangles point outwards
+    // so that inner points get a negative distance
+    MeshCore::MeshGeomFacet geomFace = _mesh->GetFacet(facet);
+    Base::Vector3f proj;
+    float fMinDist = geomFace.DistanceToPoint(point, proj);
+    bool positive = point.DistanceToPlane(proj, geomFace.GetNormal()) >= 0;
+
+    if (_refine) {
+        refineDistance(point, facet, fMinDist);
+    }
+
+    if (!positive) {
+        fMinDist = -fMinDist;
+    }
     return fMinDist;
 }
 
-bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::refineDistance(
+    const Base::Vector3f& point,
+    unsigned long facet,
+    float& dist
+) const
 {
-    const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    int faceIndex = _facetToFace[facet];
+    const FaceData& data = _faces[faceIndex];
+    if (data.surface.IsNull()) {
+        return false;
+    }
+
+    gp_Pnt pnt3d(point.x, point.y, point.z);
+    GeomAPI_ProjectPointOnSurf& proj = getProjector(faceIndex);
+    proj.Perform(pnt3d);
+    if (!proj.IsDone() || proj.NbPoints() == 0) {
+        return false;
+    }
+
+    Standard_Real u, v;
+    proj.LowerDistanceParameters(u, v);
+    const Standard_Real tol = Precision::Confusion();
+    BRepClass_FaceClassifier classifier(data.face, gp_Pnt2d(u, v), tol);
+    if (classifier.State() == TopAbs_OUT) {
+        return false;
+    }
+
+    // The exact distance can only deviate from the tessellation by the deflection
+    auto exact = static_cast<float>(proj.LowerDistance());
+    if (std::fabs(exact - dist) > 2.0f * _deflection) {
+        return false;
+    }
+
+    dist = exact;
+    return true;
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+GeomAPI_ProjectPointOnSurf& InspectNominalShape::getProjector(int face) const
 {
-    // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
-            Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
-            BRepGProp_Face props(TopoDS::Face(face));
-            gp_Vec normal;
-            gp_Pnt center;
-            props.Normal(u, v, center, normal);
-            gp_Vec dir(center, pnt3d);
-            Standard_Real scalar = normal.Dot(dir);
-            if (scalar < 0) {
-                return true;
-            }
-            break;
+    Projectors* projectors = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_projectorMutex);
+        std::unique_ptr<Projectors>& entry = _projectors[std::this_thread::get_id()];
+        if (!entry) {
+            entry = std::make_unique<Projectors>();
+            entry->faces.resize(_faces.size());
         }
+        projectors = entry.get();
     }
 
-    return false;
+    // Only the calling thread uses its projectors, so they are initialized without the lock
+    std::unique_ptr<GeomAPI_ProjectPointOnSurf>& proj = projectors->faces[face];
+    if (!proj) {
+        const FaceData& data = _faces[face];
+        proj = std::make_unique<GeomAPI_ProjectPointOnSurf>();
+        proj->Init(data.surface, data.u1, data.u2, data.v1, data.v2);
+    }
+    return *proj;
 }
 
 // ----------------------------------------------------------------
@@ -759,8 +877,231 @@ public:
     int m_numv {0};
     double m_sumsq {0.0};
 };
+
+std::vector<InspectNominalGeometry*> createNominals(
+    const std::vector<App::DocumentObject*>& nominals,
+    float radius
+)
+{
+    // clang-format off
+    std::vector<InspectNominalGeometry*> inspectNominal;
+    for (auto it : nominals) {
+        InspectNominalGeometry* nominal = nullptr;
+        if (it->isDerivedFrom<Mesh::Feature>()) {
+            Mesh::Feature* mesh = static_cast<Mesh::Feature*>(it);
+            nominal = new InspectNominalMesh(mesh->Mesh.getValue(), radius);
+        }
+        else if (it->isDerivedFrom<Points::Feature>()) {
+            Points::Feature* pts = static_cast<Points::Feature*>(it);
+            nominal = new InspectNominalPoints(pts->Points.getValue(), radius);
+        }
+        else if (it->isDerivedFrom<Part::Feature>()) {
+            Part::Feature* part = static_cast<Part::Feature*>(it);
+            nominal = new InspectNominalShape(part->Shape.getValue(), radius);
+        }
+
+        if (nominal) {
+            inspectNominal.push_back(nominal);
+        }
+    }
+    // clang-format on
+    return inspectNominal;
+}
+
+float minDistance(
+    const std::vector<InspectNominalGeometry*>& nominals,
+    const Base::Vector3f& pnt,
+    float radius
+)
+{
+    float fMinDist = std::numeric_limits<float>::max();
+    for (auto it : nominals) {
+        float fDist = it->getDistance(pnt);
+        if (fabs(fDist) < fabs(fMinDist)) {
+            fMinDist = fDist;
+        }
+    }
+
+    if (fMinDist > radius) {
+        fMinDist = std::numeric_limits<float>::max();
+    }
+    else if (-fMinDist > radius) {
+        fMinDist = -std::numeric_limits<float>::max();
+    }
+
+    return fMinDist;
+}
 }  // namespace Inspection
 
+// ----------------------------------------------------------------
+
+DistanceStatistics::DistanceStatistics(float radius, int bins)
+    : radius(radius)
+    , histogram(std::max(bins, 1), 0)
+{}
+
+void DistanceStatistics::add(float dist)
+{
+    count++;
+    if (fabs(dist) == std::numeric_limits<float>::max()) {
+        return;
+    }
+
+    numValid++;
+    minDist = std::min(minDist, dist);
+    maxDist = std::max(maxDist, dist);
+    sum += static_cast<double>(dist);
+    sumsq += static_cast<double>(dist) * static_cast<double>(dist);
+
+    if (!histogram.empty() && radius > 0.0F) {
+        auto numBins = static_cast<long>(histogram.size());
+        auto bin = static_cast<long>((dist + radius) / (2.0F * radius) * float(numBins));
+        histogram[std::clamp<long>(bin, 0, numBins - 1)]++;
+    }
+}
+
+DistanceStatistics& DistanceStatistics::operator+=(const DistanceStatistics& rhs)
+{
+    count += rhs.count;
+    numValid += rhs.numValid;
+    minDist = std::min(minDist, rhs.minDist);
+    maxDist = std::max(maxDist, rhs.maxDist);
+    sum += rhs.sum;
+    sumsq += rhs.sumsq;
+    if (histogram.size() < rhs.histogram.size()) {
+        histogram.resize(rhs.histogram.size(), 0);
+    }
+    for (std::size_t i = 0; i < rhs.histogram.size(); i++) {
+        histogram[i] += rhs.histogram[i];
+    }
+    return *this;
+}
+
+double DistanceStatistics::getRMS() const
+{
+    if (numValid == 0) {
+        return 0.0;
+    }
+    return sqrt(sumsq / static_cast<double>(numValid));
+}
+
+double DistanceStatistics::getMean() const
+{
+    if (numValid == 0) {
+        return 0.0;
+    }
+    return sum / static_cast<double>(numValid);
+}
+
+// ----------------------------------------------------------------
+
+StreamInspection::StreamInspection(const std::vector<App::DocumentObject*>& objects, float radius)
+    : nominals(createNominals(objects, radius))
+    , radius(radius)
+{}
+
+StreamInspection::~StreamInspection()
+{
+    for (auto it : nominals) {
+        delete it;
+    }
+}
+
+void StreamInspection::setChunkSize(std::size_t size)
+{
+    chunkSize = std::max<std::size_t>(size, 1);
+}
+
+void StreamInspection::setHistogramBins(int num)
+{
+    bins = std::max(num, 1);
+}
+
+void StreamInspection::setDistanceFile(const std::string& fn)
+{
+    distanceFile = fn;
+}
+
+DistanceStatistics StreamInspection::perform(const std::string& filename) const
+{
+    std::unique_ptr<Points::ChunkedReader> reader = Points::ChunkedReader::create(filename);
+    if (!reader) {
+        throw Base::FileException("Unsupported file type for streamed inspection", filename);
+    }
+    reader->open(filename);
+
+    std::unique_ptr<Base::ofstream> out;
+    if (!distanceFile.empty()) {
+        Base::FileInfo fi(distanceFile);
+        out = std::make_unique<Base::ofstream>(fi, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!out->is_open()) {
+            throw Base::FileException("Cannot open file", distanceFile);
+        }
+    }
+
+    Base::SequencerLauncher seq("Inspecting…", 0);
+    DistanceStatistics stats(radius, bins);
+    std::vector<Base::Vector3f> current;
+    std::vector<Base::Vector3f> next;
+    std::vector<float> distances;
+    bool more = reader->next(current, chunkSize);
+    while (more) {
+        // read in the next chunk while the current one is inspected
+        std::future<bool> reading = std::async(std::launch::async, [&]() {
+            return reader->next(next, chunkSize);
+        });
+
+        stats += inspect(current, distances);
+        if (out) {
+            out->write(
+                reinterpret_cast<const char*>(distances.data()),
+                static_cast<std::streamsize>(distances.size() * sizeof(float))
+            );
+        }
+
+        more = reading.get();
+        current.swap(next);
+        seq.next(true);
+    }
+
+    return stats;
+}
+
+DistanceStatistics StreamInspection::inspect(
+    const std::vector<Base::Vector3f>& points,
+    std::vector<float>& distances
+) const
+{
+    distances.resize(points.size());
+
+    // split the chunk into blocks so that each thread collects its own statistics
+    const std::size_t blockSize = 4096;
+    std::vector<std::pair<std::size_t, std::size_t>> blocks;
+    for (std::size_t i = 0; i < points.size(); i += blockSize) {
+        blocks.emplace_back(i, std::min(i + blockSize, points.size()));
+    }
+
+    std::function<DistanceStatistics(const std::pair<std::size_t, std::size_t>&)> fMap =
+        [&](const std::pair<std::size_t, std::size_t>& block) {
+            DistanceStatistics res(radius, bins);
+            for (std::size_t i = block.first; i < block.second; i++) {
+                float fMinDist = minDistance(nominals, points[i], radius);
+                distances[i] = fMinDist;
+                res.add(fMinDist);
+            }
+            return res;
+        };
+
+    return QtConcurrent::blockingMappedReduced<DistanceStatistics>(
+        blocks,
+        fMap,
+        &DistanceStatistics::operator+=,
+        QtConcurrent::OrderedReduce
+    );
+}
+
+// ----------------------------------------------------------------
+
 PROPERTY_SOURCE(Inspection::Feature, App::DocumentObject)
 
 Feature::Feature()
@@ -818,31 +1159,9 @@ App::DocumentObjectExecReturn* Feature::execute()
         throw Base::TypeError("Unknown geometric type");
     }
 
-    // clang-format off
     // get a list of nominals
-    std::vector<InspectNominalGeometry*> inspectNominal;
-    const std::vector<App::DocumentObject*>& nominals = Nominals.getValues();
-    for (auto it : nominals) {
-        InspectNominalGeometry* nominal = nullptr;
-        if (it->isDerivedFrom<Mesh::Feature>()) {
-            Mesh::Feature* mesh = static_cast<Mesh::Feature*>(it);
-            nominal = new InspectNominalMesh(mesh->Mesh.getValue(), this->SearchRadius.getValue());
-        }
-        else if (it->isDerivedFrom<Points::Feature>()) {
-            Points::Feature* pts = static_cast<Points::Feature*>(it);
-            nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
-        }
-        else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
-            Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
-        }
-
-        if (nominal) {
-            inspectNominal.push_back(nominal);
-        }
-    }
-    // clang-format on
+    std::vector<InspectNominalGeometry*> inspectNominal
+        = createNominals(Nominals.getValues(), this->SearchRadius.getValue());
 
 #if 0
 # if 1  // test with some huge data sets
@@ -905,21 +1224,8 @@ App::DocumentObjectExecReturn* Feature::execute()
         DistanceInspectionRMS res;
         Base::Vector3f pnt = actual->getPoint(index);
 
-        float fMinDist = std::numeric_limits<float>::max();
-        for (auto it : inspectNominal) {
-            float fDist = it->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist)) {
-                fMinDist = fDist;
-            }
-        }
-
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = std::numeric_limits<float>::max();
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -std::numeric_limits<float>::max();
-        }
-        else {
+        float fMinDist = minDistance(inspectNominal, pnt, this->SearchRadius.getValue());
+        if (fabs(fMinDist) < std::numeric_limits<float>::max()) {
             res.m_sumsq += static_cast<double>(fMinDist) * static_cast<double>(fMinDist);
             res.m_numv++;
         }
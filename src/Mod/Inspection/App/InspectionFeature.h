@@ -24,6 +24,12 @@
 
 #pragma once
 
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -31,14 +37,14 @@
 #include <Mod/Points/App/Points.h>
 
 
+class GeomAPI_ProjectPointOnSurf;
 class TopoDS_Shape;
-class BRepExtrema_DistShapeShape;
-class gp_Pnt;
 
 namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshFacetGrid;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -160,21 +166,38 @@ private:
     Points::PointsGrid* _pGrid;
 };
 
+/** Calculates the distance to a shape.
+ * The shape is tessellated once with a fine deflection and the nearest triangle gives an
+ * approximate distance, its sign and the face it belongs to. If \a refine is true the distance
+ * is then refined by projecting the point onto the surface of this face. All data is read-only
+ * after construction so that getDistance() can be called from several threads.
+ */
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
 {
 public:
-    InspectNominalShape(const TopoDS_Shape&, float offset);
+    InspectNominalShape(const TopoDS_Shape&, float offset, bool refine = true);
     ~InspectNominalShape() override;
     float getDistance(const Base::Vector3f&) const override;
 
 private:
-    bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    void tessellate(float offset);
+    bool refineDistance(const Base::Vector3f&, unsigned long facet, float& dist) const;
+    GeomAPI_ProjectPointOnSurf& getProjector(int face) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
+    struct FaceData;
+    struct Projectors;
     const TopoDS_Shape& _rShape;
-    bool isSolid {false};
+    MeshCore::MeshKernel* _mesh;
+    MeshCore::MeshFacetGrid* _pGrid {nullptr};
+    std::vector<FaceData> _faces;
+    std::vector<int> _facetToFace;
+    Base::BoundBox3f _box;
+    float _deflection {0.0F};
+    bool _refine;
+    // The projectors keep state between calls, so each thread gets its own set
+    mutable std::mutex _projectorMutex;
+    mutable std::map<std::thread::id, std::unique_ptr<Projectors>> _projectors;
 };
 
 class InspectionExport PropertyDistanceList: public App::PropertyLists
@@ -237,6 +260,64 @@ private:
 
 // ----------------------------------------------------------------
 
+/** Summary of the distances within the search radius of a streamed inspection. */
+class InspectionExport DistanceStatistics
+{
+public:
+    DistanceStatistics() = default;
+    DistanceStatistics(float radius, int bins);
+    void add(float dist);
+    DistanceStatistics& operator+=(const DistanceStatistics& rhs);
+    double getRMS() const;
+    double getMean() const;
+
+    float radius {0.0F};
+    /// Number of all points
+    std::size_t count {0};
+    /// Number of points within the search radius
+    std::size_t numValid {0};
+    float minDist {std::numeric_limits<float>::max()};
+    float maxDist {-std::numeric_limits<float>::max()};
+    double sum {0.0};
+    double sumsq {0.0};
+    /// Equally sized bins covering [-radius, radius]
+    std::vector<std::size_t> histogram;
+};
+
+/** Inspects a point cloud that is read chunk-wise from a file instead of a document object.
+ * Only one chunk at a time is kept in memory so that the size of the file is not limited by
+ * the available memory. The distances can optionally be written to a file as 32-bit floats
+ * in the order of the input points.
+ */
+class InspectionExport StreamInspection
+{
+public:
+    StreamInspection(const std::vector<App::DocumentObject*>& nominals, float radius);
+    ~StreamInspection();
+
+    void setChunkSize(std::size_t);
+    void setHistogramBins(int);
+    void setDistanceFile(const std::string&);
+    DistanceStatistics perform(const std::string& filename) const;
+
+    StreamInspection(const StreamInspection&) = delete;
+    StreamInspection(StreamInspection&&) = delete;
+    StreamInspection& operator=(const StreamInspection&) = delete;
+    StreamInspection& operator=(StreamInspection&&) = delete;
+
+private:
+    DistanceStatistics inspect(const std::vector<Base::Vector3f>&, std::vector<float>&) const;
+
+private:
+    std::vector<InspectNominalGeometry*> nominals;
+    std::string distanceFile;
+    std::size_t chunkSize {1000000};
+    float radius;
+    int bins {20};
+};
+
+// ----------------------------------------------------------------
+
 /** The inspection feature.
  * \author Werner Mayer
  */
@@ -24,10 +24,16 @@
 
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QtConcurrentMap>
+
 #include <Base/Console.h>
 #include <Base/Sequencer.h>
+#include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
@@ -1589,11 +1595,110 @@ bool MeshAlgorithm::CutWithPlane(
     std::sort(aulFacets.begin(), aulFacets.end());
     aulFacets.erase(std::unique(aulFacets.begin(), aulFacets.end()), aulFacets.end());
 
+    return CutFacetsWithPlane(aulFacets, clBase, clNormal, rclResult, fMinEps, bConnectPolygons);
+}
+
+void MeshAlgorithm::CutWithPlanes(
+    const Base::Vector3f& clNormal,
+    const std::vector<float>& distances,
+    std::vector<std::list<std::vector<Base::Vector3f>>>& rclResults,
+    float fMinEps,
+    bool bConnectPolygons
+) const
+{
+    rclResults.clear();
+    rclResults.resize(distances.size());
+    if (distances.empty()) {
+        return;
+    }
+
+    Base::Vector3f normal(clNormal);
+    normal.Normalize();
+
+    // sort the planes by their distance so that the planes a facet spans form a contiguous range
+    std::vector<std::size_t> order(distances.size());
+    std::generate(order.begin(), order.end(), Base::iotaGen<std::size_t>(0));
+    std::sort(order.begin(), order.end(), [&distances](std::size_t lhs, std::size_t rhs) {
+        return distances[lhs] < distances[rhs];
+    });
+    std::vector<float> sorted;
+    sorted.reserve(order.size());
+    for (std::size_t index : order) {
+        sorted.push_back(distances[index]);
+    }
+
+    // project the points onto the normal only once for all planes
+    const MeshPointArray& points = _rclMesh.GetPoints();
+    std::vector<float> heights;
+    heights.reserve(points.size());
+    float maxHeight = 0.0F;
+    for (const auto& point : points) {
+        heights.push_back(point * normal);
+        maxHeight = std::max(maxHeight, std::fabs(heights.back()));
+    }
+
+    // Assign every facet to all planes it spans. The facets are visited in ascending order so
+    // that each plane gets the same sequence of facets as with CutWithPlane().
+    const float eps = std::max(1.0e-05F, maxHeight * 1.0e-06F);
+    std::vector<std::vector<FacetIndex>> facetsOfPlane(sorted.size());
+    const MeshFacetArray& facets = _rclMesh.GetFacets();
+    for (FacetIndex index = 0; index < facets.size(); index++) {
+        const MeshFacet& facet = facets[index];
+        float h0 = heights[facet._aulPoints[0]];
+        float h1 = heights[facet._aulPoints[1]];
+        float h2 = heights[facet._aulPoints[2]];
+        float minH = std::min({h0, h1, h2}) - eps;
+        float maxH = std::max({h0, h1, h2}) + eps;
+        auto first = std::lower_bound(sorted.begin(), sorted.end(), minH);
+        auto last = std::upper_bound(first, sorted.end(), maxH);
+        for (auto it = first; it != last; ++it) {
+            facetsOfPlane[it - sorted.begin()].push_back(index);
+        }
+    }
+
+    std::vector<std::size_t> planes(sorted.size());
+    std::generate(planes.begin(), planes.end(), Base::iotaGen<std::size_t>(0));
+    auto cutPlane = [&](std::size_t index) {
+        std::list<std::vector<Base::Vector3f>> polylines;
+        CutFacetsWithPlane(
+            facetsOfPlane[index],
+            normal * sorted[index],
+            normal,
+            polylines,
+            fMinEps,
+            bConnectPolygons
+        );
+        return polylines;
+    };
+
+    // NOLINTBEGIN
+    QFuture<std::list<std::vector<Base::Vector3f>>> future
+        = QtConcurrent::mapped(planes, std::function(cutPlane));
+    // NOLINTEND
+    QFutureWatcher<std::list<std::vector<Base::Vector3f>>> watcher;
+    watcher.setFuture(future);
+    watcher.waitForFinished();
+
+    std::size_t index = 0;
+    for (const auto& it : future) {
+        rclResults[order[index++]] = it;
+    }
+}
+
+bool MeshAlgorithm::CutFacetsWithPlane(
+    const std::vector<FacetIndex>& raulFacets,
+    const Base::Vector3f& clBase,
+    const Base::Vector3f& clNormal,
+    std::list<std::vector<Base::Vector3f>>& rclResult,
+    float fMinEps,
+    bool bConnectPolygons
+) const
+{
     // intersect all facets with plane
     std::list<std::pair<Base::Vector3f, Base::Vector3f>> clTempPoly;  // Field with intersection lines
                                                                       // (unsorted, not chained)
 
-    for (FacetIndex facetIndex : aulFacets) {
+    for (FacetIndex facetIndex : raulFacets) {
         Base::Vector3f clE1, clE2;
         const MeshGeomFacet clF(_rclMesh.GetFacet(facetIndex));
 
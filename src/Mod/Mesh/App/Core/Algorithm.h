@@ -411,6 +411,19 @@ public:
         float fMinEps = 1.0e-2F,
         bool bConnectPolygons = false
     ) const;
+    /**
+     * Cuts the mesh with a set of parallel planes with the common normal \a clNormal. Each plane
+     * is given by its signed distance to the origin. The facets are assigned to the planes they
+     * span in a single pass over the mesh, then the planes are cut in parallel.
+     * \a rclResults gets one list of polylines per plane in the order of \a distances.
+     */
+    void CutWithPlanes(
+        const Base::Vector3f& clNormal,
+        const std::vector<float>& distances,
+        std::vector<std::list<std::vector<Base::Vector3f>>>& rclResults,
+        float fMinEps = 1.0e-2F,
+        bool bConnectPolygons = false
+    ) const;
     /**
      * Gets all facets that cut the plane (N,d) and that lie between the two points left and right.
      * The plane is defined by it normalized normal and the signed distance to the origin.
@@ -455,6 +468,15 @@ protected:
         std::list<std::vector<Base::Vector3f>>& clPolyList,
         std::list<std::pair<Base::Vector3f, Base::Vector3f>>& rclLines
     ) const;
+    /** Intersects the facets \a raulFacets with the plane and connects the intersection lines. */
+    bool CutFacetsWithPlane(
+        const std::vector<FacetIndex>& raulFacets,
+        const Base::Vector3f& clBase,
+        const Base::Vector3f& clNormal,
+        std::list<std::vector<Base::Vector3f>>& rclResult,
+        float fMinEps,
+        bool bConnectPolygons
+    ) const;
     /** Searches the nearest facet in \a raulFacets to the ray (\a rclPt, \a rclDir). */
     bool RayNearestField(
         const Base::Vector3f& rclPt,
@@ -1153,8 +1153,31 @@ void MeshObject::crossSections(
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(this->_Mtrx);
 
-    MeshCore::MeshFacetGrid grid(kernel);
     MeshCore::MeshAlgorithm algo(kernel);
+
+    // parallel planes are cut as one batch
+    if (!planes.empty()) {
+        Base::Vector3f normal = planes.front().second;
+        normal.Normalize();
+        std::vector<float> distances;
+        distances.reserve(planes.size());
+        for (const auto& plane : planes) {
+            Base::Vector3f dir = plane.second;
+            dir.Normalize();
+            if (dir == normal) {
+                distances.push_back(plane.first * normal);
+            }
+        }
+
+        if (distances.size() == planes.size()) {
+            std::vector<MeshObject::TPolylines> results;
+            algo.CutWithPlanes(normal, distances, results, fMinEps, bConnectPolygons);
+            sections.insert(sections.end(), results.begin(), results.end());
+            return;
+        }
+    }
+
+    MeshCore::MeshFacetGrid grid(kernel);
     for (const auto& plane : planes) {
         MeshObject::TPolylines polylines;
         algo.CutWithPlane(plane.first, plane.second, grid, polylines, fMinEps, bConnectPolygons);
@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
 
 #include <FCConfig.h>
@@ -41,6 +42,7 @@
 #include <GeomAPI_IntCS.hxx>
 #include <Geom_Curve.hxx>
 #include <Geom_Plane.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Failure.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -69,10 +71,157 @@ using MeshCore::MeshFacetIterator;
 using MeshCore::MeshKernel;
 using MeshCore::MeshPointIterator;
 
+namespace
+{
+
+// Limits the walk over the facets before a global search is used
+constexpr int maxWalkSteps = 100;
+
+// Returns the side of the facet where the projection of the point lies outside, or -1 if it's
+// inside the facet
+int outsideEdge(const MeshGeomFacet& facet, const Base::Vector3f& pnt)
+{
+    Base::Vector3f normal = facet.GetNormal();
+    int side = -1;
+    float minDist = 0.0F;
+    for (int i = 0; i < 3; i++) {
+        const Base::Vector3f& p0 = facet._aclPoints[i];
+        const Base::Vector3f& p1 = facet._aclPoints[(i + 1) % 3];
+        Base::Vector3f inward = normal % (p1 - p0);
+        float length = inward.Length();
+        if (length <= 0.0F) {
+            continue;
+        }
+        float dist = inward * (pnt - p0) / length;
+        if (dist < minDist) {
+            minDist = dist;
+            side = i;
+        }
+    }
+
+    return side;
+}
+
+// Projects the point along the normal of the facet. This is the orthogonal projection of the point
+// onto the plane of the facet if it lies inside the facet.
+bool projectAlongNormal(
+    const MeshGeomFacet& facet,
+    const Base::Vector3f& pnt,
+    Base::Vector3f& result,
+    float& distance
+)
+{
+    if (!facet.Foraminate(pnt, facet.GetNormal(), result)) {
+        return false;
+    }
+
+    distance = (pnt - result).Length();
+    return true;
+}
+
+}  // namespace
+
 CurveProjector::CurveProjector(const TopoDS_Shape& aShape, const MeshKernel& pMesh)
     : _Shape(aShape)
     , _Mesh(pMesh)
-{}
+{
+    if (pMesh.CountFacets() > 0) {
+        MeshAlgorithm clAlg(pMesh);
+        float fAvgLen = clAlg.GetAverageEdgeLength();
+        _Grid = std::make_unique<MeshFacetGrid>(pMesh, 5.0f * fAvgLen);
+        _SearchRadius = 5.0f * fAvgLen;
+    }
+}
+
+CurveProjector::~CurveProjector() = default;
+
+std::vector<TopoDS_Edge> CurveProjector::getEdges() const
+{
+    std::vector<TopoDS_Edge> edges;
+    for (TopExp_Explorer Ex(_Shape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
+        edges.push_back(TopoDS::Edge(Ex.Current()));
+    }
+    return edges;
+}
+
+bool CurveProjector::projectPoint(
+    const Base::Vector3f& pnt,
+    MeshCore::FacetIndex& facet,
+    Base::Vector3f& result
+) const
+{
+    if (!_Grid) {
+        return false;
+    }
+
+    const MeshCore::MeshFacetArray& facets = _Mesh.GetFacets();
+    MeshCore::FacetIndex current = facet;
+    MeshCore::FacetIndex previous = MeshCore::FACET_INDEX_MAX;
+    for (int step = 0; step < maxWalkSteps && current < facets.size(); step++) {
+        MeshGeomFacet geomFacet = _Mesh.GetFacet(current);
+        Base::Vector3f proj;
+        geomFacet.ProjectPointToPlane(pnt, proj);
+        int side = outsideEdge(geomFacet, proj);
+        if (side < 0) {
+            // a nearer facet must lie within the distance to the found one
+            float distance {};
+            if (projectAlongNormal(geomFacet, pnt, proj, distance)) {
+                return findNearestFacet(pnt, std::max(distance, 0.0F), facet, result);
+            }
+            break;
+        }
+
+        // move to the neighbour facing the point, stop at the border or if the walk turns back
+        MeshCore::FacetIndex next = facets[current]._aulNeighbours[side];
+        if (next == previous) {
+            break;
+        }
+        previous = current;
+        current = next;
+    }
+
+    return findNearestFacet(pnt, _SearchRadius, facet, result);
+}
+
+bool CurveProjector::findNearestFacet(
+    const Base::Vector3f& pnt,
+    float radius,
+    MeshCore::FacetIndex& facet,
+    Base::Vector3f& result
+) const
+{
+    // The search box is enlarged until it contains the nearest projection or the whole mesh.
+    // The facets are checked in the order of their indices, so that of several facets with the
+    // same distance the first one is taken as with a check of all facets.
+    const Base::BoundBox3f& meshBox = _Mesh.GetBoundBox();
+    std::vector<MeshCore::FacetIndex> candidates;
+    radius = std::max(radius, std::numeric_limits<float>::min());
+    for (;;) {
+        Base::BoundBox3f box(pnt, radius);
+        candidates.clear();
+        _Grid->Inside(box, candidates);
+        std::sort(candidates.begin(), candidates.end());
+
+        bool hit = false;
+        float minDistance = std::numeric_limits<float>::max();
+        for (MeshCore::FacetIndex index : candidates) {
+            Base::Vector3f proj;
+            float distance {};
+            if (projectAlongNormal(_Mesh.GetFacet(index), pnt, proj, distance)
+                && distance < minDistance) {
+                hit = true;
+                minDistance = distance;
+                facet = index;
+                result = proj;
+            }
+        }
+
+        if ((hit && minDistance <= radius) || box.IsInBox(meshBox)) {
+            return hit;
+        }
+        radius *= 2.0F;
+    }
+}
 
 void CurveProjector::writeIntersectionPointsToFile(const char* name)
 {
@@ -103,15 +252,38 @@ CurveProjectorShape::CurveProjectorShape(const TopoDS_Shape& aShape, const MeshK
 
 void CurveProjectorShape::Do()
 {
-    TopExp_Explorer Ex;
-    for (Ex.Init(_Shape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        projectCurve(aEdge, mvEdgeSplitPoints[aEdge]);
+    std::vector<TopoDS_Edge> edges = getEdges();
+    std::vector<std::vector<FaceSplitEdge>> splitEdges(edges.size());
+    std::vector<std::vector<std::string>> messages(edges.size());
+    OSD_Parallel::For(0, int(edges.size()), [&](int index) {
+        projectCurve(edges[index], splitEdges[index], messages[index]);
+    });
+
+    for (std::size_t index = 0; index < edges.size(); index++) {
+        for (const auto& msg : messages[index]) {
+            Base::Console().log("%s", msg.c_str());
+        }
+        auto& vSplitEdges = mvEdgeSplitPoints[edges[index]];
+        vSplitEdges.insert(vSplitEdges.end(), splitEdges[index].begin(), splitEdges[index].end());
     }
 }
 
 
 void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge, std::vector<FaceSplitEdge>& vSplitEdges)
+{
+    std::vector<std::string> messages;
+    projectCurve(aEdge, vSplitEdges, messages);
+    for (const auto& msg : messages) {
+        Base::Console().log("%s", msg.c_str());
+    }
+}
+
+// The messages are collected because the edges are projected in parallel
+void CurveProjectorShape::projectCurve(
+    const TopoDS_Edge& aEdge,
+    std::vector<FaceSplitEdge>& vSplitEdges,
+    std::vector<std::string>& messages
+) const
 {
     Standard_Real fFirst, fLast;
     Handle(Geom_Curve) hCurve = BRep_Tool::Curve(aEdge, fFirst, fLast);
@@ -201,12 +373,12 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge, std::vector<Fac
                 }
                 else if (Alg.NbPoints() > 1) {
                     PointOnEdge[i] = Base::Vector3f(std::numeric_limits<float>::max(), 0, 0);
-                    Base::Console().log(
+                    messages.push_back(fmt::sprintf(
                         "MeshAlgos::projectCurve(): More then one intersection in "
                         "Facet %lu, Edge %d\n",
                         uCurFacetIdx,
                         i
-                    );
+                    ));
                 }
             }
         }
@@ -224,10 +396,10 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge, std::vector<Fac
             GoOn = true;
         }
         else {
-            Base::Console().log(
+            messages.push_back(fmt::sprintf(
                 "MeshAlgos::projectCurve(): Possible reentry in Facet %lu\n",
                 uCurFacetIdx
-            );
+            ));
         }
 
         if (uCurFacetIdx == uStartFacetIdx) {
@@ -242,8 +414,14 @@ bool CurveProjectorShape::findStartPoint(
     const Base::Vector3f& Pnt,
     Base::Vector3f& Rslt,
     MeshCore::FacetIndex& FaceIndex
-)
+) const
 {
+    // use the facet grid of the projected mesh instead of checking all facets
+    if (&MeshK == &_Mesh) {
+        FaceIndex = MeshCore::FACET_INDEX_MAX;
+        return projectPoint(Pnt, FaceIndex, Rslt);
+    }
+
     Base::Vector3f TempResultPoint;
     float MinLength = std::numeric_limits<float>::max();
     bool bHit = false;
@@ -283,13 +461,15 @@ CurveProjectorSimple::CurveProjectorSimple(const TopoDS_Shape& aShape, const Mes
 
 void CurveProjectorSimple::Do()
 {
-    TopExp_Explorer Ex;
-
-    std::vector<Base::Vector3f> vEdgePolygon;
-
-    for (Ex.Init(_Shape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        projectCurve(aEdge, vEdgePolygon, mvEdgeSplitPoints[aEdge]);
+    std::vector<TopoDS_Edge> edges = getEdges();
+    std::vector<std::vector<FaceSplitEdge>> splitEdges(edges.size());
+    OSD_Parallel::For(0, int(edges.size()), [&](int index) {
+        projectCurve(edges[index], {}, splitEdges[index]);
+    });
+
+    for (std::size_t index = 0; index < edges.size(); index++) {
+        auto& vSplitEdges = mvEdgeSplitPoints[edges[index]];
+        vSplitEdges.insert(vSplitEdges.end(), splitEdges[index].begin(), splitEdges[index].end());
     }
 }
 
@@ -297,7 +477,7 @@ void CurveProjectorSimple::GetSampledCurves(
     const TopoDS_Edge& aEdge,
     std::vector<Base::Vector3f>& rclPoints,
     unsigned long ulNbOfPoints
-)
+) const
 {
     rclPoints.clear();
 
@@ -317,57 +497,37 @@ void CurveProjectorSimple::GetSampledCurves(
 
 void CurveProjectorSimple::projectCurve(
     const TopoDS_Edge& aEdge,
-    const std::vector<Base::Vector3f>&,
-    std::vector<FaceSplitEdge>&
-)
+    const std::vector<Base::Vector3f>& rclPoints,
+    std::vector<FaceSplitEdge>& vSplitEdges
+) const
 {
-    Base::Vector3f TempResultPoint;
-    bool bFirst = true;
-
-    Standard_Real fBegin, fEnd;
-    Handle(Geom_Curve) hCurve = BRep_Tool::Curve(aEdge, fBegin, fEnd);
-    float fLen = float(fEnd - fBegin);
-
-    unsigned long ulNbOfPoints = 1000, PointCount = 0;
-
-    MeshFacetIterator It(_Mesh);
-
-    Base::SequencerLauncher seq("Building up projection map...", ulNbOfPoints + 1);
-    Base::FileInfo fi("projected.asc");
-    Base::ofstream str(fi, std::ios::out | std::ios::binary);
-    str.precision(4);
-    str.setf(std::ios::fixed | std::ios::showpoint);
-
-    std::map<MeshCore::FacetIndex, std::vector<Base::Vector3f>> FaceProjctMap;
-
-    for (unsigned long i = 0; i <= ulNbOfPoints; i++) {
-        seq.next();
-        gp_Pnt gpPt = hCurve->Value(fBegin + (fLen * float(i)) / float(ulNbOfPoints - 1));
-
-        // go through the whole Mesh
-        for (It.Init(); It.More(); It.Next()) {
-            // try to project (with angle) to the face
-            if (It->IntersectWithLine(
-                    Base::Vector3f((float)gpPt.X(), (float)gpPt.Y(), (float)gpPt.Z()),
-                    It->GetNormal(),
-                    TempResultPoint
-                )) {
-                FaceProjctMap[It.Position()].push_back(TempResultPoint);
-                str << TempResultPoint.x << " " << TempResultPoint.y << " " << TempResultPoint.z
-                    << std::endl;
-                Base::Console().log("IDX %d\n", It.Position());
+    std::vector<Base::Vector3f> points = rclPoints;
+    if (points.empty()) {
+        GetSampledCurves(aEdge, points, 1000);
+    }
 
-                if (bFirst) {
-                    bFirst = false;
-                }
+    // each point is searched starting at the facet of its predecessor
+    MeshCore::FacetIndex facet = MeshCore::FACET_INDEX_MAX;
+    Base::Vector3f lastPoint;
+    bool hasLastPoint = false;
+    for (const auto& pnt : points) {
+        Base::Vector3f result;
+        if (!projectPoint(pnt, facet, result)) {
+            hasLastPoint = false;
+            continue;
+        }
 
-                PointCount++;
-            }
+        if (hasLastPoint) {
+            FaceSplitEdge splitEdge;
+            splitEdge.ulFaceIndex = facet;
+            splitEdge.p1 = lastPoint;
+            splitEdge.p2 = result;
+            vSplitEdges.push_back(splitEdge);
         }
-    }
 
-    str.close();
-    Base::Console().log("Projection map [%d facets with %d points]\n", FaceProjctMap.size(), PointCount);
+        lastPoint = result;
+        hasLastPoint = true;
+    }
 }
 
 
@@ -376,8 +536,14 @@ bool CurveProjectorSimple::findStartPoint(
     const Base::Vector3f& Pnt,
     Base::Vector3f& Rslt,
     MeshCore::FacetIndex& FaceIndex
-)
+) const
 {
+    // use the facet grid of the projected mesh instead of checking all facets
+    if (&MeshK == &_Mesh) {
+        FaceIndex = MeshCore::FACET_INDEX_MAX;
+        return projectPoint(Pnt, FaceIndex, Rslt);
+    }
+
     Base::Vector3f TempResultPoint;
     float MinLength = std::numeric_limits<float>::max();
     bool bHit = false;
@@ -421,12 +587,15 @@ CurveProjectorWithToolMesh::CurveProjectorWithToolMesh(
 
 void CurveProjectorWithToolMesh::Do()
 {
-    TopExp_Explorer Ex;
-    std::vector<MeshGeomFacet> cVAry;
+    std::vector<TopoDS_Edge> edges = getEdges();
+    std::vector<std::vector<MeshGeomFacet>> toolFacets(edges.size());
+    OSD_Parallel::For(0, int(edges.size()), [&](int index) {
+        makeToolMesh(edges[index], toolFacets[index]);
+    });
 
-    for (Ex.Init(_Shape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        makeToolMesh(aEdge, cVAry);
+    std::vector<MeshGeomFacet> cVAry;
+    for (const auto& it : toolFacets) {
+        cVAry.insert(cVAry.end(), it.begin(), it.end());
     }
 
     ToolMesh.AddFacets(cVAry);
@@ -434,51 +603,49 @@ void CurveProjectorWithToolMesh::Do()
 
 // projectToNeighbours(Handle(Geom_Curve) hCurve,float pos
 
-void CurveProjectorWithToolMesh::makeToolMesh(const TopoDS_Edge& aEdge, std::vector<MeshGeomFacet>& cVAry)
+void CurveProjectorWithToolMesh::makeToolMesh(
+    const TopoDS_Edge& aEdge,
+    std::vector<MeshGeomFacet>& cVAry
+) const
 {
     Standard_Real fBegin, fEnd;
     Handle(Geom_Curve) hCurve = BRep_Tool::Curve(aEdge, fBegin, fEnd);
     float fLen = float(fEnd - fBegin);
     Base::Vector3f cResultPoint;
 
-    unsigned long ulNbOfPoints = 15, PointCount = 0 /*,uCurFacetIdx*/;
+    unsigned long ulNbOfPoints = 15;
+    const float fMaxDist = 0.5f;
 
     std::vector<LineSeg> LineSegs;
-
-    MeshFacetIterator It(_Mesh);
-
-    Base::SequencerLauncher seq("Building up tool mesh...", ulNbOfPoints + 1);
-
-    std::map<MeshCore::FacetIndex, std::vector<Base::Vector3f>> FaceProjctMap;
+    std::vector<MeshCore::FacetIndex> facets;
 
     for (unsigned long i = 0; i < ulNbOfPoints; i++) {
-        seq.next();
         gp_Pnt gpPt = hCurve->Value(fBegin + (fLen * float(i)) / float(ulNbOfPoints - 1));
         Base::Vector3f LinePoint((float)gpPt.X(), (float)gpPt.Y(), (float)gpPt.Z());
 
         Base::Vector3f ResultNormal;
 
-        // go through the whole Mesh
-        for (It.Init(); It.More(); It.Next()) {
+        // only facets near the point can be hit within the maximum distance
+        facets.clear();
+        if (_Grid) {
+            _Grid->Inside(Base::BoundBox3f(LinePoint, fMaxDist), facets);
+        }
+
+        for (MeshCore::FacetIndex index : facets) {
+            MeshGeomFacet facet = _Mesh.GetFacet(index);
             // try to project (with angle) to the face
-            if (It->IntersectWithLine(
-                    Base::Vector3f((float)gpPt.X(), (float)gpPt.Y(), (float)gpPt.Z()),
-                    It->GetNormal(),
-                    cResultPoint
-                )) {
-                if (Base::Distance(LinePoint, cResultPoint) < 0.5) {
-                    ResultNormal += It->GetNormal();
+            if (facet.IntersectWithLine(LinePoint, facet.GetNormal(), cResultPoint)) {
+                if (Base::Distance(LinePoint, cResultPoint) < fMaxDist) {
+                    ResultNormal += facet.GetNormal();
                 }
             }
         }
         LineSeg s;
-        s.p = Base::Vector3f((float)gpPt.X(), (float)gpPt.Y(), (float)gpPt.Z());
+        s.p = LinePoint;
         s.n = ResultNormal.Normalize();
         LineSegs.push_back(s);
     }
 
-    Base::Console().log("Projection map [%d facets with %d points]\n", FaceProjctMap.size(), PointCount);
-
 
     // build up the new mesh
     Base::Vector3f lp(std::numeric_limits<float>::max(), 0, 0), ln, p1, p2, p3, p4, p5, p6;
@@ -657,27 +824,24 @@ void MeshProjection::projectToMesh(
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
 
-    TopExp_Explorer Ex;
-
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
+    std::vector<TopoDS_Edge> edges;
+    for (TopExp_Explorer Ex(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
+        edges.push_back(TopoDS::Edge(Ex.Current()));
     }
 
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
-
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
+    // the edges are projected in parallel and share the grid
+    std::vector<PolyLine> polylines(edges.size());
+    OSD_Parallel::For(0, int(edges.size()), [&](int index) {
         std::vector<SplitEdge> rSplitEdges;
-        projectEdgeToEdge(aEdge, fMaxDist, cGrid, rSplitEdges);
-        PolyLine polyline;
+        projectEdgeToEdge(edges[index], fMaxDist, cGrid, rSplitEdges);
+        PolyLine& polyline = polylines[index];
         polyline.points.reserve(rSplitEdges.size());
-        for (auto it : rSplitEdges) {
+        for (const auto& it : rSplitEdges) {
             polyline.points.push_back(it.cPt);
         }
-        rPolyLines.push_back(polyline);
-        seq.next();
-    }
+    });
+
+    rPolyLines.insert(rPolyLines.end(), polylines.begin(), polylines.end());
 }
 
 void MeshProjection::projectOnMesh(
@@ -775,19 +939,17 @@ void MeshProjection::projectParallelToMesh(
     MeshAlgorithm clAlg(_rcMesh);
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-    TopExp_Explorer Ex;
 
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
+    std::vector<TopoDS_Edge> edges;
+    for (TopExp_Explorer Ex(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
+        edges.push_back(TopoDS::Edge(Ex.Current()));
     }
 
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
-
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
+    // the edges are projected in parallel and share the grid
+    std::vector<PolyLine> polylines(edges.size());
+    OSD_Parallel::For(0, int(edges.size()), [&](int index) {
         std::vector<Base::Vector3f> points;
-        discretize(aEdge, points, 5);
+        discretize(edges[index], points, 5);
 
         using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
         std::vector<HitPoint> hitPoints;
@@ -808,7 +970,7 @@ void MeshProjection::projectParallelToMesh(
         }
 
         MeshCore::MeshProjection meshProjection(_rcMesh);
-        PolyLine polyline;
+        PolyLine& polyline = polylines[index];
         for (auto it : hitPointPairs) {
             points.clear();
             if (meshProjection.projectLineOnMesh(
@@ -823,10 +985,9 @@ void MeshProjection::projectParallelToMesh(
                 polyline.points.insert(polyline.points.end(), points.begin(), points.end());
             }
         }
-        rPolyLines.push_back(polyline);
+    });
 
-        seq.next();
-    }
+    rPolyLines.insert(rPolyLines.end(), polylines.begin(), polylines.end());
 }
 
 void MeshProjection::projectParallelToMesh(
@@ -840,10 +1001,10 @@ void MeshProjection::projectParallelToMesh(
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
 
-    Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
-
-    for (const auto& it : aEdges) {
-        std::vector<Base::Vector3f> points = it.points;
+    // the polylines are projected in parallel and share the grid
+    std::vector<PolyLine> polylines(aEdges.size());
+    OSD_Parallel::For(0, int(aEdges.size()), [&](int index) {
+        std::vector<Base::Vector3f> points = aEdges[index].points;
 
         using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
         std::vector<HitPoint> hitPoints;
@@ -864,7 +1025,7 @@ void MeshProjection::projectParallelToMesh(
         }
 
         MeshCore::MeshProjection meshProjection(_rcMesh);
-        PolyLine polyline;
+        PolyLine& polyline = polylines[index];
         for (auto it : hitPointPairs) {
             points.clear();
             if (meshProjection.projectLineOnMesh(
@@ -879,10 +1040,9 @@ void MeshProjection::projectParallelToMesh(
                 polyline.points.insert(polyline.points.end(), points.begin(), points.end());
             }
         }
-        rPolyLines.push_back(polyline);
+    });
 
-        seq.next();
-    }
+    rPolyLines.insert(rPolyLines.end(), polylines.begin(), polylines.end());
 }
 
 void MeshProjection::projectEdgeToEdge(
@@ -931,12 +1091,10 @@ void MeshProjection::projectEdgeToEdge(
     MeshPointIterator cPI(_rcMesh);
     MeshFacetIterator cFI(_rcMesh);
 
-    Base::SequencerLauncher seq("Project curve on mesh", pEdgeToFace.size());
+    // no progress or log output here because the edges are projected in parallel
     std::map<std::pair<MeshCore::PointIndex, MeshCore::PointIndex>, std::list<MeshCore::FacetIndex>>::iterator
         it;
     for (it = pEdgeToFace.begin(); it != pEdgeToFace.end(); ++it) {
-        seq.next();
-
         // edge points
         MeshCore::PointIndex uE0 = it->first.first;
         cPI.Set(uE0);
@@ -1015,7 +1173,7 @@ void MeshProjection::projectEdgeToEdge(
                     }
                 }
 
-                // ok, only one sensible solution
+                // ok, only one sensible solution, ambiguous ones are skipped
                 if (nCntSol == 1) {
                     SplitEdge splitEdge;
                     splitEdge.uE0 = uE0;
@@ -1023,9 +1181,6 @@ void MeshProjection::projectEdgeToEdge(
                     splitEdge.cPt = cSplitPoint;
                     rParamSplitEdges[fSol] = splitEdge;
                 }
-                else if (nCntSol > 1) {
-                    Base::Console().log("More than one possible intersection points\n");
-                }
             }
         }
     }
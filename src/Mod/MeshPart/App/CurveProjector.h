@@ -25,6 +25,7 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 
 #include <TopoDS_Edge.hxx>
 
@@ -52,7 +53,7 @@ class MeshPartExport CurveProjector
 {
 public:
     CurveProjector(const TopoDS_Shape& aShape, const MeshKernel& pMesh);
-    virtual ~CurveProjector() = default;
+    virtual ~CurveProjector();
 
     struct FaceSplitEdge
     {
@@ -87,9 +88,32 @@ public:
 
 protected:
     virtual void Do() = 0;
+    /// Returns all edges of the shape, the edges are projected in parallel
+    std::vector<TopoDS_Edge> getEdges() const;
+    /** Projects the point \a pnt along the normal of the facets onto the mesh and returns the
+     * nearest of these projections, like a check of all facets does. The search starts at the
+     * facet \a facet and walks over the neighbours towards the point, so that for the points of a
+     * sampled curve only the facets within the distance of the found facet need to be checked.
+     */
+    bool projectPoint(
+        const Base::Vector3f& pnt,
+        MeshCore::FacetIndex& facet,
+        Base::Vector3f& result
+    ) const;
+    /// Returns the nearest projection along the facet normals, searching from \a radius outwards
+    bool findNearestFacet(
+        const Base::Vector3f& pnt,
+        float radius,
+        MeshCore::FacetIndex& facet,
+        Base::Vector3f& result
+    ) const;
+
     const TopoDS_Shape& _Shape;
     const MeshKernel& _Mesh;
     result_type mvEdgeSplitPoints;
+    /// The facet grid is shared by the projection of all edges
+    std::unique_ptr<MeshCore::MeshFacetGrid> _Grid;
+    float _SearchRadius {0.0F};
 };
 
 
@@ -102,13 +126,18 @@ public:
     ~CurveProjectorShape() override = default;
 
     void projectCurve(const TopoDS_Edge& aEdge, std::vector<FaceSplitEdge>& vSplitEdges);
+    void projectCurve(
+        const TopoDS_Edge& aEdge,
+        std::vector<FaceSplitEdge>& vSplitEdges,
+        std::vector<std::string>& messages
+    ) const;
 
     bool findStartPoint(
         const MeshKernel& MeshK,
         const Base::Vector3f& Pnt,
         Base::Vector3f& Rslt,
         MeshCore::FacetIndex& FaceIndex
-    );
+    ) const;
 
 
 protected:
@@ -129,21 +158,29 @@ public:
         const TopoDS_Edge& aEdge,
         std::vector<Base::Vector3f>& rclPoints,
         unsigned long ulNbOfPoints = 30
-    );
+    ) const;
 
 
+    /** Projects the points \a rclPoints of the edge onto the mesh. If no points are given the
+     * edge is sampled with 1000 points. Each point is projected along the normal of the facets
+     * onto the nearest facet, as findStartPoint() does, and each pair of consecutive projected
+     * points is added as a split edge with the facet of the second point. Points without a
+     * projection interrupt the polyline.
+     * @note Before the projection was done in parallel, this only wrote all projections of the
+     * sampled points to the file "projected.asc" and returned no split edges.
+     */
     void projectCurve(
         const TopoDS_Edge& aEdge,
         const std::vector<Base::Vector3f>& rclPoints,
         std::vector<FaceSplitEdge>& vSplitEdges
-    );
+    ) const;
 
     bool findStartPoint(
         const MeshKernel& MeshK,
         const Base::Vector3f& Pnt,
         Base::Vector3f& Rslt,
         MeshCore::FacetIndex& FaceIndex
-    );
+    ) const;
 
 
 protected:
@@ -165,7 +202,7 @@ public:
     ~CurveProjectorWithToolMesh() override = default;
 
 
-    void makeToolMesh(const TopoDS_Edge& aEdge, std::vector<MeshGeomFacet>& cVAry);
+    void makeToolMesh(const TopoDS_Edge& aEdge, std::vector<MeshGeomFacet>& cVAry) const;
 
 
     MeshKernel& ToolMesh;
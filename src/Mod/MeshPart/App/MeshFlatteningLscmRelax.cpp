@@ -30,8 +30,7 @@
 #include <set>
 #include <vector>
 
-
-#include <Eigen/SparseCholesky>
+#include <OSD_Parallel.hxx>
 
 #include "MeshFlatteningLscmRelax.h"
 
@@ -145,24 +144,31 @@ LscmRelax::LscmRelax(
 void LscmRelax::relax(double weight)
 {
     ColMat<double, 3> d_q_l_g = this->q_l_m - this->q_l_g;
-    // for every triangle
-    Eigen::Matrix<double, 3, 6> B;
-    Eigen::Matrix<double, 2, 2> T;
-    Eigen::Matrix<double, 6, 6> K_m;
-    Eigen::Matrix<double, 6, 1> u_m, rhs_m;
-    Eigen::VectorXd rhs(this->vertices.cols() * 2 + 3);
+    long n_vertices = this->vertices.cols();
+    long n_triangles = this->triangles.cols();
+    Eigen::VectorXd rhs(n_vertices * 2 + 3);
     if (this->sol.size() == 0)
-        this->sol.Zero(this->vertices.cols() * 2 + 3);
-    spMat K_g(this->vertices.cols() * 2 + 3, this->vertices.cols() * 2 + 3);
-    std::vector<trip> K_g_triplets;
-    Vector2 v1, v2, v3, v12, v23, v31;
-    long row_pos, col_pos;
-    double A;
+        this->sol.Zero(n_vertices * 2 + 3);
+    spMat K_g(n_vertices * 2 + 3, n_vertices * 2 + 3);
+    // every triangle writes its 36 matrix entries and its 6 forces to its own slots,
+    // so the elements can be computed in parallel. The lagrange multipliers need
+    // another 8 entries per vertex.
+    std::vector<trip> K_g_triplets(n_triangles * 36 + n_vertices * 8);
+    ColMat<double, 6> rhs_elements(n_triangles, 6);
 
     rhs.setZero();
 
-    for (long i=0; i<this->triangles.cols(); i++)
+    // for every triangle
+    OSD_Parallel::For(0, static_cast<int>(n_triangles), [&](int i)
     {
+        Eigen::Matrix<double, 3, 6> B;
+        Eigen::Matrix<double, 2, 2> T;
+        Eigen::Matrix<double, 6, 6> K_m;
+        Eigen::Matrix<double, 6, 1> u_m, rhs_m;
+        Vector2 v1, v2, v3, v12, v23, v31;
+        long row_pos, col_pos;
+        double A;
+
         // 1: construct B-mat in m-system
         v1 = this->flat_vertices.col(this->triangles(0, i));
         v2 = this->flat_vertices.col(this->triangles(1, i));
@@ -187,22 +193,33 @@ void LscmRelax::relax(double weight)
         rhs_m = B.transpose() * this->C * B * u_m * A;
         K_m = B.transpose() * this->C * B * A;
 
-        // 5: add to rhs_g, K_g
+        // 4: store the element contributions
+        rhs_elements.row(i) = rhs_m.transpose();
+        trip* slot = &K_g_triplets[i * 36];
         for (int j=0; j < 3; j++)
         {
             row_pos = this->triangles(j, i);
-            rhs[row_pos * 2]     += rhs_m[j * 2];
-            rhs[row_pos * 2 + 1] += rhs_m[j * 2 +1];
             for (int k=0; k < 3; k++)
             {
                 col_pos = this->triangles(k, i);
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1)));
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1)));
+                *slot++ = trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2));
+                *slot++ = trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2));
+                *slot++ = trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1));
+                *slot++ = trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1));
                 // we don't have to fill all because the matrix is symmetric.
             }
         }
+    });
+
+    // 5: add to rhs_g (serial because the vertices are shared by the triangles)
+    for (long i=0; i < n_triangles; i++)
+    {
+        for (int j=0; j < 3; j++)
+        {
+            long row_pos = this->triangles(j, i);
+            rhs[row_pos * 2]     += rhs_elements(i, j * 2);
+            rhs[row_pos * 2 + 1] += rhs_elements(i, j * 2 + 1);
+        }
     }
     // FIXING SOME PINS:
     // - if there are no pins (or only one pin) selected solve the system without the nullspace solution.
@@ -248,20 +265,22 @@ void LscmRelax::relax(double weight)
     //     K_g_triplets.push_back(trip(i, i, 0.01));
 
     // lagrange multiplier
-    for (long i=0; i < this->flat_vertices.cols() ; i++)
+    OSD_Parallel::For(0, static_cast<int>(n_vertices), [&](int i)
     {
+        long n = n_vertices * 2;
+        trip* slot = &K_g_triplets[n_triangles * 36 + i * 8];
         // fixing total ux
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2, i * 2, 1));
+        *slot++ = trip(i * 2, n, 1);
+        *slot++ = trip(n, i * 2, 1);
         // fixing total uy
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 1, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 1, i * 2 + 1, 1));
+        *slot++ = trip(i * 2 + 1, n + 1, 1);
+        *slot++ = trip(n + 1, i * 2 + 1, 1);
         // fixing ux*y-uy*x
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2 + 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 2, this->flat_vertices(0, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2 + 1, this->flat_vertices(0, i)));
-    }
+        *slot++ = trip(i * 2, n + 2, - this->flat_vertices(1, i));
+        *slot++ = trip(n + 2, i * 2, - this->flat_vertices(1, i));
+        *slot++ = trip(i * 2 + 1, n + 2, this->flat_vertices(0, i));
+        *slot++ = trip(n + 2, i * 2 + 1, this->flat_vertices(0, i));
+    });
 
     // project out the nullspace solution:
 
@@ -283,10 +302,16 @@ void LscmRelax::relax(double weight)
     // rhs +=  K_g * Eigen::VectorXd::Ones(K_g.rows());
 
     // solve linear system (privately store the value for guess in next step)
-    Eigen::SimplicialLDLT<spMat, Eigen::Lower> solver;
-    solver.compute(K_g);
-    this->sol = solver.solve(-rhs);
-    this->set_shift(this->sol.head(this->vertices.cols() * 2) * weight);
+    // the triplets always have the same positions and explicit zeros are kept by
+    // setFromTriplets, so the pattern of K_g is the same for every relax step
+    if (!this->relax_pattern_analyzed)
+    {
+        this->relax_solver.analyzePattern(K_g);
+        this->relax_pattern_analyzed = true;
+    }
+    this->relax_solver.factorize(K_g);
+    this->sol = this->relax_solver.solve(-rhs);
+    this->set_shift(this->sol.head(n_vertices * 2) * weight);
     this->set_q_l_m();
 }
 
@@ -422,35 +447,35 @@ void LscmRelax::edge_relax(double weight)
 void LscmRelax::lscm()
 {
     this->set_q_l_g();
-    std::vector<trip> triple_list;
-    long i;
-    double x21, x31, y31, x32;
+    // every triangle owns 10 slots of the triplet list
+    std::vector<trip> triple_list(this->triangles.cols() * 10);
 
     // 1. create the triplet list (t * 2, v * 2)
-    for(i=0; i<this->triangles.cols(); i++)
+    OSD_Parallel::For(0, static_cast<int>(this->triangles.cols()), [&](int i)
     {
-        x21 = this->q_l_g(i, 0);
-        x31 = this->q_l_g(i, 1);
-        y31 = this->q_l_g(i, 2);
-        x32 = x31 - x21;
-
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21));
-
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21));
-
-    }
+        double x21 = this->q_l_g(i, 0);
+        double x31 = this->q_l_g(i, 1);
+        double y31 = this->q_l_g(i, 2);
+        double x32 = x31 - x21;
+        trip* slot = &triple_list[i * 10];
+
+        *slot++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32);
+        *slot++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31);
+        *slot++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31);
+        *slot++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31);
+        *slot++ = trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21);
+
+        *slot++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31);
+        *slot++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32);
+        *slot++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31);
+        *slot++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31);
+        *slot++ = trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21);
+    });
     // 2. divide the triplets in matrix(unknown part) and rhs(known part) and reset the position
     std::vector<trip> rhs_triplets;
     std::vector<trip> mat_triplets;
-    for (auto triplet: triple_list)
+    mat_triplets.reserve(triple_list.size());
+    for (const auto& triplet: triple_list)
     {
         if (triplet.col() > static_cast<int>((this->vertices.cols() - this->fixed_pins.size()) * 2 - 1))
             rhs_triplets.push_back(triplet);
@@ -479,10 +504,7 @@ void LscmRelax::lscm()
 
     // 6. solve the system and set the flatted coordinates
     // Eigen::SparseQR<spMat, Eigen::COLAMDOrdering<int> > solver;
-    Eigen::LeastSquaresConjugateGradient<spMat > solver;
-    Eigen::VectorXd sol(this->vertices.size() * 2);
-    solver.compute(A);
-    sol = solver.solve(-rhs);
+    Eigen::VectorXd sol = solve_least_squares(A, -rhs);
 
     // TODO: create function, is needed also in the fem step
     this->set_position(sol);
@@ -493,13 +515,43 @@ void LscmRelax::lscm()
 
 }
 
+Eigen::VectorXd LscmRelax::solve_least_squares(const spMat& A, const Eigen::VectorXd& b)
+{
+    // the least squares problem is solved with the normal equations. With at least two
+    // pins A^T.A is positive definite and a sparse cholesky factorization is much faster
+    // than the iterative LeastSquaresConjugateGradient for large meshes.
+    spMat AtA = A.transpose() * A;
+    Eigen::VectorXd Atb = A.transpose() * b;
+    Eigen::SimplicialLDLT<spMat> solver;
+    solver.compute(AtA);
+    if (solver.info() == Eigen::Success)
+    {
+        // a near-singular A^T.A can still be factorized, but the solution is then dominated
+        // by rounding errors. Such systems are solved iteratively like before.
+        Eigen::VectorXd pivots = solver.vectorD().cwiseAbs();
+        bool well_conditioned = pivots.size() == 0 ||
+            pivots.minCoeff() > min_pivot_ratio * pivots.maxCoeff();
+        if (well_conditioned)
+        {
+            Eigen::VectorXd sol = solver.solve(Atb);
+            double residual = (AtA * sol - Atb).norm();
+            if (sol.allFinite() && residual <= max_residual * Atb.norm())
+                return sol;
+        }
+    }
+
+    Eigen::LeastSquaresConjugateGradient<spMat > lsq_solver;
+    lsq_solver.compute(A);
+    return lsq_solver.solve(b);
+}
+
 void LscmRelax::set_q_l_g()
 {
     // get the coordinates of a triangle in local coordinates from the 3d mesh
     // x1, y1, y2 = 0
     // -> vector<x2, x3, y3>
     this->q_l_g.resize(this->triangles.cols(), 3);
-    for (long i = 0; i < this->triangles.cols(); i++)
+    OSD_Parallel::For(0, static_cast<int>(this->triangles.cols()), [&](int i)
     {
         Vector3 r1 = this->vertices.col(this->triangles(0, i));
         Vector3 r2 = this->vertices.col(this->triangles(1, i));
@@ -510,7 +562,7 @@ void LscmRelax::set_q_l_g()
         r21.normalize();
         // if triangle is flipped this gives wrong results?
         this->q_l_g.row(i) << r21_norm, r31.dot(r21), r31.cross(r21).norm();
-    }
+    });
 }
 
 void LscmRelax::set_q_l_m()
@@ -519,7 +571,7 @@ void LscmRelax::set_q_l_m()
     // x1, y1, y2 = 0
     // -> vector<x2, x3, y3>
     this->q_l_m.resize(this->triangles.cols(), 3);
-    for (long i = 0; i < this->triangles.cols(); i++)
+    OSD_Parallel::For(0, static_cast<int>(this->triangles.cols()), [&](int i)
     {
         Vector2 r1 = this->flat_vertices.col(this->triangles(0, i));
         Vector2 r2 = this->flat_vertices.col(this->triangles(1, i));
@@ -530,7 +582,7 @@ void LscmRelax::set_q_l_m()
         r21.normalize();
         // if triangle is flipped this gives wrong results!
         this->q_l_m.row(i) << r21_norm, r31.dot(r21), -(r31.x() * r21.y() - r31.y() * r21.x());
-    }
+    });
 }
 
 void LscmRelax::set_fixed_pins()
@@ -41,6 +41,8 @@
 #include <tuple>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+
 #include "MeshFlattening.h"
 
 
@@ -87,6 +89,11 @@ private:
     Eigen::Matrix<double, 3, 3> C;
     Eigen::VectorXd sol;
 
+    // the sparsity pattern of the fem-system doesn't change between the relax steps,
+    // so the symbolic factorization is only computed once and reused
+    Eigen::SimplicialLDLT<spMat, Eigen::Lower> relax_solver;
+    bool relax_pattern_analyzed = false;
+
     std::vector<long> get_fem_fixed_pins();
     Eigen::MatrixXd get_nullspace();
 
@@ -109,6 +116,14 @@ public:
 
     void lscm();
     void relax(double);
+
+    // solves min |A.x - b| with the normal equations and falls back to the
+    // iterative LeastSquaresConjugateGradient if they are (nearly) singular
+    static Eigen::VectorXd solve_least_squares(const spMat& A, const Eigen::VectorXd& b);
+    // the smallest pivot of the factorization relative to the largest one
+    static constexpr double min_pivot_ratio = 1e-12;
+    // the residual of the normal equations relative to A^T.b
+    static constexpr double max_residual = 1e-8;
     void area_relax(double);
     void edge_relax(double);
 
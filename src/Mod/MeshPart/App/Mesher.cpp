@@ -23,16 +23,29 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
 #include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -214,6 +227,241 @@ public:
         return meshdata;
     }
 };
+
+/* The FaceMeshCache remembers the triangulations that the standard mesher created for the faces
+ * of a shape and the domains taken from them. The entries are keyed by a hash of the face's
+ * geometry and the mesher parameters, so the cache doesn't keep the shapes alive.
+ * When a face is meshed again with the same parameters and still has the cached triangulation
+ * it is neither cleaned nor meshed again and its domain is reused. So after a small modification
+ * of a shape only the faces that have changed are meshed again.
+ * There is one cache per document, it's released when the document is closed.
+ */
+class FaceMeshCache
+{
+public:
+    struct Parameters
+    {
+        double deflection {0};
+        double angularDeflection {0};
+        bool relative {false};
+
+        bool operator==(const Parameters&) const = default;
+    };
+
+    /// Returns the cache of the document or null if there is no document
+    static std::shared_ptr<FaceMeshCache> forDocument(const App::Document* doc)
+    {
+        using CacheMap = std::map<const App::Document*, std::shared_ptr<FaceMeshCache>>;
+        static std::mutex cachesMutex;
+        static CacheMap caches;
+        static fastsignals::connection connectDeleteDocument =
+            App::GetApplication().signalDeleteDocument.connect([](const App::Document& doc) {
+                std::lock_guard<std::mutex> lock(cachesMutex);
+                caches.erase(&doc);
+            });
+
+        if (!doc) {
+            return {};
+        }
+
+        std::lock_guard<std::mutex> lock(cachesMutex);
+        auto& cache = caches[doc];
+        if (!cache) {
+            cache = std::make_shared<FaceMeshCache>();
+        }
+        return cache;
+    }
+
+    /// Removes the triangulation of all faces that must be meshed again
+    void clean(const std::vector<TopoDS_Face>& faces, const Parameters& params)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& face : faces) {
+            auto it = entries.find(Key {geometryHash(face), params});
+            if (it == entries.end() || !isValid(it->second, face)) {
+                BRepTools::Clean(face);
+            }
+        }
+    }
+
+    /// Returns the domains of the meshed faces and takes the new ones into the cache.
+    /// \a numMissed is set to the number of faces that weren't taken from the cache.
+    std::vector<Part::TopoShape::Domain> getDomains(
+        const std::vector<TopoDS_Face>& faces,
+        const Parameters& params,
+        std::size_t& numMissed
+    )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+
+        std::vector<Key> keys(faces.size());
+        OSD_Parallel::For(0, int(faces.size()), [&](int index) {
+            keys[index] = Key {geometryHash(faces[index]), params};
+        });
+
+        std::vector<Part::TopoShape::Domain> domains(faces.size());
+        std::vector<bool> cached(faces.size(), false);
+        for (std::size_t index = 0; index < faces.size(); index++) {
+            auto it = entries.find(keys[index]);
+            if (it != entries.end() && isValid(it->second, faces[index])) {
+                it->second.generation = generation;
+                domains[index] = it->second.domain;
+                cached[index] = true;
+            }
+        }
+
+        numMissed = std::count(cached.begin(), cached.end(), false);
+        OSD_Parallel::For(0, int(faces.size()), [&](int index) {
+            if (!cached[index]) {
+                domains[index] = createDomain(faces[index]);
+            }
+        });
+
+        for (std::size_t index = 0; index < faces.size(); index++) {
+            if (!cached[index]) {
+                store(faces[index], keys[index], domains[index]);
+            }
+        }
+        evict();
+
+        return domains;
+    }
+
+    static Part::TopoShape::Domain createDomain(const TopoDS_Face& face)
+    {
+        Part::TopoShape::Domain domain;
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (Part::Tools::getTriangulation(face, points, facets)) {
+            domain.points.reserve(points.size());
+            for (const auto& it : points) {
+                domain.points.emplace_back(it.X(), it.Y(), it.Z());
+            }
+
+            domain.facets.reserve(facets.size());
+            for (const auto& it : facets) {
+                Standard_Integer N1, N2, N3;
+                it.Get(N1, N2, N3);
+
+                Part::TopoShape::Facet tria;
+                tria.I1 = N1;
+                tria.I2 = N2;
+                tria.I3 = N3;
+                domain.facets.push_back(tria);
+            }
+        }
+
+        return domain;
+    }
+
+private:
+    struct Key
+    {
+        std::size_t geometry {0};
+        Parameters params;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHasher
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = key.geometry;
+            Base::hash_combine(seed, key.params.deflection);
+            Base::hash_combine(seed, key.params.angularDeflection);
+            Base::hash_combine(seed, key.params.relative);
+            return seed;
+        }
+    };
+
+    struct Entry
+    {
+        Handle(Poly_Triangulation) triangulation;
+        Part::TopoShape::Domain domain;
+        std::size_t generation {0};
+    };
+
+    // The hash of the surface type, the parameter range, the vertices and the orientation of the
+    // face. Faces with the same hash but a different geometry can't share an entry because the
+    // face must still carry the cached triangulation.
+    static std::size_t geometryHash(const TopoDS_Face& face)
+    {
+        std::size_t seed = 0;
+        BRepAdaptor_Surface surface(face, Standard_False);
+        Base::hash_combine(seed, int(surface.GetType()));
+        Base::hash_combine(seed, int(face.Orientation()));
+
+        Standard_Real u1 {}, u2 {}, v1 {}, v2 {};
+        BRepTools::UVBounds(face, u1, u2, v1, v2);
+        for (Standard_Real value : {u1, u2, v1, v2}) {
+            Base::hash_combine(seed, value);
+        }
+
+        for (TopExp_Explorer xp(face, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(xp.Current()));
+            Base::hash_combine(seed, pnt.X());
+            Base::hash_combine(seed, pnt.Y());
+            Base::hash_combine(seed, pnt.Z());
+        }
+
+        return seed;
+    }
+
+    static bool isValid(const Entry& entry, const TopoDS_Face& face)
+    {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, loc);
+        return !triangulation.IsNull() && triangulation == entry.triangulation;
+    }
+
+    void store(const TopoDS_Face& face, const Key& key, const Part::TopoShape::Domain& domain)
+    {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, loc);
+        if (triangulation.IsNull()) {
+            return;
+        }
+
+        Entry& entry = entries[key];
+        numFacets -= entry.domain.facets.size();
+        entry.triangulation = triangulation;
+        entry.domain = domain;
+        entry.generation = generation;
+        numFacets += entry.domain.facets.size();
+    }
+
+    // Drops the faces of former shapes first and everything if the last shape alone is too big
+    void evict()
+    {
+        if (numFacets <= maxFacets) {
+            return;
+        }
+
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->second.generation != generation) {
+                numFacets -= it->second.domain.facets.size();
+                it = entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        if (numFacets > maxFacets) {
+            entries.clear();
+            numFacets = 0;
+        }
+    }
+
+private:
+    static constexpr std::size_t maxFacets = 2000000;
+    std::unordered_map<Key, Entry, KeyHasher> entries;
+    std::size_t numFacets {0};
+    std::size_t generation {0};
+    std::mutex mutex;
+};
 }  // namespace MeshPart
 
 // ----------------------------------------------------------------------------
@@ -226,13 +474,42 @@ Mesher::~Mesher() = default;
 
 Mesh::MeshObject* Mesher::createStandard() const
 {
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+
+    FaceMeshCache::Parameters params {deflection, angularDeflection, relative};
+    auto cache = FaceMeshCache::forDocument(App::GetApplication().getActiveDocument());
     if (!shape.IsNull()) {
-        BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        // Only clean the faces without a valid triangulation. The mesher keeps the triangulation
+        // of the others and meshes the rest of the faces in parallel.
+        if (cache) {
+            cache->clean(faces, params);
+        }
+        else {
+            BRepTools::Clean(shape);
+        }
+        BRepMesh_IncrementalMesh aMesh(
+            shape,
+            deflection,
+            relative,
+            angularDeflection,
+            /*isInParallel*/ true
+        );
     }
 
     std::vector<Part::TopoShape::Domain> domains;
-    Part::TopoShape(shape).getDomains(domains);
+    if (cache) {
+        domains = cache->getDomains(faces, params, numMeshedFaces);
+    }
+    else {
+        numMeshedFaces = faces.size();
+        domains.resize(faces.size());
+        OSD_Parallel::For(0, int(faces.size()), [&](int index) {
+            domains[index] = FaceMeshCache::createDomain(faces[index]);
+        });
+    }
 
     BrepMesh brepmesh(this->segments, this->colors);
     return brepmesh.create(domains);
@@ -440,7 +717,8 @@ Mesh::MeshObject* Mesher::createFrom(SMESH_Mesh* mesh) const
     faces.reserve(mesh->NbFaces());
 
     int index = 0;
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    std::unordered_map<const SMDS_MeshNode*, int> mapNodeIndex;
+    mapNodeIndex.reserve(mesh->NbNodes());
     for (; aNodeIter->more();) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
         MeshCore::MeshPoint p;
@@ -213,6 +213,12 @@ public:
 #endif
 
     Mesh::MeshObject* createMesh() const;
+    /// The number of faces the standard mesher didn't take from the cache of the active document
+    /// in the last call of createMesh()
+    std::size_t getNumMeshedFaces() const
+    {
+        return numMeshedFaces;
+    }
 
 private:
     Mesh::MeshObject* createStandard() const;
@@ -240,6 +246,7 @@ private:
     bool allowquad {false};
 #endif
     std::vector<uint32_t> colors;
+    mutable std::size_t numMeshedFaces {0};
 
     static SMESH_Gen* _mesh_gen;
 };
@@ -97,6 +97,7 @@
 #include "PartFeature.h"
 #include "PartPyCXX.h"
 #include "PyException.h"
+#include "ShapeOpCache.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapePy.h"
@@ -771,6 +772,29 @@ public:
             &Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method(
+            "getOpCacheStats",
+            &Module::getOpCacheStats,
+            "getOpCacheStats() -> dict\n"
+            "Return the statistics of the shape operation result cache: enabled, hits, misses,\n"
+            "insertions, evictions, entries, memory and memoryLimit (both in bytes)"
+        );
+        add_varargs_method(
+            "clearOpCache",
+            &Module::clearOpCache,
+            "clearOpCache() -- Clears the shape operation result cache and its statistics"
+        );
+        add_varargs_method(
+            "setOpCacheEnabled",
+            &Module::setOpCacheEnabled,
+            "setOpCacheEnabled(enable) -- Enable or disable the shape operation result cache.\n"
+            "Disabling the cache releases all cached results"
+        );
+        add_varargs_method(
+            "setOpCacheLimit",
+            &Module::setOpCacheLimit,
+            "setOpCacheLimit(megabytes) -- Set the memory limit of the shape operation result cache"
+        );
         add_keyword_method(
             "getShape",
             &Module::getShape,
@@ -2714,6 +2738,53 @@ private:
         return Py::Object();
     }
 
+    Py::Object getOpCacheStats(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+        auto stats = ShapeOpCache::instance().getStatistics();
+        Py::Dict dict;
+        dict.setItem("enabled", Py::Boolean(stats.enabled));
+        dict.setItem("hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+        dict.setItem("misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+        dict.setItem("insertions", Py::Long(static_cast<unsigned long>(stats.insertions)));
+        dict.setItem("evictions", Py::Long(static_cast<unsigned long>(stats.evictions)));
+        dict.setItem("entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+        dict.setItem("memory", Py::Long(static_cast<unsigned long>(stats.memory)));
+        dict.setItem("memoryLimit", Py::Long(static_cast<unsigned long>(stats.memoryLimit)));
+        return dict;
+    }
+
+    Py::Object clearOpCache(const Py::Tuple& args)
+    {
+        if (!PyArg_ParseTuple(args.ptr(), "")) {
+            throw Py::Exception();
+        }
+        ShapeOpCache::instance().clear();
+        return Py::Object();
+    }
+
+    Py::Object setOpCacheEnabled(const Py::Tuple& args)
+    {
+        PyObject* enable;
+        if (!PyArg_ParseTuple(args.ptr(), "O!", &PyBool_Type, &enable)) {
+            throw Py::Exception();
+        }
+        ShapeOpCache::instance().setEnabled(Base::asBoolean(enable));
+        return Py::Object();
+    }
+
+    Py::Object setOpCacheLimit(const Py::Tuple& args)
+    {
+        unsigned long megabytes;
+        if (!PyArg_ParseTuple(args.ptr(), "k", &megabytes)) {
+            throw Py::Exception();
+        }
+        ShapeOpCache::instance().setMemoryLimit(static_cast<std::size_t>(megabytes) * 1024 * 1024);
+        return Py::Object();
+    }
+
     Py::Object splitSubname(const Py::Tuple& args)
     {
         const char* subname;
@@ -23,6 +23,8 @@
 
 
 #include <algorithm>
+#include <set>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 
 
@@ -69,13 +71,18 @@ class MergeVertex
 public:
     using Facet = BRepMesh::Facet;
 
-    MergeVertex(std::vector<Base::Vector3d> points, std::vector<Facet> faces, double tolerance)
+    MergeVertex(
+        std::vector<Base::Vector3d> points,
+        std::vector<Facet> faces,
+        double tolerance,
+        const std::vector<std::size_t>& candidates
+    )
         : points {std::move(points)}
         , faces {std::move(faces)}
         , tolerance {tolerance}
     {
         setDefaultMap();
-        check();
+        check(candidates);
     }
 
     bool hasDuplicatedPoints() const
@@ -120,7 +127,8 @@ private:
         duplicatedPoints = 0;
     }
 
-    void check()
+    // Only the points with the given indices are checked for duplicates
+    void check(const std::vector<std::size_t>& candidates)
     {
         using VertexIterator = std::vector<Base::Vector3d>::const_iterator;
 
@@ -148,9 +156,9 @@ private:
         };
 
         std::vector<VertexIterator> vertices;
-        vertices.reserve(points.size());
-        for (auto it = points.cbegin(); it != points.cend(); ++it) {
-            vertices.push_back(it);
+        vertices.reserve(candidates.size());
+        for (std::size_t index : candidates) {
+            vertices.push_back(points.cbegin() + std::ptrdiff_t(index));
         }
 
         std::sort(vertices.begin(), vertices.end(), vertexLess);
@@ -236,6 +244,48 @@ private:
     std::vector<std::size_t> mapPointIndex;
 };
 
+enum class NodeType : uint8_t
+{
+    Unused,
+    Interior,
+    Boundary
+};
+
+// A node is on the boundary of a domain if it's the end point of an edge with only one facet.
+// Only these nodes can be shared with other domains.
+std::vector<NodeType> classifyNodes(const BRepMesh::Domain& domain)
+{
+    std::vector<NodeType> types(domain.points.size(), NodeType::Unused);
+    std::vector<uint64_t> edges;
+    edges.reserve(3 * domain.facets.size());
+    auto addEdge = [&edges](uint32_t p, uint32_t q) {
+        edges.push_back((uint64_t(std::min(p, q)) << 32) | std::max(p, q));
+    };
+
+    for (const auto& facet : domain.facets) {
+        types[facet.I1] = NodeType::Interior;
+        types[facet.I2] = NodeType::Interior;
+        types[facet.I3] = NodeType::Interior;
+        addEdge(facet.I1, facet.I2);
+        addEdge(facet.I2, facet.I3);
+        addEdge(facet.I3, facet.I1);
+    }
+
+    std::sort(edges.begin(), edges.end());
+    for (auto it = edges.begin(); it != edges.end();) {
+        auto next = std::find_if(it, edges.end(), [key = *it](uint64_t edge) {
+            return edge != key;
+        });
+        if (std::distance(it, next) == 1) {
+            types[*it >> 32] = NodeType::Boundary;
+            types[*it & 0xffffffff] = NodeType::Boundary;
+        }
+        it = next;
+    }
+
+    return types;
+}
+
 }  // namespace
 
 void BRepMesh::getFacesFromDomains(
@@ -244,52 +294,72 @@ void BRepMesh::getFacesFromDomains(
     std::vector<Facet>& faces
 )
 {
-    std::size_t numFaces = 0;
-    for (const auto& it : domains) {
-        numFaces += it.facets.size();
-    }
-    faces.reserve(numFaces);
-
+    const int numDomains = int(domains.size());
+    std::vector<std::vector<NodeType>> nodeTypes(domains.size());
+    OSD_Parallel::For(0, numDomains, [&](int index) {
+        nodeTypes[index] = classifyNodes(domains[index]);
+    });
+
+    // Interior nodes get their own points, only boundary nodes are welded with the nodes of
+    // other domains
+    std::vector<std::vector<uint32_t>> pointIndices(domains.size());
+    std::vector<Base::Vector3d> meshPoints;
+    std::vector<std::size_t> boundaryPoints;
     std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
-    };
+    for (std::size_t index = 0; index < domains.size(); index++) {
+        const auto& domain = domains[index];
+        const auto& types = nodeTypes[index];
+        auto& indices = pointIndices[index];
+        indices.resize(domain.points.size());
+        for (std::size_t node = 0; node < domain.points.size(); node++) {
+            if (types[node] == NodeType::Interior) {
+                indices[node] = uint32_t(meshPoints.size());
+                meshPoints.push_back(domain.points[node]);
+            }
+            else if (types[node] == NodeType::Boundary) {
+                MeshVertex vertex(domain.points[node]);
+                vertex.i = meshPoints.size();
+                auto it = vertices.insert(vertex);
+                if (it.second) {
+                    meshPoints.push_back(vertex.toPoint());
+                    boundaryPoints.push_back(vertex.i);
+                }
+                indices[node] = uint32_t(it.first->i);
+            }
+        }
+    }
 
-    for (const auto& domain : domains) {
-        std::size_t numDomainFaces = 0;
-        for (const Facet& df : domain.facets) {
+    std::vector<std::vector<Facet>> domainFaces(domains.size());
+    OSD_Parallel::For(0, numDomains, [&](int index) {
+        const auto& indices = pointIndices[index];
+        auto& meshFaces = domainFaces[index];
+        meshFaces.reserve(domains[index].facets.size());
+        for (const Facet& df : domains[index].facets) {
             Facet face;
-
-            // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
-
-            // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
-
-            // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
+            face.I1 = indices[df.I1];
+            face.I2 = indices[df.I2];
+            face.I3 = indices[df.I3];
 
             // make sure that we don't insert invalid facets
             if (face.I1 != face.I2 && face.I2 != face.I3 && face.I3 != face.I1) {
-                faces.push_back(face);
-                numDomainFaces++;
+                meshFaces.push_back(face);
             }
         }
+    });
 
-        domainSizes.push_back(numDomainFaces);
+    std::size_t numFaces = 0;
+    for (const auto& it : domainFaces) {
+        numFaces += it.size();
     }
-
-    std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto& vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
+    faces.reserve(numFaces);
+    for (const auto& it : domainFaces) {
+        faces.insert(faces.end(), it.begin(), it.end());
+        domainSizes.push_back(it.size());
     }
+
     points.swap(meshPoints);
 
-    MergeVertex merge(points, faces, Precision::Confusion());
+    MergeVertex merge(points, faces, Precision::Confusion(), boundaryPoints);
     if (merge.hasDuplicatedPoints()) {
         merge.mergeDuplicatedPoints();
         points = merge.getPoints();
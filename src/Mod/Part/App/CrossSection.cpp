@@ -23,7 +23,11 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
 #include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
@@ -31,7 +35,9 @@
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepPrimAPI_MakeHalfSpace.hxx>
 #include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
 #include <gp_Pln.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeAnalysis_FreeBounds.hxx>
 #include <ShapeFix_Wire.hxx>
@@ -45,12 +51,60 @@
 
 
 #include "CrossSection.h"
+#include "FuzzyHelper.h"
 #include "ShapeAnalysis_FreeBoundsFix.h"
+#include "SignalException.h"
 #include "TopoShapeOpCode.h"
 
 
 using namespace Part;
 
+namespace
+{
+
+// The range of plane distances for which the plane (a, b, c, -d) may touch the shape
+struct DistanceRange
+{
+    double min = -std::numeric_limits<double>::infinity();
+    double max = std::numeric_limits<double>::infinity();
+
+    bool contains(double d) const
+    {
+        return min <= d && d <= max;
+    }
+};
+
+DistanceRange distanceRange(const TopoDS_Shape& shape, double a, double b, double c)
+{
+    DistanceRange range;
+    Bnd_Box box;
+    BRepBndLib::Add(shape, box);
+    if (box.IsVoid() || box.IsOpen()) {
+        return range;
+    }
+
+    // Leave room for the tolerances and the fuzzy value of the boolean operations
+    double fuzzy = std::max(1.0, FuzzyHelper::getBooleanFuzzy());
+    box.Enlarge(fuzzy * Precision::Confusion() * (1.0 + std::sqrt(box.SquareExtent())));
+
+    double xMin {}, yMin {}, zMin {}, xMax {}, yMax {}, zMax {};
+    box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    range.min = std::numeric_limits<double>::infinity();
+    range.max = -std::numeric_limits<double>::infinity();
+    for (double x : {xMin, xMax}) {
+        for (double y : {yMin, yMax}) {
+            for (double z : {zMin, zMax}) {
+                double dist = a * x + b * y + c * z;
+                range.min = std::min(range.min, dist);
+                range.max = std::max(range.max, dist);
+            }
+        }
+    }
+    return range;
+}
+
+}  // namespace
+
 CrossSection::CrossSection(double a, double b, double c, const TopoDS_Shape& s)
     : a(a)
     , b(b)
@@ -60,21 +114,83 @@ CrossSection::CrossSection(double a, double b, double c, const TopoDS_Shape& s)
 
 std::list<TopoDS_Wire> CrossSection::slice(double d) const
 {
-    std::list<TopoDS_Wire> wires;
+    return slices(std::vector<double>(1, d)).front();
+}
+
+std::vector<std::list<TopoDS_Wire>> CrossSection::slices(const std::vector<double>& d) const
+{
+    struct SubShape
+    {
+        TopoDS_Shape shape;
+        bool solid;
+        DistanceRange range;
+    };
+
     // Fixes: 0001228: Cross section of Torus in Part Workbench fails or give wrong results
     // Fixes: 0001137: Incomplete slices when using Part.slice on a torus
+    std::vector<SubShape> subShapes;
     TopExp_Explorer xp;
     for (xp.Init(s, TopAbs_SOLID); xp.More(); xp.Next()) {
-        sliceSolid(d, xp.Current(), wires);
+        subShapes.push_back({xp.Current(), true, distanceRange(xp.Current(), a, b, c)});
     }
     for (xp.Init(s, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next()) {
-        sliceNonSolid(d, xp.Current(), wires);
+        subShapes.push_back({xp.Current(), false, distanceRange(xp.Current(), a, b, c)});
     }
     for (xp.Init(s, TopAbs_FACE, TopAbs_SHELL); xp.More(); xp.Next()) {
-        sliceNonSolid(d, xp.Current(), wires);
+        subShapes.push_back({xp.Current(), false, distanceRange(xp.Current(), a, b, c)});
     }
 
-    return removeDuplicates(wires);
+    // Equal distances are only computed once. This also makes sure that no two
+    // tasks work on the same face of the input shape when it lies on the plane.
+    std::vector<double> distances(d);
+    std::sort(distances.begin(), distances.end());
+    distances.erase(std::unique(distances.begin(), distances.end()), distances.end());
+
+    std::vector<std::list<TopoDS_Wire>> sections(distances.size());
+    std::vector<std::exception_ptr> failures(distances.size());
+    // Install the signal handlers once for the batch, rather than by each
+    // boolean operation in the worker threads
+    SignalException sig;
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(distances.size()),
+        [&](int index) {
+            try {
+                double dist = distances[index];
+                std::list<TopoDS_Wire> wires;
+                for (const auto& sub : subShapes) {
+                    if (!sub.range.contains(dist)) {
+                        continue;
+                    }
+                    if (sub.solid) {
+                        sliceSolid(dist, sub.shape, wires);
+                    }
+                    else {
+                        sliceNonSolid(dist, sub.shape, wires);
+                    }
+                }
+                sections[index] = removeDuplicates(wires);
+            }
+            catch (...) {
+                failures[index] = std::current_exception();
+            }
+        },
+        distances.size() < 2
+    );
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    std::vector<std::list<TopoDS_Wire>> result;
+    result.reserve(d.size());
+    for (double dist : d) {
+        auto it = std::lower_bound(distances.begin(), distances.end(), dist);
+        result.push_back(sections[it - distances.begin()]);
+    }
+    return result;
 }
 
 std::list<TopoDS_Wire> CrossSection::removeDuplicates(const std::list<TopoDS_Wire>& wires) const
@@ -267,6 +383,43 @@ void TopoCrossSection::slice(int idx, double d, std::vector<TopoShape>& wires) c
     }
 }
 
+void TopoCrossSection::slices(const std::vector<double>& d, std::vector<TopoShape>& wires) const
+{
+    // The element map of the result is not safe to build concurrently, so
+    // unlike CrossSection::slices() the planes are processed one by one.
+    bool solid = true;
+    auto subShapes = shape.getSubTopoShapes(TopAbs_SOLID);
+    if (subShapes.empty()) {
+        solid = false;
+        subShapes = shape.getSubTopoShapes(TopAbs_SHELL);
+        if (subShapes.empty()) {
+            subShapes = shape.getSubTopoShapes(TopAbs_FACE);
+        }
+    }
+
+    std::vector<DistanceRange> ranges;
+    ranges.reserve(subShapes.size());
+    for (const auto& s : subShapes) {
+        ranges.push_back(distanceRange(s.getShape(), a, b, c));
+    }
+
+    int idx = 0;
+    for (double dist : d) {
+        ++idx;
+        for (std::size_t i = 0; i < subShapes.size(); i++) {
+            if (!ranges[i].contains(dist)) {
+                continue;
+            }
+            if (solid) {
+                sliceSolid(idx, dist, subShapes[i], wires);
+            }
+            else {
+                sliceNonSolid(idx, dist, subShapes[i], wires);
+            }
+        }
+    }
+}
+
 TopoShape TopoCrossSection::slice(int idx, double d) const
 {
     std::vector<TopoShape> wires;
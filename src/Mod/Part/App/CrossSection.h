@@ -25,6 +25,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <Mod/Part/PartGlobal.h>
 #include "TopoShape.h"
@@ -41,6 +42,16 @@ class PartExport CrossSection
 public:
     CrossSection(double a, double b, double c, const TopoDS_Shape& s);
     std::list<TopoDS_Wire> slice(double d) const;
+    /** Slices the shape with a batch of parallel planes
+     *
+     * The sub-shapes and their extent along the plane normal are determined
+     * once for the whole batch, so that every plane only processes the
+     * sub-shapes it can intersect. The planes are computed in parallel.
+     *
+     * @param d: the distances of the planes
+     * @return one list of wires per distance, in the order of @a d
+     */
+    std::vector<std::list<TopoDS_Wire>> slices(const std::vector<double>& d) const;
 
 private:
     void sliceNonSolid(double d, const TopoDS_Shape&, std::list<TopoDS_Wire>& wires) const;
@@ -61,6 +72,13 @@ public:
     TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op = 0);
     void slice(int idx, double d, std::vector<TopoShape>& wires) const;
     TopoShape slice(int idx, double d) const;
+    /** Slices the shape with a batch of parallel planes
+     *
+     * Same as calling slice() for each distance with the indices starting
+     * at 1, but the sub-shapes and their extent along the plane normal are
+     * only determined once for the whole batch.
+     */
+    void slices(const std::vector<double>& d, std::vector<TopoShape>& wires) const;
 
 private:
     void sliceNonSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
@@ -47,6 +47,7 @@
 #include "FeatureExtrusion.h"
 #include "ExtrusionHelper.h"
 #include "Part2DObject.h"
+#include "ShapeOpCache.h"
 
 
 using namespace Part;
@@ -403,6 +404,16 @@ App::DocumentObjectExecReturn* Extrusion::execute()
 
     try {
         ExtrusionParameters params = computeFinalParameters();
+
+        // Looked up after computing the parameters, as that may update Dir
+        auto& opCache = ShapeOpCache::instance();
+        std::string cacheKey = opCache.makeKey(this);
+        std::vector<TopoShape> cached;
+        if (opCache.lookup(cacheKey, cached)) {
+            this->Shape.setValue(cached.front());
+            return App::DocumentObject::StdReturn;
+        }
+
         TopoShape result(0, getDocument()->getStringHasher());
 
         extrudeShape(
@@ -410,6 +421,7 @@ App::DocumentObjectExecReturn* Extrusion::execute()
             Feature::getTopoShape(link, ShapeOption::ResolveLink | ShapeOption::Transform),
             params
         );
+        opCache.store(cacheKey, {result});
         this->Shape.setValue(result);
         return App::DocumentObject::StdReturn;
     }
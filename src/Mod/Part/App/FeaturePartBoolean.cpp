@@ -24,7 +24,9 @@
 
 #include <FCConfig.h>
 
+#include <limits>
 #include <memory>
+#include <sstream>
 
 #include <Mod/Part/App/FCBRepAlgoAPI_BooleanOperation.h>
 #include <BRepCheck_Analyzer.hxx>
@@ -36,23 +38,32 @@
 #include <Base/ProgramVersion.h>
 
 #include "FeaturePartBoolean.h"
+#include "FuzzyHelper.h"
+#include "ShapeOpCache.h"
 #include "TopoShapeOpCode.h"
 #include "modelRefine.h"
 
 
 using namespace Part;
 
-namespace Part
+namespace
 {
-void throwIfInvalidIfCheckModel(const TopoDS_Shape& shape)
+bool getCheckModelParameter()
 {
     Base::Reference<ParameterGrp> hGrp = App::GetApplication()
                                              .GetUserParameter()
                                              .GetGroup("BaseApp")
                                              ->GetGroup("Preferences")
                                              ->GetGroup("Mod/Part/Boolean");
+    return hGrp->GetBool("CheckModel", true);
+}
+}  // namespace
 
-    if (hGrp->GetBool("CheckModel", true)) {
+namespace Part
+{
+void throwIfInvalidIfCheckModel(const TopoDS_Shape& shape)
+{
+    if (getCheckModelParameter()) {
         BRepCheck_Analyzer aChecker(shape);
         if (!aChecker.IsValid()) {
             throw Base::RuntimeError("Resulting shape is invalid");
@@ -147,6 +158,19 @@ App::DocumentObjectExecReturn* Boolean::execute()
             throw NullShapeException("Tool shape is null");
         }
 
+        // The fuzzy value and the model check are global settings, so they are part of the key
+        auto& opCache = ShapeOpCache::instance();
+        std::ostringstream context;
+        context.precision(std::numeric_limits<double>::max_digits10);
+        context << FuzzyHelper::getBooleanFuzzy() << ' ' << getCheckModelParameter();
+        std::string cacheKey = opCache.makeKey(this, context.str());
+        std::vector<TopoShape> cached;
+        if (opCache.lookup(cacheKey, cached)) {
+            this->Shape.setValue(cached.front());
+            copyMaterial(base);
+            return Part::Feature::execute();
+        }
+
         std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool(makeOperation(BaseShape, ToolShape));
         if (!mkBool->IsDone()) {
             std::stringstream error;
@@ -171,6 +195,7 @@ App::DocumentObjectExecReturn* Boolean::execute()
         if (this->Refine.getValue()) {
             res = res.makeElementRefine();
         }
+        opCache.store(cacheKey, {res});
         this->Shape.setValue(res);
         copyMaterial(base);
         return Part::Feature::execute();
@@ -100,6 +100,7 @@
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 #include <LProp_NotDefined.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeConstruct_Curve.hxx>
 #include <Standard_ConstructionError.hxx>
@@ -120,10 +121,12 @@
 #include <boost/random.hpp>
 #include <cmath>
 #include <ctime>
+#include <exception>
 #include <fstream>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 // FreeType Headers
@@ -900,6 +903,50 @@ bool GeomCurve::tangent(double u, Base::Vector3d& dir) const
     return false;
 }
 
+namespace
+{
+// Below this number of parameters, batch evaluation runs in the calling thread
+constexpr std::size_t parallelEvaluationThreshold = 256;
+
+// Calls func for each index in [0, count) in parallel. The first OCC exception
+// raised by any of the calls is rethrown as a Base::CADKernelError.
+template<typename Func>
+void evaluateInParallel(std::size_t count, Func&& func)
+{
+    std::mutex mutex;
+    std::exception_ptr error;
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(count),
+        [&](int index) {
+            try {
+                func(static_cast<std::size_t>(index));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        },
+        count < parallelEvaluationThreshold
+    );
+    if (error) {
+        try {
+            std::rethrow_exception(error);
+        }
+        catch (Standard_Failure& e) {
+            THROWM(Base::CADKernelError, e.GetMessageString())
+        }
+    }
+}
+
+inline Base::Vector3d toVector(const gp_XYZ& xyz)
+{
+    return {xyz.X(), xyz.Y(), xyz.Z()};
+}
+}  // namespace
+
 Base::Vector3d GeomCurve::value(double u) const
 {
     Handle(Geom_Curve) curve = Handle(Geom_Curve)::DownCast(handle());
@@ -909,6 +956,45 @@ Base::Vector3d GeomCurve::value(double u) const
     return Base::Vector3d(point.X(), point.Y(), point.Z());
 }
 
+std::vector<Base::Vector3d> GeomCurve::values(const std::vector<double>& params, int order) const
+{
+    if (order < 0 || order > 3) {
+        THROWM(Base::ValueError, "Derivative order must be between 0 and 3")
+    }
+    Handle(Geom_Curve) curve = Handle(Geom_Curve)::DownCast(handle());
+    if (curve.IsNull()) {
+        THROWM(Base::ValueError, "Geometry is not a curve")
+    }
+
+    const std::size_t stride = order + 1;
+    std::vector<Base::Vector3d> res(params.size() * stride);
+    evaluateInParallel(params.size(), [&](std::size_t index) {
+        gp_Pnt point;
+        gp_Vec d1, d2, d3;
+        double u = params[index];
+        switch (order) {
+            case 0:
+                curve->D0(u, point);
+                break;
+            case 1:
+                curve->D1(u, point, d1);
+                break;
+            case 2:
+                curve->D2(u, point, d1, d2);
+                break;
+            default:
+                curve->D3(u, point, d1, d2, d3);
+                break;
+        }
+        Base::Vector3d* out = &res[index * stride];
+        const gp_XYZ* vectors[] = {&point.XYZ(), &d1.XYZ(), &d2.XYZ(), &d3.XYZ()};
+        for (std::size_t i = 0; i < stride; ++i) {
+            out[i] = toVector(*vectors[i]);
+        }
+    });
+    return res;
+}
+
 Base::Vector3d GeomCurve::pointAtParameter(double u) const
 {
     Handle(Geom_Curve) curve = Handle(Geom_Curve)::DownCast(handle());
@@ -5116,6 +5202,87 @@ gp_Vec GeomSurface::getDN(double u, double v, int Nu, int Nv) const
     return s->DN(u, v, Nu, Nv);
 }
 
+int GeomSurface::valuesStride(int order)
+{
+    return (order + 1) * (order + 2) / 2;
+}
+
+std::vector<Base::Vector3d>
+GeomSurface::values(const std::vector<double>& u, const std::vector<double>& v, int order) const
+{
+    if (order < 0 || order > 3) {
+        THROWM(Base::ValueError, "Derivative order must be between 0 and 3")
+    }
+    if (u.size() != v.size()) {
+        THROWM(Base::ValueError, "Number of u and v parameters differ")
+    }
+    Handle(Geom_Surface) s = Handle(Geom_Surface)::DownCast(handle());
+    if (s.IsNull()) {
+        THROWM(Base::ValueError, "Geometry is not a surface")
+    }
+
+    const std::size_t stride = valuesStride(order);
+    std::vector<Base::Vector3d> res(u.size() * stride);
+    evaluateInParallel(u.size(), [&](std::size_t index) {
+        gp_Pnt point;
+        gp_Vec d1u, d1v, d2u, d2v, d2uv, d3u, d3v, d3uuv, d3uvv;
+        switch (order) {
+            case 0:
+                s->D0(u[index], v[index], point);
+                break;
+            case 1:
+                s->D1(u[index], v[index], point, d1u, d1v);
+                break;
+            case 2:
+                s->D2(u[index], v[index], point, d1u, d1v, d2u, d2v, d2uv);
+                break;
+            default:
+                s->D3(u[index], v[index], point, d1u, d1v, d2u, d2v, d2uv, d3u, d3v, d3uuv, d3uvv);
+                break;
+        }
+        Base::Vector3d* out = &res[index * stride];
+        const gp_XYZ* vectors[] = {
+            &point.XYZ(),
+            &d1u.XYZ(),
+            &d1v.XYZ(),
+            &d2u.XYZ(),
+            &d2v.XYZ(),
+            &d2uv.XYZ(),
+            &d3u.XYZ(),
+            &d3v.XYZ(),
+            &d3uuv.XYZ(),
+            &d3uvv.XYZ()
+        };
+        for (std::size_t i = 0; i < stride; ++i) {
+            out[i] = toVector(*vectors[i]);
+        }
+    });
+    return res;
+}
+
+std::vector<Base::Vector3d>
+GeomSurface::normals(const std::vector<double>& u, const std::vector<double>& v) const
+{
+    if (u.size() != v.size()) {
+        THROWM(Base::ValueError, "Number of u and v parameters differ")
+    }
+    Handle(Geom_Surface) s = Handle(Geom_Surface)::DownCast(handle());
+    if (s.IsNull()) {
+        THROWM(Base::ValueError, "Geometry is not a surface")
+    }
+
+    std::vector<Base::Vector3d> res(u.size());
+    evaluateInParallel(u.size(), [&](std::size_t index) {
+        gp_Dir dir;
+        Standard_Boolean done;
+        Tools::getNormal(s, u[index], v[index], Precision::Confusion(), dir, done);
+        if (done) {
+            res[index] = toVector(dir.XYZ());
+        }
+    });
+    return res;
+}
+
 bool GeomSurface::isUmbillic(double u, double v) const
 {
     Handle(Geom_Surface) s = Handle(Geom_Surface)::DownCast(handle());
@@ -259,6 +259,14 @@ public:
     void reverse();
 
     Base::Vector3d value(double u) const;
+    /*!
+     * \brief values Evaluates the curve at many parameters at once, in parallel
+     * \param params The curve parameters
+     * \param order The highest derivative to compute, from 0 to 3
+     * \return A contiguous buffer of order+1 vectors per parameter: the point
+     * followed by the derivatives up to the given order
+     */
+    std::vector<Base::Vector3d> values(const std::vector<double>& params, int order = 0) const;
 
     GeomLine* toLine(KeepTag clone = CopyTag) const;
     GeomLineSegment* toLineSegment(KeepTag clone = CopyTag) const;
@@ -975,6 +983,26 @@ public:
      */
     virtual gp_Vec getDN(double u, double v, int Nu, int Nv) const;
 
+    /*!
+     * \brief values Evaluates the surface at many (u, v) pairs at once, in parallel
+     * \param u The u parameters
+     * \param v The v parameters, one for each u parameter
+     * \param order The highest derivative to compute, from 0 to 3
+     * \return A contiguous buffer of vectors per parameter pair, in the order of
+     * Geom_Surface::D3: the point (order 0), then D1U and D1V (order 1), then
+     * D2U, D2V and D2UV (order 2), then D3U, D3V, D3UUV and D3UVV (order 3)
+     */
+    std::vector<Base::Vector3d>
+    values(const std::vector<double>& u, const std::vector<double>& v, int order = 0) const;
+    /// Number of vectors per parameter pair returned by values() for the given order
+    static int valuesStride(int order);
+    /*!
+     * \brief normals Computes the normals at many (u, v) pairs at once, in parallel
+     * \return One normal per parameter pair, or a null vector where the normal is not defined
+     */
+    std::vector<Base::Vector3d>
+    normals(const std::vector<double>& u, const std::vector<double>& v) const;
+
     /** @name Curvature information */
     //@{
     bool isUmbillic(double u, double v) const;
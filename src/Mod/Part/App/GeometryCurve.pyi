@@ -221,6 +221,22 @@ class GeometryCurve(Geometry):
         """
         ...
 
+    @constmethod
+    def values(self, params: object, order: int = 0, /) -> object:
+        """
+        values(params, [order=0]) -> list or memoryview
+        Computes the points, and optionally the derivatives up to the given order (0 to 3),
+        at many parameters at once. The evaluation runs in parallel.
+
+        params is a sequence of floats, or an object supporting the buffer protocol
+        with contiguous doubles such as a NumPy float64 array.
+        For a sequence the result is a list of points, or a list of tuples
+        (point, d1, ...) if order is greater than 0.
+        For a buffer the result is a memoryview of doubles with the shape (n, 3), or
+        (n, order + 1, 3) if order is greater than 0, e.g. numpy.asarray(result).
+        """
+        ...
+
     @constmethod
     def tangent(self, u: float, /) -> Vector:
         """
@@ -66,6 +66,7 @@
 #include "PointPy.h"
 #include "RectangularTrimmedSurfacePy.h"
 #include "OCCError.h"
+#include "PartPyCXX.h"
 #include "TopoShape.h"
 #include "TopoShapeEdgePy.h"
 
@@ -571,6 +572,24 @@ PyObject* GeometryCurvePy::value(PyObject* args) const
     return nullptr;
 }
 
+PyObject* GeometryCurvePy::values(PyObject* args) const
+{
+    PyObject* params;
+    int order = 0;
+    if (!PyArg_ParseTuple(args, "O|i", &params, &order)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool isBuffer = false;
+        std::vector<double> u = getPyDoubles(params, &isBuffer);
+        std::vector<Base::Vector3d> res = getGeomCurvePtr()->values(u, order);
+        return Py::new_reference_to(vectors2py(res, order + 1, isBuffer));
+    }
+    PY_CATCH_OCC;
+}
+
 PyObject* GeometryCurvePy::tangent(PyObject* args) const
 {
     Handle(Geom_Geometry) g = getGeometryPtr()->handle();
@@ -84,6 +84,33 @@ class GeometrySurface(Geometry):
         """
         ...
 
+    @constmethod
+    def values(self, u: object, v: object, order: int = 0, /) -> object:
+        """
+        values(u, v, [order=0]) -> list or memoryview
+        Computes the points, and optionally the derivatives up to the given order (0 to 3),
+        at many parameter pairs at once. The evaluation runs in parallel.
+
+        u and v are sequences of floats of the same length, or objects supporting the
+        buffer protocol with contiguous doubles such as NumPy float64 arrays.
+        The vectors of each pair are ordered as by Geom_Surface::D3:
+        point, D1U, D1V, D2U, D2V, D2UV, D3U, D3V, D3UUV, D3UVV.
+        For sequences the result is a list of points, or a list of tuples if order
+        is greater than 0. For buffers the result is a memoryview of doubles with the
+        shape (n, 3), or (n, k, 3) where k is the number of vectors per pair.
+        """
+        ...
+
+    @constmethod
+    def normals(self, u: object, v: object, /) -> object:
+        """
+        normals(u, v) -> list or memoryview
+        Computes the normals at many parameter pairs at once, in parallel.
+        A null vector is returned where the normal is not defined.
+        The arguments and the result are handled as in values().
+        """
+        ...
+
     @overload
     def projectPoint(
         self, Point: Vector, Method: Literal["NearestPoint"] = "NearestPoint"
@@ -52,6 +52,7 @@
 #include "GeometryCurvePy.h"
 #include "LinePy.h"
 #include "OCCError.h"
+#include "PartPyCXX.h"
 #include "TopoShapeFacePy.h"
 #include "TopoShapeShellPy.h"
 
@@ -254,6 +255,45 @@ PyObject* GeometrySurfacePy::value(PyObject* args) const
     return nullptr;
 }
 
+PyObject* GeometrySurfacePy::values(PyObject* args) const
+{
+    PyObject* pyU;
+    PyObject* pyV;
+    int order = 0;
+    if (!PyArg_ParseTuple(args, "OO|i", &pyU, &pyV, &order)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool isBuffer = false;
+        std::vector<double> u = getPyDoubles(pyU, &isBuffer);
+        std::vector<double> v = getPyDoubles(pyV);
+        std::vector<Base::Vector3d> res = getGeomSurfacePtr()->values(u, v, order);
+        return Py::new_reference_to(vectors2py(res, GeomSurface::valuesStride(order), isBuffer));
+    }
+    PY_CATCH_OCC;
+}
+
+PyObject* GeometrySurfacePy::normals(PyObject* args) const
+{
+    PyObject* pyU;
+    PyObject* pyV;
+    if (!PyArg_ParseTuple(args, "OO", &pyU, &pyV)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool isBuffer = false;
+        std::vector<double> u = getPyDoubles(pyU, &isBuffer);
+        std::vector<double> v = getPyDoubles(pyV);
+        std::vector<Base::Vector3d> res = getGeomSurfacePtr()->normals(u, v);
+        return Py::new_reference_to(vectors2py(res, 1, isBuffer));
+    }
+    PY_CATCH_OCC;
+}
+
 PyObject* GeometrySurfacePy::tangent(PyObject* args) const
 {
     Handle(Geom_Geometry) g = getGeometryPtr()->handle();
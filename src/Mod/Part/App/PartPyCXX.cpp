@@ -23,9 +23,37 @@
  ***************************************************************************/
 
 
+#include <bit>
+#include <cstring>
+#include <memory>
+
+#include <Base/GeometryPyCXX.h>
+
 #include "PartPyCXX.h"
 
 
+namespace
+{
+// The format of a buffer of native doubles, explicit byte orders other than the native one
+// are not converted
+bool isNativeDoubleFormat(const char* format)
+{
+    if (!format) {
+        return false;
+    }
+    if (std::strcmp(format, "d") == 0 || std::strcmp(format, "=d") == 0
+        || std::strcmp(format, "@d") == 0) {
+        return true;
+    }
+    if constexpr (std::endian::native == std::endian::little) {
+        return std::strcmp(format, "<d") == 0;
+    }
+    else {
+        return std::strcmp(format, ">d") == 0 || std::strcmp(format, "!d") == 0;
+    }
+}
+}  // namespace
+
 namespace Part
 {
 PartExport Py::Object shape2pyshape(const TopoShape& shape)
@@ -39,6 +67,80 @@ PartExport Py::Object shape2pyshape(const TopoDS_Shape& shape)
     return shape2pyshape(TopoShape(shape));
 }
 
+PartExport std::vector<double> getPyDoubles(PyObject* obj, bool* isBuffer)
+{
+    std::vector<double> res;
+    if (PyObject_CheckBuffer(obj)) {
+        Py_buffer buf;
+        if (PyObject_GetBuffer(obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+            throw Py::Exception();
+        }
+        std::unique_ptr<Py_buffer, decltype(&PyBuffer_Release)> guard(&buf, PyBuffer_Release);
+        if (buf.itemsize != sizeof(double) || !isNativeDoubleFormat(buf.format)) {
+            throw Py::TypeError("Buffer must contain doubles in native byte order");
+        }
+        const auto* data = static_cast<const double*>(buf.buf);
+        res.assign(data, data + buf.len / buf.itemsize);
+        if (isBuffer) {
+            *isBuffer = true;
+        }
+        return res;
+    }
+
+    Py::Sequence seq(obj);
+    res.reserve(seq.size());
+    for (Py::Sequence::iterator it = seq.begin(); it != seq.end(); ++it) {
+        res.push_back(static_cast<double>(Py::Float(*it)));
+    }
+    if (isBuffer) {
+        *isBuffer = false;
+    }
+    return res;
+}
+
+PartExport Py::Object
+vectors2py(const std::vector<Base::Vector3d>& vectors, std::size_t stride, bool asBuffer)
+{
+    std::size_t count = stride ? vectors.size() / stride : 0;
+    if (asBuffer) {
+        std::size_t num = count * stride;
+        auto size = static_cast<Py_ssize_t>(num * 3 * sizeof(double));
+        Py::Object bytes(PyByteArray_FromStringAndSize(nullptr, size), true);
+        auto data = reinterpret_cast<double*>(PyByteArray_AsString(bytes.ptr()));
+        for (std::size_t i = 0; i < num; ++i) {
+            *data++ = vectors[i].x;
+            *data++ = vectors[i].y;
+            *data++ = vectors[i].z;
+        }
+        Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+        if (count == 0) {
+            // cast() rejects a shape with a zero dimension
+            return view.callMemberFunction("cast", Py::TupleN(Py::String("d")));
+        }
+        Py::Tuple shape(stride > 1 ? 3 : 2);
+        shape.setItem(0, Py::Long(static_cast<long>(count)));
+        if (stride > 1) {
+            shape.setItem(1, Py::Long(static_cast<long>(stride)));
+        }
+        shape.setItem(shape.size() - 1, Py::Long(3));
+        return view.callMemberFunction("cast", Py::TupleN(Py::String("d"), shape));
+    }
+
+    Py::List list(static_cast<Py::sequence_index_type>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        if (stride == 1) {
+            list.setItem(i, Py::Vector(vectors[i]));
+            continue;
+        }
+        Py::Tuple tuple(static_cast<Py::sequence_index_type>(stride));
+        for (std::size_t j = 0; j < stride; ++j) {
+            tuple.setItem(j, Py::Vector(vectors[i * stride + j]));
+        }
+        list.setItem(i, tuple);
+    }
+    return list;
+}
+
 }  // namespace Part
 
 
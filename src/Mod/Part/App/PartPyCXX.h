@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include <CXX/Extensions.hxx>
 
+#include <Base/Vector3D.h>
 #include <Mod/Part/PartGlobal.h>
 #include <Mod/Part/App/TopoShapePy.h>
 
@@ -43,4 +46,20 @@ PartExport Py::Object shape2pyshape(const TopoShape& shape);
 PartExport Py::Object shape2pyshape(const TopoDS_Shape& shape);
 PartExport void getPyShapes(PyObject* obj, std::vector<TopoShape>& shapes);
 PartExport std::vector<TopoShape> getPyShapes(PyObject* obj);
+
+/** Get an array of floats from a Python sequence, or from an object supporting the buffer
+ * protocol with contiguous doubles in native byte order, e.g. a NumPy float64 array.
+ * @param isBuffer: optional output telling whether the buffer protocol was used
+ */
+PartExport std::vector<double> getPyDoubles(PyObject* obj, bool* isBuffer = nullptr);
+
+/** Convert a contiguous buffer of vectors, stride vectors per item, to Python
+ * @param asBuffer: if true, return a memoryview of doubles shaped (items, 3), or
+ *                  (items, stride, 3) if stride is more than one, which NumPy can wrap
+ *                  without copy. Otherwise return a list of Vector, or a list of tuples of
+ *                  Vector if stride is more than one. Without items the memoryview is
+ *                  one-dimensional and empty.
+ */
+PartExport Py::Object
+vectors2py(const std::vector<Base::Vector3d>& vectors, std::size_t stride, bool asBuffer);
 }  // namespace Part
@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/MappedElement.h>
+#include <Base/Parameter.h>
+#include <Base/Tools.h>
+#include <Base/Writer.h>
+
+#include "PartFeature.h"
+#include "PropertyTopoShape.h"
+#include "ShapeOpCache.h"
+
+using namespace Part;
+
+namespace
+{
+
+// Upper bound of the geometry digest memo before it is flushed
+constexpr std::size_t maxDigestCount = 4096;
+
+ParameterGrp::handle getParameterGroup()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+}
+
+// Properties that are results of a recompute rather than inputs to it
+bool isResultProperty(const App::DocumentObject* owner, const App::Property* prop)
+{
+    if (prop->isDerivedFrom<PropertyPartShape>() || prop->testStatus(App::Property::Output)
+        || prop->testStatus(App::Property::Transient)
+        || prop->testStatus(App::Property::NoRecompute)) {
+        return true;
+    }
+    constexpr short resultTypes = App::Prop_Output | App::Prop_Transient | App::Prop_NoRecompute;
+    if ((owner->getPropertyType(prop) & resultTypes) != 0) {
+        return true;
+    }
+    return prop == &owner->Label || prop == &owner->Label2 || prop == &owner->Visibility
+        || prop == &owner->ExpressionEngine;
+}
+
+std::uint64_t fnv1a(const std::string& text)
+{
+    std::uint64_t res = 0xcbf29ce484222325ULL;
+    for (unsigned char c : text) {
+        res = (res ^ c) * 0x100000001b3ULL;
+    }
+    return res;
+}
+
+std::size_t estimateMemory(const std::vector<TopoShape>& shapes)
+{
+    std::size_t res = 0;
+    for (const auto& shape : shapes) {
+        // Rough estimate, the element names are not counted individually
+        res += shape.getMemSize() + shape.getElementMapSize(false) * sizeof(Data::MappedElement);
+    }
+    return res;
+}
+
+}  // namespace
+
+ShapeOpCache& ShapeOpCache::instance()
+{
+    static ShapeOpCache cache;
+    return cache;
+}
+
+ShapeOpCache::ShapeOpCache()
+{
+    auto hGrp = getParameterGroup();
+    enabled = hGrp->GetBool("EnableOpCache", false);
+    limit = static_cast<std::size_t>(std::max(0L, hGrp->GetInt("OpCacheMemoryLimit", 256)))
+        * 1024 * 1024;
+}
+
+bool ShapeOpCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return enabled;
+}
+
+void ShapeOpCache::setEnabled(bool enable)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = enable;
+    if (!enabled) {
+        entries.clear();
+        index.clear();
+        digests.clear();
+        memory = 0;
+    }
+}
+
+std::size_t ShapeOpCache::memoryLimit() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return limit;
+}
+
+void ShapeOpCache::setMemoryLimit(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    limit = bytes;
+    evict();
+}
+
+std::string ShapeOpCache::makeKey(const App::DocumentObject* owner, const std::string& context)
+{
+    if (!owner || !owner->getDocument() || !isEnabled()) {
+        return {};
+    }
+
+    Base::StringWriter writer;
+    auto& stream = writer.Stream();
+    // any change of a value must change the key, so doubles are written without rounding
+    stream.precision(std::numeric_limits<double>::max_digits10);
+    stream << owner->getTypeId().getName() << '\n'
+           << static_cast<const void*>(owner->getDocument()) << '\n'
+           << static_cast<const void*>(
+                  static_cast<App::StringHasher*>(owner->getDocument()->getStringHasher())
+              )
+           << '\n'
+           << owner->getID() << '\n'
+           << context << '\n';
+
+    std::vector<App::Property*> props;
+    owner->getPropertyList(props);
+    for (auto prop : props) {
+        if (isResultProperty(owner, prop)) {
+            continue;
+        }
+        stream << prop->getName() << '=';
+        prop->Save(writer);
+        stream << '\n';
+    }
+
+    for (auto dep : owner->getOutList()) {
+        stream << dep->getFullName() << ':'
+               << shapeDigest(
+                      Feature::getTopoShape(dep, ShapeOption::ResolveLink | ShapeOption::Transform)
+                  )
+               << '\n';
+    }
+    return writer.getString();
+}
+
+std::string ShapeOpCache::shapeDigest(const TopoShape& shape)
+{
+    if (shape.isNull()) {
+        return "null";
+    }
+
+    // The element map may differ for the same geometry, so hash it every time
+    std::size_t mapHash = 0;
+    for (const auto& element : shape.getElementMap()) {
+        Base::hash_combine(mapHash, element.index.toString());
+        Base::hash_combine(mapHash, element.name.hash());
+    }
+
+    std::ostringstream ss;
+    auto hasher = static_cast<App::StringHasher*>(shape.Hasher);
+    ss << shape.Tag << '/' << static_cast<const void*>(hasher) << '/' << std::hex << mapHash << '/';
+
+    const auto& topoShape = shape.getShape();
+    const void* tshape = topoShape.TShape().get();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto range = digests.equal_range(tshape);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second.shape.IsEqual(topoShape)) {
+                ss << it->second.digest;
+                return ss.str();
+            }
+        }
+    }
+
+    // The BRep text does not include triangulation, which may be added to the
+    // shape later on for visualization.
+    std::ostringstream brep;
+    shape.exportBrep(brep);
+    std::string text = brep.str();
+    std::ostringstream digest;
+    digest << std::hex << std::hash<std::string> {}(text) << '-' << fnv1a(text) << '-'
+           << text.size();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (digests.size() >= maxDigestCount) {
+        digests.clear();
+    }
+    digests.emplace(tshape, DigestEntry {topoShape, digest.str()});
+    ss << digest.str();
+    return ss.str();
+}
+
+bool ShapeOpCache::lookup(const std::string& key, std::vector<TopoShape>& shapes)
+{
+    if (key.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!enabled) {
+        return false;
+    }
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++misses;
+        return false;
+    }
+    ++hits;
+    entries.splice(entries.begin(), entries, it->second);
+    shapes = it->second->shapes;
+    return true;
+}
+
+void ShapeOpCache::store(const std::string& key, const std::vector<TopoShape>& shapes)
+{
+    if (key.empty()) {
+        return;
+    }
+    std::size_t size = estimateMemory(shapes) + key.size();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!enabled || size > limit) {
+        return;
+    }
+    auto it = index.find(key);
+    if (it != index.end()) {
+        memory -= it->second->memory;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    entries.push_front(Entry {key, shapes, size});
+    index.emplace(key, entries.begin());
+    memory += size;
+    ++insertions;
+    evict();
+}
+
+void ShapeOpCache::evict()
+{
+    while (memory > limit && !entries.empty()) {
+        auto& entry = entries.back();
+        memory -= entry.memory;
+        index.erase(entry.key);
+        entries.pop_back();
+        ++evictions;
+    }
+}
+
+void ShapeOpCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    digests.clear();
+    memory = 0;
+    hits = 0;
+    misses = 0;
+    insertions = 0;
+    evictions = 0;
+}
+
+ShapeOpCache::Statistics ShapeOpCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Statistics stats;
+    stats.enabled = enabled;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.insertions = insertions;
+    stats.evictions = evictions;
+    stats.entries = entries.size();
+    stats.memory = memory;
+    stats.memoryLimit = limit;
+    return stats;
+}
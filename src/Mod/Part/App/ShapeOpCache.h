@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "TopoShape.h"
+
+namespace App
+{
+class DocumentObject;
+}
+
+namespace Part
+{
+
+/** Memo cache of shape operation results
+ *
+ * Features doing expensive modelling operations can use this cache to skip the
+ * operation when they are recomputed with the same inputs, e.g. after touching
+ * an unrelated property or after undo/redo. The key of an entry combines the
+ * identity of the owner object, the serialized value of its input properties,
+ * and a digest (geometry, tag and element map) of the shapes of every object it
+ * depends on. The cached value is the list of result shapes including their
+ * element map.
+ *
+ * The cache is disabled by default. It is controlled by the parameters
+ * 'EnableOpCache' and 'OpCacheMemoryLimit' (in MB) of the group
+ * BaseApp/Preferences/Mod/Part/General, or at runtime from Python.
+ * Least recently used entries are evicted once the estimated memory of the
+ * cached shapes exceeds the limit.
+ */
+class PartExport ShapeOpCache
+{
+public:
+    struct Statistics
+    {
+        bool enabled = false;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t insertions = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t memory = 0;
+        std::size_t memoryLimit = 0;
+    };
+
+    static ShapeOpCache& instance();
+
+    bool isEnabled() const;
+    void setEnabled(bool enable);
+
+    /// Memory limit in bytes
+    std::size_t memoryLimit() const;
+    void setMemoryLimit(std::size_t bytes);
+
+    /** Compose the cache key for a recompute of \a owner
+     *
+     * @param owner: the object being recomputed
+     * @param context: any extra input of the operation not stored in a property
+     *                 of \a owner, e.g. global tolerances or settings
+     *
+     * @return The key, or an empty string if the cache is disabled.
+     */
+    std::string makeKey(const App::DocumentObject* owner, const std::string& context = {});
+
+    /** Look up the cached result shapes of \a key
+     *
+     * @return Return true and fill \a shapes on hit. An empty key always misses
+     *         without being counted.
+     */
+    bool lookup(const std::string& key, std::vector<TopoShape>& shapes);
+
+    /// Store the result shapes of \a key. Empty keys are ignored.
+    void store(const std::string& key, const std::vector<TopoShape>& shapes);
+
+    /// Remove all entries and reset the statistics
+    void clear();
+
+    Statistics getStatistics() const;
+
+private:
+    ShapeOpCache();
+
+    struct Entry
+    {
+        std::string key;
+        std::vector<TopoShape> shapes;
+        std::size_t memory = 0;
+    };
+
+    std::string shapeDigest(const TopoShape& shape);
+    void evict();
+
+private:
+    mutable std::mutex mutex;
+    bool enabled;
+    std::size_t limit;
+    std::size_t memory = 0;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t insertions = 0;
+    std::size_t evictions = 0;
+
+    /// Most recently used entries first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+    struct DigestEntry
+    {
+        TopoDS_Shape shape;
+        std::string digest;
+    };
+    /// Geometry digest memo, keyed by the TShape of the input shapes. The entry
+    /// holds a handle to the shape so that the TShape address is not reused.
+    std::unordered_multimap<const void*, DigestEntry> digests;
+};
+
+}  // namespace Part
@@ -1709,6 +1709,15 @@ public:
     void mapSubElement(const TopoShape& other, const char* op = nullptr, bool forceHasher = false);
     void mapSubElement(const std::vector<TopoShape>& shapes, const char* op = nullptr);
     void mapSubElementsTo(std::vector<TopoShape>& shapes, const char* op = nullptr) const;
+
+    /** Set the number of sub-shapes from which element names are mapped in parallel
+     *
+     * Applies to mapSubElement() and makeShapeWithElementMap(). The mapped
+     * names do not depend on it. 0 always maps in parallel, INT_MAX never.
+     *
+     * @return the previous threshold
+     */
+    static int setParallelMappingThreshold(int count);
     bool hasPendingElementMap() const;
 
     std::string getElementMapVersion() const override;
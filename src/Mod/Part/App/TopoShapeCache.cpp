@@ -22,10 +22,18 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <OSD_Parallel.hxx>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
 
+namespace
+{
+// Below this number of ancestors the tables are built in the calling thread
+constexpr int parallelAncestorThreshold = 256;
+}  // namespace
+
 ShapeRelationKey::ShapeRelationKey(Data::MappedName name, HistoryTraceType historyTraceType)
     : name(std::move(name))
     , historyTraceType(historyTraceType)
@@ -144,6 +152,17 @@ int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shap
     return shapes.FindIndex(stripLocation(parent, subShape));
 }
 
+int TopoShapeCache::Ancestry::find(
+    const TopLoc_Location& parentInverse,
+    const TopoDS_Shape& subShape
+) const
+{
+    if (parentInverse.IsIdentity()) {
+        return shapes.FindIndex(subShape);
+    }
+    return shapes.FindIndex(TopoShape::located(subShape, parentInverse * subShape.Location()));
+}
+
 TopoDS_Shape TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, int index)
 {
     if (index <= 0 || index > shapes.Extent()) {
@@ -228,6 +247,79 @@ TopoDS_Shape TopoShapeCache::findShape(const TopoDS_Shape& parent, TopAbs_ShapeE
     return {};
 }
 
+void TopoShapeCache::mapAllShapes()
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    // Each type has its own Ancestry, and exploring the shape does not modify it
+    OSD_Parallel::For(TopAbs_COMPOUND, TopAbs_SHAPE + 1, [this](int type) {
+        getAncestry(static_cast<TopAbs_ShapeEnum>(type));
+    });
+}
+
+TopoShapeCache::AncestorInfo& TopoShapeCache::getAncestors(
+    TopAbs_ShapeEnum type,
+    TopAbs_ShapeEnum subType
+)
+{
+    auto& info = getAncestry(type);
+    auto& ancestorInfo = info.ancestors.at(subType);
+    if (ancestorInfo.initialized) {
+        return ancestorInfo;
+    }
+    ancestorInfo.initialized = true;
+    mapAllShapes();
+    const auto& children = getAncestry(subType);
+
+    // Explore the ancestors in the same order as TopExp::MapShapesAndAncestors(), including
+    // repeated occurrences of shared ancestors, so that the ancestor lists match.
+    std::vector<TopoDS_Shape> occurrences;
+    for (TopExp_Explorer exp(shape, type); exp.More(); exp.Next()) {
+        occurrences.push_back(exp.Current());
+    }
+    int count = static_cast<int>(occurrences.size());
+    std::vector<int> parentIndices(count);
+    std::vector<std::vector<int>> childIndices(count);
+    OSD_Parallel::For(
+        0,
+        count,
+        [&](int i) {
+            parentIndices[i] = info.shapes.FindIndex(occurrences[i]);
+            auto& indices = childIndices[i];
+            for (TopExp_Explorer exp(occurrences[i], subType); exp.More(); exp.Next()) {
+                indices.push_back(children.shapes.FindIndex(exp.Current()));
+            }
+        },
+        count < parallelAncestorThreshold
+    );
+
+    // Counting sort of the (child, ancestor) pairs by child, stable in ancestor order
+    auto& offsets = ancestorInfo.offsets;
+    offsets.assign(children.count() + 1, 0);
+    for (const auto& indices : childIndices) {
+        for (int index : indices) {
+            if (index > 0) {
+                ++offsets[index];
+            }
+        }
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+    }
+    std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+    ancestorInfo.refs.resize(offsets.back());
+    for (int i = 0; i < count; ++i) {
+        for (int index : childIndices[i]) {
+            if (index > 0) {
+                ancestorInfo.refs[cursor[index - 1]++]
+                    = {parentIndices[i], occurrences[i].Orientation()};
+            }
+        }
+    }
+    return ancestorInfo;
+}
+
 TopoDS_Shape TopoShapeCache::findAncestor(
     const TopoDS_Shape& parent,
     const TopoDS_Shape& subShape,
@@ -240,30 +332,28 @@ TopoDS_Shape TopoShapeCache::findAncestor(
         return nullShape;
     }
 
-    auto& info = getAncestry(type);
-
-    auto& ancestorInfo = info.ancestors.at(subShape.ShapeType());
-    if (!ancestorInfo.initialized) {
-        ancestorInfo.initialized = true;
-        // ancestorInfo.shapes is the output variable here, storing (and caching) the actual map
-        TopExp::MapShapesAndAncestors(shape, subShape.ShapeType(), type, ancestorInfo.shapes);
-    }
-    int index = parent.Location().IsIdentity()
-        ? ancestorInfo.shapes.FindIndex(subShape)
-        : ancestorInfo.shapes.FindIndex(info.stripLocation(parent, subShape));
+    const auto& ancestorInfo = getAncestors(type, subShape.ShapeType());
+    int index = getAncestry(subShape.ShapeType()).find(parent, subShape);
     if (index == 0) {
         return nullShape;
     }
-    const auto& shapes = ancestorInfo.shapes.FindFromIndex(index);
-    if (shapes.Extent() == 0) {
+    int begin = ancestorInfo.offsets[index - 1];
+    int end = ancestorInfo.offsets[index];
+    if (begin == end) {
         return nullShape;
     }
 
+    const auto& info = getAncestry(type);
+    auto getShape = [&](const AncestorRef& ref) {
+        TopoDS_Shape res = info.shapes.FindKey(ref.index);
+        res.Orientation(ref.orientation);
+        return TopoShape::moved(res, parent.Location());
+    };
     if (ancestors) {
-        ancestors->reserve(ancestors->size() + shapes.Extent());
-        for (TopTools_ListIteratorOfListOfShape it(shapes); it.More(); it.Next()) {
-            ancestors->push_back(TopoShape::moved(it.Value(), parent.Location()));
+        ancestors->reserve(ancestors->size() + end - begin);
+        for (int i = begin; i < end; ++i) {
+            ancestors->push_back(getShape(ancestorInfo.refs[i]));
         }
     }
-    return TopoShape::moved(shapes.First(), parent.Location());
+    return getShape(ancestorInfo.refs[begin]);
 }
@@ -31,9 +31,9 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
-#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <utility>
+#include <vector>
 
 #include <App/ElementMap.h>
 
@@ -76,10 +76,23 @@ public:
     /// Inverse of location
     TopLoc_Location locationInverse;
 
+    /// Reference to an ancestor shape by its index in the ancestor Ancestry::shapes, plus the
+    /// orientation of the ancestor occurrence, which may differ from the mapped one.
+    struct AncestorRef
+    {
+        int index;
+        TopAbs_Orientation orientation;
+    };
+
+    /// Compact ancestor table in CSR layout. The ancestors of the child shape with index i
+    /// in the child Ancestry::shapes are refs[offsets[i-1]] up to (excluding)
+    /// refs[offsets[i]], in the same order and with the same duplicates as
+    /// TopExp::MapShapesAndAncestors() would give.
     struct PartExport AncestorInfo
     {
         bool initialized = false;
-        TopTools_IndexedDataMapOfShapeListOfShape shapes;
+        std::vector<int> offsets;
+        std::vector<AncestorRef> refs;
     };
 
     /// Class for caching the ancestor and children shapes mapping
@@ -95,10 +108,9 @@ public:
         /// One-to-one corresponding TopoShape to each child TopoDS_Shape
         std::vector<TopoShape> topoShapes;
 
-        /// Caches the OCCT ancestor shape maps, e.g.
+        /// Caches the ancestor tables, e.g.
         ///     Cache::shapeAncestryCache[TopAbs_FACE].ancestors[TopAbs_EDGE]
-        /// stores an OCCT TopTools_IndexedDataMapOfShapeListOfShape that can return a list of
-        /// faces containing a given edge.
+        /// stores the indices of the faces containing each edge.
         std::array<AncestorInfo, TopAbs_SHAPE + 1> ancestors;
 
         TopoShape _getTopoShape(const TopoShape& parent, int index);
@@ -109,6 +121,9 @@ public:
         std::vector<TopoShape> getTopoShapes(const TopoShape& parent);
         TopoDS_Shape stripLocation(const TopoDS_Shape& parent, const TopoDS_Shape& child);
         int find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
+        /// Same as find() above but given the inverted location of the parent, so that it does
+        /// not modify the cache and can be called from several threads at once.
+        int find(const TopLoc_Location& parentInverse, const TopoDS_Shape& subShape) const;
         TopoDS_Shape find(const TopoDS_Shape& parent, int index);
         int count() const;
         bool empty() const;
@@ -124,10 +139,9 @@ public:
     int findShape(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
     TopoDS_Shape findShape(const TopoDS_Shape& parent, TopAbs_ShapeEnum type, int index);
 
-    /// Given a parent shape and a child (sub) shape, call TopExp::MapShapesAndAncestors and cache
-    /// the result. Subsequent calls to this method given unchanged geometry will use the cached
-    /// data rather than re-running MapShapesAndAncestors.
-    /// If ancestors is given, it is cleared and overwritten with the ancestry data.
+    /// Given a parent shape and a child (sub) shape, find the ancestors of the given type using
+    /// the cached ancestor table, which is built on first use.
+    /// If ancestors is given, the ancestors are appended to it.
     TopoDS_Shape findAncestor(
         const TopoDS_Shape& parent,
         const TopoDS_Shape& subShape,
@@ -135,6 +149,14 @@ public:
         std::vector<TopoDS_Shape>* ancestors = nullptr
     );
 
+    /// Map the sub-shapes of all types in one parallel pass, so that the ancestor tables don't
+    /// have to map them one type after the other.
+    void mapAllShapes();
+
+    /// Build the ancestor table of the sub-shapes of type subType in the ancestors of the given
+    /// type, exploring the ancestors in parallel.
+    AncestorInfo& getAncestors(TopAbs_ShapeEnum type, TopAbs_ShapeEnum subType);
+
     /// Ancestor and children shape caches of all shape types. Note that
     /// shapeAncestryCache[TopAbs_SHAPE] is also valid and stores the direct children of a
     /// compound shape.
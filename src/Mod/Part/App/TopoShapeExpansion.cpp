@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <cmath>
+#include <exception>
 #include <limits>
 #include <sstream>
 
@@ -85,6 +86,7 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <atomic>
 #include <utility>
 
 #include <OSD_Parallel.hxx>
@@ -126,6 +128,15 @@ using BRepAdaptor_HCompCurve = BRepAdaptor_CompCurve;
 namespace Part
 {
 
+// Number of sub-shapes from which mapSubElement() and makeShapeWithElementMap() map names in
+// parallel. Below it, dispatching to the workers costs more than it saves.
+static std::atomic<int> parallelMappingThreshold {128};
+
+int TopoShape::setParallelMappingThreshold(int count)
+{
+    return parallelMappingThreshold.exchange(count);
+}
+
 static void expandCompound(const TopoShape& shape, std::vector<TopoShape>& res)
 {
     if (shape.isNull()) {
@@ -945,6 +956,11 @@ void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool force
         }
     };
 
+    // make sure a delayed element map is not generated by the workers below
+    other.flushElementMap();
+    const TopLoc_Location inverse = _Shape.Location().Inverted();
+    const TopLoc_Location otherInverse = other._Shape.Location().Inverted();
+
     for (auto type : types) {
         auto& shapeMap = _cache->getAncestry(type);
         auto& otherMap = other._cache->getAncestry(type);
@@ -968,25 +984,40 @@ void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool force
             forward = false;
             count = shapeMap.count();
         }
-        for (int k = 1; k <= count; ++k) {
-            int i, idx;
-            if (forward) {
-                i = k;
-                idx = shapeMap.find(_Shape, otherMap.find(other._Shape, k));
-                if (!idx) {
-                    continue;
+
+        // Matching the sub-shapes and looking up their names only reads both shapes, so it is
+        // done in parallel for large shapes. Encoding the names uses the hasher and stays serial.
+        using MappedNames = std::vector<std::pair<Data::MappedName, Data::ElementIDRefs>>;
+        std::vector<std::pair<int, MappedNames>> matches(count);
+        OSD_Parallel::For(
+            0,
+            count,
+            [&](int k) {
+                int i, idx;
+                if (forward) {
+                    i = k + 1;
+                    idx = shapeMap.find(inverse, otherMap.find(other._Shape, i));
                 }
-            }
-            else {
-                idx = k;
-                i = otherMap.find(other._Shape, shapeMap.find(_Shape, k));
-                if (!i) {
-                    continue;
+                else {
+                    idx = k + 1;
+                    i = otherMap.find(otherInverse, shapeMap.find(_Shape, idx));
+                }
+                if (!idx || !i) {
+                    return;
                 }
+                matches[k].first = idx;
+                matches[k].second
+                    = other.getElementMappedNames(Data::IndexedName::fromConst(shapetype, i), true);
+            },
+            count < parallelMappingThreshold
+        );
+
+        for (auto& [idx, mappedNames] : matches) {
+            if (!idx) {
+                continue;
             }
             Data::IndexedName element = Data::IndexedName::fromConst(shapetype, idx);
-            for (auto& v :
-                 other.getElementMappedNames(Data::IndexedName::fromConst(shapetype, i), true)) {
+            for (auto& v : mappedNames) {
                 auto& name = v.first;
                 auto& sids = v.second;
                 if (sids.size()) {
@@ -1245,12 +1276,14 @@ struct ShapeInfo
     TopoShapeCache::Ancestry& cache;
     TopAbs_ShapeEnum type;
     const char* shapetype;
+    TopLoc_Location inverse;
 
     ShapeInfo(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, TopoShapeCache::Ancestry& cache)
         : shape(shape)
         , cache(cache)
         , type(type)
         , shapetype(TopoShape::shapeName(type).c_str())
+        , inverse(shape.Location().Inverted())
     {}
 
     [[nodiscard]] int count() const
@@ -1263,9 +1296,9 @@ struct ShapeInfo
         return cache.find(shape, index);
     }
 
-    int find(const TopoDS_Shape& subshape)
+    int find(const TopoDS_Shape& subshape) const
     {
-        return cache.find(shape, subshape);
+        return cache.find(inverse, subshape);
     }
 };
 
@@ -1415,6 +1448,195 @@ void checkForParallelOrCoplanar(
     }
 }
 
+/// An element of an input shape together with its history in the new shape
+struct SourceElement
+{
+    const TopoShape* shape;
+    const ShapeInfo* info;
+    int index;
+    TopoDS_Shape element;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+};
+
+/// The names a source element contributes to the elements of the new shape
+struct SourceNames
+{
+    struct Entry
+    {
+        Data::IndexedName element;
+        NameKey key;
+        NameInfo info;
+    };
+    std::vector<Entry> entries;
+    /// Log messages in the order they occurred, flagged true for errors
+    std::vector<std::pair<bool, std::string>> messages;
+    std::exception_ptr failure;
+};
+
+// Only reads the source and the sub-shape maps of the new shape, so that it can run for several
+// source elements at once
+void collectSourceNames(
+    const SourceElement& source,
+    const std::array<ShapeInfo*, TopAbs_SHAPE>& infoMap,
+    const char* op,
+    SourceNames& result
+)
+{
+    const auto& info = *source.info;
+    const auto& incomingShape = *source.shape;
+    const int i = source.index;
+    const auto& otherElement = source.element;
+    const bool logEnabled = FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG);
+    auto message = [&result](bool error, const std::ostringstream& str) {
+        result.messages.emplace_back(error, str.str());
+    };
+
+    // Find all new objects that are a modification of the old object
+    Data::ElementIDRefs sids;
+    NameKey key(
+        info.type,
+        incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i), true, &sids)
+    );
+
+    int newShapeCounter = 0;
+    for (auto& newShape : source.modified) {
+        ++newShapeCounter;
+        if (newShape.ShapeType() >= TopAbs_SHAPE) {
+            std::ostringstream str;
+            str << "unknown modified shape type " << newShape.ShapeType() << " from "
+                << info.shapetype << i;
+            message(true, str);
+            continue;
+        }
+        auto& newInfo = *infoMap.at(newShape.ShapeType());
+        if (newInfo.type != newShape.ShapeType()) {
+            if (logEnabled) {
+                // TODO: it seems modified shape may report higher
+                // level shape type just like generated shape below.
+                // Maybe we shall do the same for name construction.
+                std::ostringstream str;
+                str << "modified shape type " << TopoShape::shapeName(newShape.ShapeType())
+                    << " mismatch with " << info.shapetype << i;
+                message(false, str);
+            }
+            continue;
+        }
+        int newShapeIndex = newInfo.find(newShape);
+        if (newShapeIndex == 0) {
+            // This warning occurs in makeElementRevolve. It generates
+            // some shape from a vertex that never made into the
+            // final shape. There may be incomingShape cases there.
+            if (logEnabled) {
+                std::ostringstream str;
+                str << "Cannot find " << op << " modified " << newInfo.shapetype << " from "
+                    << info.shapetype << i;
+                message(false, str);
+            }
+            continue;
+        }
+
+        key.tag = incomingShape.Tag;
+        auto& entry = result.entries.emplace_back();
+        entry.element = Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
+        entry.key = key;
+        entry.info.sids = sids;
+        entry.info.index = newShapeCounter;
+        entry.info.shapetype = info.shapetype;
+    }
+
+    int checkParallel = -1;
+    gp_Pln pln;
+
+    // Find all new objects that were generated from an old object
+    // (e.g. a face generated from an edge)
+    newShapeCounter = 0;
+    for (auto& newShape : source.generated) {
+        if (newShape.ShapeType() >= TopAbs_SHAPE) {
+            std::ostringstream str;
+            str << "unknown generated shape type " << newShape.ShapeType() << " from "
+                << info.shapetype << i;
+            message(true, str);
+            continue;
+        }
+
+        int parallelFace = -1;
+        int coplanarFace = -1;
+        auto& newInfo = *infoMap.at(newShape.ShapeType());
+        std::vector<TopoDS_Shape> newShapes;
+        int shapeOffset = 0;
+        if (newInfo.type == newShape.ShapeType()) {
+            newShapes.push_back(newShape);
+        }
+        else {
+            // It is possible for the maker to report generating a
+            // higher level shape, such as shell or solid. For
+            // example, when extruding, OCC will report the
+            // extruding face generating the entire solid. However,
+            // it will also report the edges of the extruding face
+            // generating the side faces. In this case, too much
+            // information is bad for us. We don't want the name of
+            // the side face (and its edges) to be coupled with
+            // incomingShape (unrelated) edges in the extruding face.
+            //
+            // shapeOffset below is used to make sure the higher
+            // level mapped names comes late after sorting. We'll
+            // ignore those names if there are more precise mapping
+            // available.
+            shapeOffset = 3;
+
+            if (info.type == TopAbs_FACE && checkParallel < 0) {
+                if (!TopoShape(otherElement).findPlane(pln)) {
+                    checkParallel = 0;
+                }
+                else {
+                    checkParallel = 1;
+                }
+            }
+            checkForParallelOrCoplanar(
+                newShape,
+                newInfo,
+                newShapes,
+                pln,
+                parallelFace,
+                coplanarFace,
+                checkParallel
+            );
+        }
+        key.shapetype += shapeOffset;
+        for (auto& workingShape : newShapes) {
+            ++newShapeCounter;
+            int workingShapeIndex = newInfo.find(workingShape);
+            if (workingShapeIndex == 0) {
+                if (logEnabled) {
+                    std::ostringstream str;
+                    str << "Cannot find " << op << " generated " << newInfo.shapetype << " from "
+                        << info.shapetype << i;
+                    message(false, str);
+                }
+                continue;
+            }
+
+            key.tag = incomingShape.Tag;
+            auto& entry = result.entries.emplace_back();
+            entry.element = Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
+            entry.key = key;
+            entry.info.sids = sids;
+            if (newShapeCounter == parallelFace) {
+                entry.info.index = std::numeric_limits<int>::min();
+            }
+            else if (newShapeCounter == coplanarFace) {
+                entry.info.index = std::numeric_limits<int>::min() + 1;
+            }
+            else {
+                entry.info.index = -newShapeCounter;
+            }
+            entry.info.shapetype = info.shapetype;
+        }
+        key.shapetype -= shapeOffset;
+    }
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(
     const TopoDS_Shape& shape,
@@ -1482,8 +1704,15 @@ TopoShape& TopoShape::makeShapeWithElementMap(
     std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
 
     // First, collect names from other shapes that generates or modifies the
-    // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
+    // new shape.
+    //
+    // The mapper is not required to be thread safe, so its history is queried
+    // up front. Collecting the names from it only reads the input shapes and
+    // the sub-shape maps of the new shape, which is done in parallel for large
+    // shapes. The results are merged in the order of a serial walk (Vertexes,
+    // then Edges, then Faces) so the names do not depend on the threading.
+    std::vector<SourceElement> sources;
+    for (auto& pinfo : infos) {
         auto& info = *pinfo;
         for (const auto& incomingShape : shapes) {
             if (!canMapElement(incomingShape)) {
@@ -1493,167 +1722,52 @@ TopoShape& TopoShape::makeShapeWithElementMap(
             if (otherMap.empty()) {
                 continue;
             }
+            // make sure a delayed element map is not generated by the workers
+            incomingShape.flushElementMap();
             for (int i = 1; i <= otherMap.count(); i++) {
-                const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape
-                        .getMappedName(Data::IndexedName::fromConst(info.shapetype, i), true, &sids)
-                );
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR(
-                            "unknown modified shape type " << newShape.ShapeType() << " from "
-                                                           << info.shapetype << i
-                        );
-                        continue;
-                    }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN(
-                                "modified shape type " << shapeName(newShape.ShapeType())
-                                                       << " mismatch with " << info.shapetype << i
-                            );
-                        }
-                        continue;
-                    }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // NOLINTNEXTLINE
-                            FC_WARN(
-                                "Cannot find " << op << " modified " << newInfo.shapetype
-                                               << " from " << info.shapetype << i
-                            );
-                        }
-                        continue;
-                    }
-
-                    Data::IndexedName element
-                        = Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
-                        continue;
-                    }
-
-                    key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
-                }
-
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR(
-                            "unknown generated shape type " << newShape.ShapeType() << " from "
-                                                            << info.shapetype << i
-                        );
-                        continue;
-                    }
-
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
-                    }
-                    else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(
-                            newShape,
-                            newInfo,
-                            newShapes,
-                            pln,
-                            parallelFace,
-                            coplanarFace,
-                            checkParallel
-                        );
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN(
-                                    "Cannot find " << op << " generated " << newInfo.shapetype
-                                                   << " from " << info.shapetype << i
-                                );
-                            }
-                            continue;
-                        }
+                auto& source = sources.emplace_back();
+                source.shape = &incomingShape;
+                source.info = &info;
+                source.index = i;
+                source.element = otherMap.find(incomingShape._Shape, i);
+                source.modified = mapper.modified(source.element);
+                source.generated = mapper.generated(source.element);
+            }
+        }
+    }
 
-                        Data::IndexedName element
-                            = Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
+    std::vector<SourceNames> sourceNames(sources.size());
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(sources.size()),
+        [&](int index) {
+            try {
+                collectSourceNames(sources[index], infoMap, op, sourceNames[index]);
+            }
+            catch (...) {
+                sourceNames[index].failure = std::current_exception();
+            }
+        },
+        static_cast<int>(sources.size()) < parallelMappingThreshold
+    );
 
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
-                    }
-                    key.shapetype -= shapeOffset;
-                }
+    for (auto& names : sourceNames) {
+        if (names.failure) {
+            std::rethrow_exception(names.failure);
+        }
+        for (const auto& [error, message] : names.messages) {
+            if (error) {
+                FC_ERR(message);  // NOLINT
+            }
+            else {
+                FC_WARN(message);  // NOLINT
+            }
+        }
+        for (auto& entry : names.entries) {
+            if (getMappedName(entry.element)) {
+                continue;
             }
+            newNames[entry.element][entry.key] = std::move(entry.info);
         }
     }
 
@@ -4093,10 +4207,7 @@ TopoShape& TopoShape::makeElementSlices(
 {
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
-    int index = 0;
-    for (auto& distance : distances) {
-        cs.slice(++index, distance, wires);
-    }
+    cs.slices(distances, wires);
     return makeElementCompound(wires, op, SingleShapeCompoundCreationPolicy::returnShape);
 }
 
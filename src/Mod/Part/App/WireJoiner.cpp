@@ -54,12 +54,14 @@
 #include <TopExp_Explorer.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
 #include <IntRes2d_SequenceOfIntersectionPoint.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColStd_SequenceOfReal.hxx>
 #include <TColgp_SequenceOfPnt.hxx>
 
 #include <BRepTools_History.hxx>
 #include <ShapeBuild_ReShape.hxx>
 
+#include <exception>
 #include <unordered_map>
 #include <unordered_set>
 #include <deque>
@@ -133,6 +135,9 @@ public:
     bool doOutline = false;
     bool doTightBound = true;
 
+    /// Minimum number of edge pairs or edges for splitEdges() to work in parallel
+    std::size_t parallelThreshold = 64;
+
     std::string catchObject;
     int catchIteration {};
     int iteration = 0;
@@ -1051,7 +1056,22 @@ public:
         }
     };
 
-    void checkSelfIntersection(const EdgeInfo& info, std::set<IntersectInfo>& params) const
+    /// Intersections of an edge with another edge, or with itself if \c other is null, as found
+    /// by the narrow phase of splitEdges(). The parameters are in the order they were found.
+    struct PairIntersection
+    {
+        const EdgeInfo* info = nullptr;
+        const EdgeInfo* other = nullptr;
+        std::vector<std::pair<double, gp_Pnt>> params1;
+        std::vector<std::pair<double, gp_Pnt>> params2;
+        std::exception_ptr failure;
+    };
+
+    void checkSelfIntersection(
+        const EdgeInfo& info,
+        const TopoDS_Edge& edge,
+        PairIntersection& result
+    ) const
     {
         // Early return if checking for self intersection (only for non linear spline curves)
         if (info.type <= GeomAbs_Parabola || info.isLinear) {
@@ -1061,7 +1081,7 @@ public:
         TColgp_SequenceOfPnt points3d;
         TColStd_SequenceOfReal errors;
         TopoDS_Wire wire;
-        BRepBuilderAPI_MakeWire mkWire(info.edge);
+        BRepBuilderAPI_MakeWire mkWire(edge);
         if (!mkWire.IsDone()) {
             return;
         }
@@ -1083,30 +1103,29 @@ public:
 
         ENSURE(points2d.Length() == points3d.Length());
         for (int i = 1; i <= points2d.Length(); ++i) {
-            params.emplace(points2d(i).ParamOnFirst(), points3d(i), info.edge);
-            params.emplace(points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            result.params1.emplace_back(points2d(i).ParamOnFirst(), points3d(i));
+            result.params1.emplace_back(points2d(i).ParamOnSecond(), points3d(i));
         }
     }
 
     // This method was originally part of WireJoinerP::checkIntersection(), split to reduce
     // cognitive complexity
     bool checkIntersectionPlanar(
-        const EdgeInfo& info,
-        const EdgeInfo& other,
-        std::set<IntersectInfo>& params1,
-        std::set<IntersectInfo>& params2
-    )
+        const TopoDS_Edge& edge,
+        const TopoDS_Edge& otherEdge,
+        PairIntersection& result
+    ) const
     {
         gp_Pln pln;
-        bool planar = TopoShape(info.edge).findPlane(pln);
+        bool planar = TopoShape(edge).findPlane(pln);
         if (!planar) {
             TopoDS_Compound comp;
             builder.MakeCompound(comp);
-            builder.Add(comp, info.edge);
-            builder.Add(comp, other.edge);
+            builder.Add(comp, edge);
+            builder.Add(comp, otherEdge);
             planar = TopoShape(comp).findPlane(pln);
             if (!planar) {
-                BRepExtrema_DistShapeShape extss(info.edge, other.edge);
+                BRepExtrema_DistShapeShape extss(edge, otherEdge);
                 extss.Perform();
                 if (extss.IsDone() && extss.NbSolution() > 0) {
                     if (!extss.IsDone() || extss.NbSolution() <= 0 || extss.Value() >= myTol) {
@@ -1119,11 +1138,11 @@ public:
                     auto s2 = extss.SupportOnShape2(i);
                     if (s1.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS1(i, par);
-                        pushIntersection(params1, par, extss.PointOnShape1(i), other.edge);
+                        result.params1.emplace_back(par, extss.PointOnShape1(i));
                     }
                     if (s2.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS2(i, par);
-                        pushIntersection(params2, par, extss.PointOnShape2(i), info.edge);
+                        result.params2.emplace_back(par, extss.PointOnShape2(i));
                     }
                 }
                 return false;
@@ -1164,12 +1183,14 @@ public:
     static bool checkIntersectionMakeWire(
         const EdgeInfo& info,
         const EdgeInfo& other,
+        const TopoDS_Edge& edge,
+        const TopoDS_Edge& otherEdge,
         int& idx,
         TopoDS_Wire& wire
     )
     {
-        BRepBuilderAPI_MakeWire mkWire(info.edge);
-        mkWire.Add(other.edge);
+        BRepBuilderAPI_MakeWire mkWire(edge);
+        mkWire.Add(otherEdge);
         if (mkWire.IsDone()) {
             idx = 2;
         }
@@ -1182,7 +1203,7 @@ public:
             }
 
             mkWire.Add(mkEdge.Edge());
-            mkWire.Add(other.edge);
+            mkWire.Add(otherEdge);
         }
 
         if (!checkIntersectionWireDone(mkWire)) {
@@ -1221,11 +1242,12 @@ public:
     void checkIntersection(
         const EdgeInfo& info,
         const EdgeInfo& other,
-        std::set<IntersectInfo>& params1,
-        std::set<IntersectInfo>& params2
-    )
+        const TopoDS_Edge& edge,
+        const TopoDS_Edge& otherEdge,
+        PairIntersection& result
+    ) const
     {
-        if (!checkIntersectionPlanar(info, other, params1, params2)) {
+        if (!checkIntersectionPlanar(edge, otherEdge, result)) {
             return;
         }
 
@@ -1241,7 +1263,7 @@ public:
         TopoDS_Wire wire;
         int idx = 0;
 
-        if (!checkIntersectionMakeWire(info, other, idx, wire)) {
+        if (!checkIntersectionMakeWire(info, other, edge, otherEdge, idx, wire)) {
             return;
         }
 
@@ -1256,8 +1278,8 @@ public:
 
         ENSURE(points2d.Length() == points3d.Length());
         for (int i = 1; i <= points2d.Length(); ++i) {
-            pushIntersection(params1, points2d(i).ParamOnFirst(), points3d(i), other.edge);
-            pushIntersection(params2, points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            result.params1.emplace_back(points2d(i).ParamOnFirst(), points3d(i));
+            result.params2.emplace_back(points2d(i).ParamOnSecond(), points3d(i));
         }
     }
 
@@ -1352,6 +1374,35 @@ public:
         }
     }
 
+    // This method was originally part of WireJoinerP::splitEdges(), split to reduce cognitive
+    // complexity
+    void splitEdgesCheckPair(PairIntersection& pair) const
+    {
+        // OCC may update the tolerance or the pcurves of edges and vertices it works on, and the
+        // same edge takes part in several pairs. So give each check its own copy of the topology,
+        // sharing the geometry. This is done in serial runs as well, so that both work on the
+        // same input.
+        auto copyEdge = [](const TopoDS_Edge& edge) {
+            return TopoDS::Edge(BRepBuilderAPI_Copy(edge, Standard_False).Shape());
+        };
+        try {
+            if (!pair.other) {
+                checkSelfIntersection(*pair.info, copyEdge(pair.info->edge), pair);
+                return;
+            }
+            checkIntersection(
+                *pair.info,
+                *pair.other,
+                copyEdge(pair.info->edge),
+                copyEdge(pair.other->edge),
+                pair
+            );
+        }
+        catch (...) {
+            pair.failure = std::current_exception();
+        }
+    }
+
     // Try splitting any edges that intersects other edge
     void splitEdges()
     {
@@ -1366,68 +1417,103 @@ public:
             new Base::SequencerLauncher("Splitting edges", edges.size())
         );
 
+        // Broad phase: collect the candidate pairs from the bounding box tree
+        std::vector<PairIntersection> pairs;
         idx = 0;
         for (auto& info : edges) {
-            seq->next(true);
             ++idx;
-            auto& params = intersects[&info];
-            checkSelfIntersection(info, params);
-
+            pairs.emplace_back().info = &info;
             for (auto vit = boxMap.qbegin(bgi::intersects(info.box)); vit != boxMap.qend(); ++vit) {
                 const auto& other = *(*vit);
                 if (other.iteration <= idx) {
                     // means the edge is before us, and we've already checked intersection
                     continue;
                 }
-                checkIntersection(info, other, params, intersects[&other]);
+                auto& pair = pairs.emplace_back();
+                pair.info = &info;
+                pair.other = &other;
             }
         }
 
-        idx = 0;
-        std::vector<SplitInfo> splits;
-        for (auto it = edges.begin(); it != edges.end();) {
-            ++idx;
-            auto iter = intersects.find(&(*it));
-            if (iter == intersects.end()) {
-                ++it;
-                continue;
+        // Narrow phase. Shown shapes for debugging are created as document objects, so those
+        // only work from the main thread.
+        bool checkInParallel = pairs.size() >= parallelThreshold && !canShowShape();
+        OSD_Parallel::For(
+            0,
+            static_cast<int>(pairs.size()),
+            [&](int index) { splitEdgesCheckPair(pairs[index]); },
+            !checkInParallel
+        );
+
+        // Merge the results in the same order as the pairs were found, so that the outcome does
+        // not depend on thread scheduling
+        for (const auto& pair : pairs) {
+            if (pair.failure) {
+                std::rethrow_exception(pair.failure);
             }
-            auto& info = *it;
-            auto& params = iter->second;
-            if (params.empty()) {
-                ++it;
+            auto& params = intersects[pair.info];
+            if (!pair.other) {
+                seq->next(true);
+                for (const auto& [param, point] : pair.params1) {
+                    params.emplace(param, point, pair.info->edge);
+                }
                 continue;
             }
-
-            auto itParam = params.begin();
-            if (itParam->point.SquareDistance(info.p1) < myTol2) {
-                params.erase(itParam);
+            auto& otherParams = intersects[pair.other];
+            for (const auto& [param, point] : pair.params1) {
+                pushIntersection(params, param, point, pair.other->edge);
             }
-            params.emplace(info.firstParam, info.p1, TopoDS_Shape());
-            itParam = params.end();
-            --itParam;
-            if (itParam->point.SquareDistance(info.p2) < myTol2) {
-                params.erase(itParam);
+            for (const auto& [param, point] : pair.params2) {
+                pushIntersection(otherParams, param, point, pair.info->edge);
             }
-            params.emplace(info.lastParam, info.p2, TopoDS_Shape());
+        }
 
-            if (params.size() <= 2) {
-                ++it;
-                continue;
+        // Build the pieces of each intersected edge, again in parallel
+        std::vector<Edges::iterator> edgesToSplit;
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            auto iter = intersects.find(&(*it));
+            if (iter != intersects.end() && !iter->second.empty()) {
+                edgesToSplit.push_back(it);
             }
+        }
+        std::vector<std::vector<SplitInfo>> splitsOfEdge(edgesToSplit.size());
+        OSD_Parallel::For(
+            0,
+            static_cast<int>(edgesToSplit.size()),
+            [&](int index) {
+                auto& info = *edgesToSplit[index];
+                auto& params = intersects.find(&info)->second;
+
+                auto itParam = params.begin();
+                if (itParam->point.SquareDistance(info.p1) < myTol2) {
+                    params.erase(itParam);
+                }
+                params.emplace(info.firstParam, info.p1, TopoDS_Shape());
+                itParam = params.end();
+                --itParam;
+                if (itParam->point.SquareDistance(info.p2) < myTol2) {
+                    params.erase(itParam);
+                }
+                params.emplace(info.lastParam, info.p2, TopoDS_Shape());
 
-            splits.clear();
-            itParam = params.begin();
+                if (params.size() <= 2) {
+                    return;
+                }
 
-            splitEdgesMakeEdges(itParam, params, info, splits);
+                itParam = params.begin();
+                splitEdgesMakeEdges(itParam, params, info, splitsOfEdge[index]);
+            },
+            edgesToSplit.size() < parallelThreshold || canShowShape()
+        );
 
+        for (std::size_t index = 0; index < edgesToSplit.size(); ++index) {
+            const auto& splits = splitsOfEdge[index];
             if (splits.size() <= 1) {
-                ++it;
                 continue;
             }
 
-            showShape(info.edge, "remove");
-            auto removedEdge = info.edge;
+            auto it = edgesToSplit[index];
+            showShape(it->edge, "remove");
             it = remove(it);
             for (const auto& split : splits) {
                 if (!add(split.edge, false, split.bbox, it)) {
@@ -3152,6 +3238,11 @@ void WireJoiner::setMergeEdges(bool enable)
     }
 }
 
+void WireJoiner::setParallelThreshold(std::size_t count)
+{
+    pimpl->parallelThreshold = count;
+}
+
 void WireJoiner::setTolerance(double tol, double atol)
 {
     if (tol >= 0 && tol != pimpl->myTol) {
@@ -49,6 +49,8 @@ public:
     void setSplitEdges(bool enable = true);
     void setMergeEdges(bool enable = true);
     void setTolerance(double tolerance, double atol = 0.0);
+    /// Minimum number of edge pairs to check them in parallel, the result does not depend on it
+    void setParallelThreshold(std::size_t count);
 
     bool getOpenWires(TopoShape& shape, const char* op = "", bool noOriginal = true);
     bool getResultWires(TopoShape& shape, const char* op = "");
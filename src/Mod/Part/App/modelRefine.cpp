@@ -24,6 +24,7 @@
 
 
 #include <algorithm>
+#include <exception>
 #include <numbers>
 #include <iterator>
 #include <Bnd_Box.hxx>
@@ -46,10 +47,12 @@
 #include <Geom_Surface.hxx>
 #include <GeomAdaptor_Surface.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <gp.hxx>
 #include <gp_Ax3.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Pln.hxx>
 #include <GProp_GProps.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Curve.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
@@ -257,25 +260,49 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face& face, FaceVectorTyp
 
 void FaceEqualitySplitter::split(const FaceVectorType& faces, FaceTypedBase* object)
 {
+    // Each face joins the first created group whose first face is equal to it. Instead of
+    // comparing against every group, the groups are looked up by their surface key, so that only
+    // the few groups with a close enough key need the full comparison.
     std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
-    FaceVectorType::const_iterator faceIt;
-    for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt) {
-        bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt) {
-            if (object->isEqual((*tempIt).front(), *faceIt)) {
-                (*tempIt).push_back(*faceIt);
-                foundMatch = true;
-                break;
+    std::multimap<double, std::size_t> keyedGroups;
+    std::vector<std::size_t> unkeyedGroups;
+    for (const auto& face : faces) {
+        double key {};
+        double tolerance {};
+        bool keyed = object->getSurfaceKey(face, key, tolerance);
+
+        std::size_t match = tempVector.size();
+        auto checkGroup = [&](std::size_t index) {
+            if (index < match && object->isEqual(tempVector[index].front(), face)) {
+                match = index;
+            }
+        };
+        if (keyed) {
+            auto end = keyedGroups.upper_bound(key + tolerance);
+            for (auto it = keyedGroups.lower_bound(key - tolerance); it != end; ++it) {
+                checkGroup(it->second);
+            }
+            for (auto index : unkeyedGroups) {
+                checkGroup(index);
+            }
+        }
+        else {
+            for (std::size_t index = 0; index < tempVector.size(); ++index) {
+                checkGroup(index);
             }
         }
-        if (!foundMatch) {
-            FaceVectorType another;
-            another.reserve(faces.size());
-            another.push_back(*faceIt);
-            tempVector.push_back(another);
+
+        if (match < tempVector.size()) {
+            tempVector[match].push_back(face);
+            continue;
+        }
+        if (keyed) {
+            keyedGroups.emplace(key, tempVector.size());
+        }
+        else {
+            unkeyedGroups.push_back(tempVector.size());
         }
+        tempVector.emplace_back(1, face);
     }
     std::vector<FaceVectorType>::iterator it;
     for (it = tempVector.begin(); it != tempVector.end(); ++it) {
@@ -288,6 +315,15 @@ void FaceEqualitySplitter::split(const FaceVectorType& faces, FaceTypedBase* obj
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool FaceTypedBase::getSurfaceKey(
+    const TopoDS_Face& /*face*/,
+    double& /*key*/,
+    double& /*tolerance*/
+) const
+{
+    return false;
+}
+
 GeomAbs_SurfaceType FaceTypedBase::getFaceType(const TopoDS_Face& faceIn)
 {
     Handle(Geom_Surface) surface = BRep_Tool::Surface(faceIn);
@@ -389,6 +425,21 @@ GeomAbs_SurfaceType FaceTypedPlane::getType() const
     return GeomAbs_Plane;
 }
 
+bool FaceTypedPlane::getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull()) {
+        return false;
+    }
+    // Use the distance of the plane to the origin. For isEqual() the location of this face is
+    // within confusion of the other plane, whose normal may deviate by confusion as an angle, so
+    // the other distance may differ by up to confusion times (1 + distance of our location).
+    gp_Pln plane(planeSurface->Pln());
+    key = plane.Distance(gp::Origin());
+    tolerance = 2.0 * Precision::Confusion() * (1.0 + plane.Location().XYZ().Modulus());
+    return true;
+}
+
 TopoDS_Face FaceTypedPlane::buildFace(const FaceVectorType& faces) const
 {
     std::vector<TopoDS_Wire> wires;
@@ -498,6 +549,17 @@ GeomAbs_SurfaceType FaceTypedCylinder::getType() const
     return GeomAbs_Cylinder;
 }
 
+bool FaceTypedCylinder::getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_CylindricalSurface) surface = getGeomCylinder(face);
+    if (surface.IsNull()) {
+        return false;
+    }
+    key = surface->Radius();
+    tolerance = 2.0 * Precision::Confusion();
+    return true;
+}
+
 // Auxiliary method
 const TopoDS_Face fixFace(const TopoDS_Face& f)
 {
@@ -1040,6 +1102,19 @@ GeomAbs_SurfaceType FaceTypedBSpline::getType() const
     return GeomAbs_BSplineSurface;
 }
 
+bool FaceTypedBSpline::getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_BSplineSurface)
+        surface = Handle(Geom_BSplineSurface)::DownCast(BRep_Tool::Surface(face));
+    if (surface.IsNull()) {
+        return false;
+    }
+    // Equal surfaces have all their poles within confusion
+    key = surface->Pole(1, 1).X();
+    tolerance = 2.0 * Precision::Confusion();
+    return true;
+}
+
 TopoDS_Face FaceTypedBSpline::buildFace(const FaceVectorType& faces) const
 {
     std::vector<TopoDS_Wire> wires;
@@ -1107,6 +1182,80 @@ FaceTypedBSpline& ModelRefine::getBSplineObject()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+struct UniteTask
+{
+    FaceTypedBase* object;
+    FaceVectorType faces;
+    TopoDS_Face newFace;
+    std::exception_ptr failure;
+};
+
+// Builds the united face of each task. The tasks are independent apart from their shared
+// boundary, which OCC may update in place (e.g. pcurves and tolerances of edges and vertices), so
+// they are built in waves, and no two tasks of one wave share a vertex.
+void buildUnitedFaces(std::vector<UniteTask>& tasks)
+{
+    TopTools_IndexedMapOfShape vertexMap;
+    std::vector<std::vector<std::size_t>> vertexTasks;
+    std::vector<std::size_t> waveOfTask(tasks.size());
+    std::vector<std::vector<std::size_t>> waves;
+    for (std::size_t index = 0; index < tasks.size(); ++index) {
+        std::vector<std::size_t> usedWaves;
+        for (const auto& face : tasks[index].faces) {
+            for (TopExp_Explorer xp(face, TopAbs_VERTEX); xp.More(); xp.Next()) {
+                auto vertexIndex = static_cast<std::size_t>(vertexMap.Add(xp.Current()));
+                if (vertexIndex > vertexTasks.size()) {
+                    vertexTasks.resize(vertexIndex);
+                }
+                auto& users = vertexTasks[vertexIndex - 1];
+                if (!users.empty() && users.back() == index) {
+                    continue;
+                }
+                for (auto other : users) {
+                    usedWaves.push_back(waveOfTask[other]);
+                }
+                users.push_back(index);
+            }
+        }
+        // Take the lowest wave not used by a neighbour
+        std::sort(usedWaves.begin(), usedWaves.end());
+        std::size_t wave = 0;
+        for (auto used : usedWaves) {
+            if (used > wave) {
+                break;
+            }
+            if (used == wave) {
+                ++wave;
+            }
+        }
+        waveOfTask[index] = wave;
+        if (wave >= waves.size()) {
+            waves.resize(wave + 1);
+        }
+        waves[wave].push_back(index);
+    }
+
+    for (const auto& wave : waves) {
+        OSD_Parallel::For(
+            0,
+            static_cast<int>(wave.size()),
+            [&](int index) {
+                auto& task = tasks[wave[index]];
+                try {
+                    task.newFace = task.object->buildFace(task.faces);
+                }
+                catch (...) {
+                    task.failure = std::current_exception();
+                }
+            },
+            wave.size() < 2
+        );
+    }
+}
+}  // namespace
+
 FaceUniter::FaceUniter(const TopoDS_Shell& shellIn)
     : modifiedSignal(false)
 {
@@ -1139,6 +1288,8 @@ bool FaceUniter::process()
 
     ModelRefine::FaceAdjacencySplitter adjacencySplitter(workShell);
 
+    // Collect all groups of faces to unite first, so that their faces can be built in parallel
+    std::vector<UniteTask> tasks;
     for (typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt) {
         ModelRefine::FaceVectorType typedFaces = splitter.getTypedFaceVector((*typeIt)->getType());
         ModelRefine::FaceEqualitySplitter equalitySplitter;
@@ -1146,44 +1297,39 @@ bool FaceUniter::process()
         for (std::size_t indexEquality(0); indexEquality < equalitySplitter.getGroupCount();
              ++indexEquality) {
             adjacencySplitter.split(equalitySplitter.getGroup(indexEquality));
-            //            std::cout << "      adjacency group count: " <<
-            //            adjacencySplitter.getGroupCount() << std::endl;
             for (std::size_t adjacentIndex(0); adjacentIndex < adjacencySplitter.getGroupCount();
                  ++adjacentIndex) {
-                //                    std::cout << "         face count is: " <<
-                //                    adjacencySplitter.getGroup(adjacentIndex).size() << std::endl;
-                TopoDS_Face newFace = (*typeIt)->buildFace(adjacencySplitter.getGroup(adjacentIndex));
-                if (!newFace.IsNull()) {
-                    // the created face should have the same orientation as the input faces
-                    const FaceVectorType& faces = adjacencySplitter.getGroup(adjacentIndex);
-                    if (!faces.empty() && newFace.Orientation() != faces[0].Orientation()) {
-                        checkFinalShell = true;
-                    }
-                    facesToSew.push_back(newFace);
-
-                    // This reserve is probably not actually an improvement over letting
-                    // emplace_back allocate as needed. Leaving the code here for study if someone
-                    // wants to measure it. Coverity issue 356645. - chennes, March 2025
-                    // if (facesToRemove.capacity() <= facesToRemove.size() +
-                    // adjacencySplitter.getGroup(adjacentIndex).size())
-                    //    facesToRemove.reserve(facesToRemove.size() +
-                    //    adjacencySplitter.getGroup(adjacentIndex).size());
-
-                    FaceVectorType temp = adjacencySplitter.getGroup(adjacentIndex);
-                    facesToRemove.insert(facesToRemove.end(), temp.begin(), temp.end());
-                    // the first shape will be marked as modified, i.e. replaced by newFace, all
-                    // others are marked as deleted jrheinlaender: IMHO this is not correct because
-                    // references to the deleted faces will be broken, whereas they should be
-                    // replaced by references to the new face. To achieve this all shapes should be
-                    // marked as modified, producing one single new face. This is the inverse
-                    // behaviour to faces that are split e.g. by a boolean cut, where one old shape
-                    // is marked as modified, producing multiple new shapes
-                    if (!temp.empty()) {
-                        for (const auto& f : temp) {
-                            modifiedShapes.emplace_back(f, newFace);
-                        }
-                    }
-                }
+                tasks.push_back({*typeIt, adjacencySplitter.getGroup(adjacentIndex), {}, {}});
+            }
+        }
+    }
+    buildUnitedFaces(tasks);
+
+    // Record the results in the order the groups were found, so the history does not depend on
+    // the scheduling of the threads
+    for (const auto& task : tasks) {
+        if (task.failure) {
+            std::rethrow_exception(task.failure);
+        }
+        const TopoDS_Face& newFace = task.newFace;
+        if (!newFace.IsNull()) {
+            // the created face should have the same orientation as the input faces
+            const FaceVectorType& faces = task.faces;
+            if (!faces.empty() && newFace.Orientation() != faces[0].Orientation()) {
+                checkFinalShell = true;
+            }
+            facesToSew.push_back(newFace);
+
+            facesToRemove.insert(facesToRemove.end(), faces.begin(), faces.end());
+            // the first shape will be marked as modified, i.e. replaced by newFace, all
+            // others are marked as deleted jrheinlaender: IMHO this is not correct because
+            // references to the deleted faces will be broken, whereas they should be
+            // replaced by references to the new face. To achieve this all shapes should be
+            // marked as modified, producing one single new face. This is the inverse
+            // behaviour to faces that are split e.g. by a boolean cut, where one old shape
+            // is marked as modified, producing multiple new shapes
+            for (const auto& f : faces) {
+                modifiedShapes.emplace_back(f, newFace);
             }
         }
     }
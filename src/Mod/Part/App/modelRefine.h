@@ -70,6 +70,14 @@ public:
     virtual GeomAbs_SurfaceType getType() const = 0;
     virtual TopoDS_Face buildFace(const FaceVectorType& faces) const = 0;
 
+    /** Scalar key of the face surface, used to find candidates for isEqual()
+     *
+     * For isEqual(other, face) to be true, the key of \a other must be within \a tolerance of
+     * the key of \a face. Returns false if the face has no key, in which case it is compared
+     * against all others.
+     */
+    virtual bool getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const;
+
     static GeomAbs_SurfaceType getFaceType(const TopoDS_Face& faceIn);
 
 protected:
@@ -89,6 +97,7 @@ public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
+    bool getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     friend FaceTypedPlane& getPlaneObject();
 };
 FaceTypedPlane& getPlaneObject();
@@ -102,6 +111,7 @@ public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
+    bool getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     friend FaceTypedCylinder& getCylinderObject();
 
 protected:
@@ -121,6 +131,7 @@ public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
+    bool getSurfaceKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     friend FaceTypedBSpline& getBSplineObject();
 };
 FaceTypedBSpline& getBSplineObject();
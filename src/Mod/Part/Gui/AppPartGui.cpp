@@ -46,6 +46,7 @@
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
 #include "SoFCShapeObject.h"
+#include "TessellationCache.h"
 #include "ViewProvider.h"
 #include "ViewProvider2DObject.h"
 #include "ViewProviderAttachExtension.h"
@@ -161,6 +162,7 @@ PyMOD_INIT_FUNC(PartGui)
 
     // clang-format off
     PartGui::PropertyEnumAttacherItem               ::init();
+    PartGui::PropertyTessellationCache              ::init();
     PartGui::SoBrepFaceSet                          ::initClass();
     PartGui::SoBrepEdgeSet                          ::initClass();
     PartGui::SoBrepPointSet                         ::initClass();
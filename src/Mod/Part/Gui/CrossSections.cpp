@@ -26,6 +26,7 @@
 
 #include <QFuture>
 #include <QKeyEvent>
+#include <QStringList>
 
 #include <BRep_Builder.hxx>
 #include <TopoDS.hxx>
@@ -285,8 +286,14 @@ bool CrossSections::apply()
         section->purgeTouched();
     }
 #else
-    Base::SequencerLauncher seq("Cross-sections…", obj.size() * (d.size() + 1));
+    Base::SequencerLauncher seq("Cross-sections…", obj.size() + 1);
     try {
+        // all planes are cut in one call, so the shape is prepared only once
+        QStringList distances;
+        for (double jt : d) {
+            distances << QString::number(jt);
+        }
+
         Gui::Command::runCommand(Gui::Command::App, "import Part\n");
         Gui::Command::runCommand(Gui::Command::App, "from FreeCAD import Base\n");
         for (auto it : obj) {
@@ -296,29 +303,17 @@ bool CrossSections::apply()
             Gui::Command::runCommand(
                 Gui::Command::App,
                 QStringLiteral(
-                    "wires=list()\n"
                     "shape=FreeCAD.getDocument(\"%1\").%2.Shape\n"
+                    "wires=shape.slices(Base.Vector(%3,%4,%5),[%6]).Wires\n"
                 )
                     .arg(QLatin1String(doc->getName()), QLatin1String(it->getNameInDocument()))
+                    .arg(a)
+                    .arg(b)
+                    .arg(c)
+                    .arg(distances.join(QLatin1String(",")))
                     .toLatin1()
             );
 
-            for (double jt : d) {
-                Gui::Command::runCommand(
-                    Gui::Command::App,
-                    QStringLiteral(
-                        "for i in shape.slice(Base.Vector(%1,%2,%3),%4):\n"
-                        "    wires.append(i)\n"
-                    )
-                        .arg(a)
-                        .arg(b)
-                        .arg(c)
-                        .arg(jt)
-                        .toLatin1()
-                );
-                seq.next();
-            }
-
             Gui::Command::runCommand(
                 Gui::Command::App,
                 QStringLiteral(
@@ -331,6 +326,7 @@ bool CrossSections::apply()
                     .arg(QLatin1String(doc->getName()), QLatin1String(s.c_str()))
                     .toLatin1()
             );
+            seq.next();
         }
         seq.next();
     }
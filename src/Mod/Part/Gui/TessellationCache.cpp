@@ -0,0 +1,674 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <sstream>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <GeomTools.hxx>
+#include <Poly_Array1OfTriangle.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+#include <TColgp_Array1OfDir.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Vertex.hxx>
+
+#include <QByteArray>
+#include <QCryptographicHash>
+
+#include <App/Application.h>
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/PyObjectBase.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
+#include <Mod/Part/App/Tools.h>
+
+#include "TessellationCache.h"
+
+
+using namespace PartGui;
+
+namespace
+{
+constexpr uint32_t cacheMagic = 0x54455353;  // 'TESS'
+constexpr uint32_t cacheVersion = 2;
+constexpr double deflectionTolerance = 0.1;
+// The counts in a file are only trusted up to this size, larger arrays grow while being read
+constexpr uint32_t reserveLimit = 4096;
+// The keys are SHA-1 digests
+constexpr uint32_t keySize = 20;
+
+ParameterGrp::handle getParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+}
+
+void writeLocation(std::ostream& str, const TopLoc_Location& loc)
+{
+    const gp_Trsf& trsf = loc.Transformation();
+    for (int row = 1; row <= 3; row++) {
+        for (int col = 1; col <= 4; col++) {
+            str << trsf.Value(row, col) << ' ';
+        }
+    }
+    str << '\n';
+}
+
+void writeVector(Base::OutputStream& str, const std::vector<Base::Vector3f>& vec)
+{
+    str << static_cast<uint32_t>(vec.size());
+    for (const auto& it : vec) {
+        str << it.x << it.y << it.z;
+    }
+}
+
+void checkStream(const Base::InputStream& str)
+{
+    if (!str) {
+        throw Base::BadFormatError("Unexpected end of tessellation cache");
+    }
+}
+
+uint32_t readCount(Base::InputStream& str)
+{
+    uint32_t count {};
+    str >> count;
+    checkStream(str);
+    return count;
+}
+
+void readVector(Base::InputStream& str, std::vector<Base::Vector3f>& vec)
+{
+    uint32_t count = readCount(str);
+    vec.clear();
+    vec.reserve(std::min(count, reserveLimit));
+    for (uint32_t i = 0; i < count; i++) {
+        Base::Vector3f pnt;
+        str >> pnt.x >> pnt.y >> pnt.z;
+        checkStream(str);
+        vec.push_back(pnt);
+    }
+}
+
+void writeIndices(Base::OutputStream& str, const std::vector<int32_t>& vec)
+{
+    str << static_cast<uint32_t>(vec.size());
+    for (int32_t it : vec) {
+        str << it;
+    }
+}
+
+void readIndices(Base::InputStream& str, std::vector<int32_t>& vec, int32_t numNodes)
+{
+    uint32_t count = readCount(str);
+    vec.clear();
+    vec.reserve(std::min(count, reserveLimit));
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t index {};
+        str >> index;
+        checkStream(str);
+        if (index < 0 || index >= numNodes) {
+            throw Base::BadFormatError("Invalid node index in tessellation cache");
+        }
+        vec.push_back(index);
+    }
+}
+
+void writeParameters(Base::OutputStream& str, const std::vector<double>& vec)
+{
+    str << static_cast<uint32_t>(vec.size());
+    for (double it : vec) {
+        str << it;
+    }
+}
+
+void readParameters(Base::InputStream& str, std::vector<double>& vec)
+{
+    uint32_t count = readCount(str);
+    vec.clear();
+    vec.reserve(std::min(count, reserveLimit));
+    for (uint32_t i = 0; i < count; i++) {
+        double value {};
+        str >> value;
+        checkStream(str);
+        vec.push_back(value);
+    }
+}
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+std::shared_ptr<FaceTessellation>
+FaceTessellation::fromFace(const TopoDS_Face& face, double deflection, bool normalsFromUV)
+{
+    // use the TShape of the face so that the data can be shared by all instances
+    TopoDS_Face base = TopoDS::Face(face.Located(TopLoc_Location()));
+    base.Orientation(TopAbs_FORWARD);
+
+    TopLoc_Location loc;
+    Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(base, loc);
+    if (mesh.IsNull()) {
+        mesh = Part::Tools::triangulationOfFace(base);
+    }
+    if (mesh.IsNull()) {
+        return {};
+    }
+
+    auto result = std::make_shared<FaceTessellation>();
+    result->deflection = deflection;
+
+    int nbNodes = mesh->NbNodes();
+    int nbTriangles = mesh->NbTriangles();
+    result->nodes.reserve(nbNodes);
+    for (int i = 1; i <= nbNodes; i++) {
+#if OCC_VERSION_HEX < 0x070600
+        gp_Pnt pnt = mesh->Nodes()(i);
+#else
+        gp_Pnt pnt = mesh->Node(i);
+#endif
+        result->nodes.emplace_back(float(pnt.X()), float(pnt.Y()), float(pnt.Z()));
+    }
+
+    if (normalsFromUV) {
+        TColgp_Array1OfDir normals(1, nbNodes);
+        Part::Tools::getPointNormals(base, mesh, normals);
+        result->normals.reserve(nbNodes);
+        for (int i = 1; i <= nbNodes; i++) {
+            const gp_Dir& dir = normals(i);
+            result->normals.emplace_back(float(dir.X()), float(dir.Y()), float(dir.Z()));
+        }
+    }
+
+    result->triangles.reserve(3 * nbTriangles);
+    for (int i = 1; i <= nbTriangles; i++) {
+        Standard_Integer n1 {}, n2 {}, n3 {};
+#if OCC_VERSION_HEX < 0x070600
+        mesh->Triangles()(i).Get(n1, n2, n3);
+#else
+        mesh->Triangle(i).Get(n1, n2, n3);
+#endif
+        result->triangles.push_back(n1 - 1);
+        result->triangles.push_back(n2 - 1);
+        result->triangles.push_back(n3 - 1);
+    }
+
+    for (TopExp_Explorer xp(base, TopAbs_EDGE); xp.More(); xp.Next()) {
+        std::vector<int32_t> polygon;
+        std::vector<double> parameters;
+        Handle(Poly_PolygonOnTriangulation) aPoly
+            = BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(xp.Current()), mesh, loc);
+        if (!aPoly.IsNull()) {
+            const TColStd_Array1OfInteger& indices = aPoly->Nodes();
+            polygon.reserve(indices.Length());
+            for (Standard_Integer i = indices.Lower(); i <= indices.Upper(); i++) {
+                polygon.push_back(indices(i) - 1);
+            }
+            if (aPoly->HasParameters()) {
+                const TColStd_Array1OfReal& values = aPoly->Parameters()->Array1();
+                parameters.assign(values.begin(), values.end());
+            }
+        }
+        result->edges.push_back(std::move(polygon));
+        result->edgeParameters.push_back(std::move(parameters));
+    }
+
+    return result;
+}
+
+bool FaceTessellation::canAttachTo(const TopoDS_Face& face) const
+{
+    if (nodes.empty() || triangles.empty() || edgeParameters.size() != edges.size()) {
+        return false;
+    }
+
+    std::size_t numEdges = 0;
+    for (TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+        numEdges++;
+    }
+    if (numEdges != edges.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        if (edges[i].empty() || edges[i].size() != edgeParameters[i].size()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FaceTessellation::attachTo(const TopoDS_Face& face) const
+{
+    TopoDS_Face base = TopoDS::Face(face.Located(TopLoc_Location()));
+    base.Orientation(TopAbs_FORWARD);
+
+    TColgp_Array1OfPnt points(1, static_cast<int>(nodes.size()));
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        const Base::Vector3f& pnt = nodes[i];
+        points(static_cast<int>(i) + 1) = gp_Pnt(pnt.x, pnt.y, pnt.z);
+    }
+    Poly_Array1OfTriangle facets(1, static_cast<int>(triangles.size() / 3));
+    for (int i = facets.Lower(); i <= facets.Upper(); i++) {
+        const int32_t* tria = &triangles[3 * (i - 1)];
+        facets(i) = Poly_Triangle(tria[0] + 1, tria[1] + 1, tria[2] + 1);
+    }
+
+    Handle(Poly_Triangulation) mesh = new Poly_Triangulation(points, facets);
+    mesh->Deflection(deflection);
+
+    BRep_Builder builder;
+    builder.UpdateFace(base, mesh);
+
+    auto makePolygon = [this](std::size_t index) {
+        const auto& polygon = edges[index];
+        const auto& parameters = edgeParameters[index];
+        TColStd_Array1OfInteger indices(1, static_cast<int>(polygon.size()));
+        TColStd_Array1OfReal values(1, static_cast<int>(parameters.size()));
+        for (std::size_t i = 0; i < polygon.size(); i++) {
+            indices(static_cast<int>(i) + 1) = polygon[i] + 1;
+            values(static_cast<int>(i) + 1) = parameters[i];
+        }
+        Handle(Poly_PolygonOnTriangulation) aPoly
+            = new Poly_PolygonOnTriangulation(indices, values);
+        aPoly->Deflection(deflection);
+        return aPoly;
+    };
+
+    // both polygons of a seam edge must be set at once
+    std::vector<std::pair<TopoDS_Edge, Handle(Poly_PolygonOnTriangulation)>> seams;
+    std::size_t index = 0;
+    for (TopExp_Explorer xp(base, TopAbs_EDGE); xp.More(); xp.Next(), index++) {
+        const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+        Handle(Poly_PolygonOnTriangulation) aPoly = makePolygon(index);
+        if (!BRep_Tool::IsClosed(edge, base)) {
+            builder.UpdateEdge(edge, aPoly, mesh, TopLoc_Location());
+            continue;
+        }
+
+        auto it = std::find_if(seams.begin(), seams.end(), [&edge](const auto& seam) {
+            return seam.first.IsSame(edge);
+        });
+        if (it == seams.end()) {
+            seams.emplace_back(edge, aPoly);
+            continue;
+        }
+
+        TopoDS_Edge forward = TopoDS::Edge(edge.Oriented(TopAbs_FORWARD));
+        if (edge.Orientation() == TopAbs_FORWARD) {
+            builder.UpdateEdge(forward, aPoly, it->second, mesh, TopLoc_Location());
+        }
+        else {
+            builder.UpdateEdge(forward, it->second, aPoly, mesh, TopLoc_Location());
+        }
+    }
+}
+
+std::size_t FaceTessellation::getMemSize() const
+{
+    std::size_t size = sizeof(FaceTessellation);
+    size += (nodes.size() + normals.size()) * sizeof(Base::Vector3f);
+    size += triangles.size() * sizeof(int32_t);
+    for (const auto& it : edges) {
+        size += sizeof(it) + it.size() * sizeof(int32_t);
+    }
+    for (const auto& it : edgeParameters) {
+        size += sizeof(it) + it.size() * sizeof(double);
+    }
+    return size;
+}
+
+// ----------------------------------------------------------------------------
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+TessellationCache::TessellationCache()
+{
+    // the size is given in MB, zero disables the cache
+    maxSize = std::size_t(getParameter()->GetUnsigned("TessellationCacheSize", 256)) << 20;
+}
+
+std::string TessellationCache::computeKey(const TopoDS_Face& face, double angle, bool normalsFromUV)
+{
+    TopoDS_Face base = TopoDS::Face(face.Located(TopLoc_Location()));
+    base.Orientation(TopAbs_FORWARD);
+
+    // The geometry is written with full precision. The edges are part of the key because they
+    // bound the face and because the order of their polygons must match.
+    std::ostringstream str;
+    str.precision(17);
+    str << angle << ' ' << normalsFromUV << '\n';
+
+    TopLoc_Location loc;
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(base, loc);
+    if (surface.IsNull()) {
+        return {};
+    }
+    GeomTools::Write(surface, str);
+    writeLocation(str, loc);
+
+    for (TopExp_Explorer xp(base, TopAbs_EDGE); xp.More(); xp.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+        str << edge.Orientation() << ' ' << BRep_Tool::Degenerated(edge) << '\n';
+
+        Standard_Real first {}, last {};
+        Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, loc, first, last);
+        if (!curve.IsNull()) {
+            GeomTools::Write(curve, str);
+            writeLocation(str, loc);
+            str << first << ' ' << last << '\n';
+        }
+
+        for (TopExp_Explorer xv(edge, TopAbs_VERTEX); xv.More(); xv.Next()) {
+            gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(xv.Current()));
+            str << pnt.X() << ' ' << pnt.Y() << ' ' << pnt.Z() << '\n';
+        }
+    }
+
+    std::string data = str.str();
+    QByteArray digest = QCryptographicHash::hash(
+        QByteArray::fromRawData(data.data(), static_cast<int>(data.size())),
+        QCryptographicHash::Sha1
+    );
+    return {digest.constData(), static_cast<std::size_t>(digest.size())};
+}
+
+bool TessellationCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxSize > 0;
+}
+
+void TessellationCache::setMaxSize(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxSize = bytes;
+    shrink(maxSize);
+}
+
+std::size_t TessellationCache::getMaxSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxSize;
+}
+
+std::size_t TessellationCache::getMemSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return memSize;
+}
+
+std::size_t TessellationCache::count() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    shrink(0);
+}
+
+std::shared_ptr<const FaceTessellation> TessellationCache::find(
+    const std::string& key,
+    double deflection
+)
+{
+    if (key.empty()) {
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return {};
+    }
+
+    const auto& mesh = it->second.first;
+    if (std::abs(mesh->deflection - deflection) > deflectionTolerance * deflection) {
+        return {};
+    }
+
+    order.splice(order.begin(), order, it->second.second);
+    return mesh;
+}
+
+void TessellationCache::insert(const std::string& key, std::shared_ptr<const FaceTessellation> mesh)
+{
+    if (key.empty() || !mesh) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t size = mesh->getMemSize();
+    if (size > maxSize) {
+        return;
+    }
+
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        memSize -= it->second.first->getMemSize();
+        it->second.first = std::move(mesh);
+        order.splice(order.begin(), order, it->second.second);
+    }
+    else {
+        order.push_front(key);
+        entries.emplace(key, Entry(std::move(mesh), order.begin()));
+    }
+
+    memSize += size;
+    shrink(maxSize);
+}
+
+void TessellationCache::shrink(std::size_t size)
+{
+    while (memSize > size && !order.empty()) {
+        auto it = entries.find(order.back());
+        memSize -= it->second.first->getMemSize();
+        entries.erase(it);
+        order.pop_back();
+    }
+}
+
+void TessellationCache::save(Base::OutputStream& str, const std::vector<std::string>& keys) const
+{
+    std::vector<std::pair<std::string, std::shared_ptr<const FaceTessellation>>> meshes;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& key : keys) {
+            auto it = entries.find(key);
+            if (it != entries.end()) {
+                meshes.emplace_back(key, it->second.first);
+            }
+        }
+    }
+
+    str << cacheMagic << cacheVersion << static_cast<uint32_t>(meshes.size());
+    for (const auto& [key, mesh] : meshes) {
+        str << static_cast<uint32_t>(key.size());
+        str.write(key.data(), static_cast<int>(key.size()));
+        str << mesh->deflection;
+        writeVector(str, mesh->nodes);
+        writeVector(str, mesh->normals);
+        writeIndices(str, mesh->triangles);
+        str << static_cast<uint32_t>(mesh->edges.size());
+        for (std::size_t j = 0; j < mesh->edges.size(); j++) {
+            writeIndices(str, mesh->edges[j]);
+            writeParameters(str, mesh->edgeParameters[j]);
+        }
+    }
+}
+
+void TessellationCache::restore(Base::InputStream& str)
+{
+    uint32_t magic {}, version {}, count {};
+    str >> magic >> version;
+    if (magic != cacheMagic || version != cacheVersion) {
+        return;
+    }
+
+    // the counts are not trusted, so the arrays only grow with the data actually read
+    count = readCount(str);
+    for (uint32_t i = 0; i < count; i++) {
+        if (readCount(str) != keySize) {
+            throw Base::BadFormatError("Invalid key in tessellation cache");
+        }
+        std::string key(keySize, '\0');
+        str.read(key.data(), static_cast<int>(keySize));
+        checkStream(str);
+
+        auto mesh = std::make_shared<FaceTessellation>();
+        str >> mesh->deflection;
+        checkStream(str);
+        readVector(str, mesh->nodes);
+        readVector(str, mesh->normals);
+
+        auto numNodes = static_cast<int32_t>(mesh->nodes.size());
+        readIndices(str, mesh->triangles, numNodes);
+        uint32_t numEdges = readCount(str);
+        for (uint32_t j = 0; j < numEdges; j++) {
+            std::vector<int32_t> edge;
+            std::vector<double> parameters;
+            readIndices(str, edge, numNodes);
+            readParameters(str, parameters);
+            if (!parameters.empty() && parameters.size() != edge.size()) {
+                throw Base::BadFormatError("Invalid edge parameters in tessellation cache");
+            }
+            mesh->edges.push_back(std::move(edge));
+            mesh->edgeParameters.push_back(std::move(parameters));
+        }
+
+        if (mesh->triangles.size() % 3 != 0) {
+            throw Base::BadFormatError("Invalid triangles in tessellation cache");
+        }
+        if (!mesh->normals.empty() && mesh->normals.size() != mesh->nodes.size()) {
+            throw Base::BadFormatError("Invalid normals in tessellation cache");
+        }
+        insert(key, std::move(mesh));
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+TYPESYSTEM_SOURCE(PartGui::PropertyTessellationCache, App::Property)
+
+void PropertyTessellationCache::setValue(std::vector<std::string> keys)
+{
+    faceKeys = std::move(keys);
+}
+
+const std::vector<std::string>& PropertyTessellationCache::getValues() const
+{
+    return faceKeys;
+}
+
+PyObject* PropertyTessellationCache::getPyObject()
+{
+    Py_Return;
+}
+
+void PropertyTessellationCache::setPyObject(PyObject* /*value*/)
+{
+    throw Base::AttributeError("TessellationCache is read-only");
+}
+
+bool PropertyTessellationCache::isSaveEnabled() const
+{
+    return getParameter()->GetBool("SaveTessellationCache", false);
+}
+
+void PropertyTessellationCache::Save(Base::Writer& writer) const
+{
+    std::string file;
+    if (!writer.isForceXML() && !faceKeys.empty() && isSaveEnabled()) {
+        file = writer.addFile("TessellationCache.bin", this);
+    }
+    writer.Stream() << writer.ind() << "<TessellationCache file=\"" << file << "\"/>" << std::endl;
+}
+
+void PropertyTessellationCache::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("TessellationCache");
+    std::string file(reader.getAttribute<const char*>("file"));
+    if (!file.empty()) {
+        reader.addFile(file.c_str(), this);
+    }
+}
+
+void PropertyTessellationCache::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    TessellationCache::instance().save(str, faceKeys);
+}
+
+void PropertyTessellationCache::RestoreDocFile(Base::Reader& reader)
+{
+    // the entries are only a hint, a damaged file must not stop loading the document
+    try {
+        Base::InputStream str(reader);
+        TessellationCache::instance().restore(str);
+    }
+    catch (const Base::Exception& e) {
+        e.reportException();
+    }
+    catch (const std::exception& e) {
+        Base::Console().warning("Failed to restore tessellation cache: %s\n", e.what());
+    }
+}
+
+App::Property* PropertyTessellationCache::Copy() const
+{
+    auto prop = new PropertyTessellationCache();
+    prop->faceKeys = faceKeys;
+    return prop;
+}
+
+void PropertyTessellationCache::Paste(const App::Property& from)
+{
+    faceKeys = dynamic_cast<const PropertyTessellationCache&>(from).faceKeys;
+}
+
+unsigned int PropertyTessellationCache::getMemSize() const
+{
+    return static_cast<unsigned int>(faceKeys.size() * sizeof(std::string));
+}
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <App/Property.h>
+#include <Base/Vector3D.h>
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Face;
+
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
+
+namespace PartGui
+{
+
+/** The render data of a single face. The nodes and normals are in the coordinate system of the
+ * face's TShape and the normals belong to the forward oriented face, so the same data can be
+ * used for all instances of a face.
+ */
+struct PartGuiExport FaceTessellation
+{
+    /// The absolute deflection the face was meshed with
+    double deflection {0.0};
+    std::vector<Base::Vector3f> nodes;
+    /// Only set if the normals are computed from the surface
+    std::vector<Base::Vector3f> normals;
+    /// Three zero-based node indices per triangle
+    std::vector<int32_t> triangles;
+    /// The node indices of the polygon of each edge in the order of TopExp_Explorer
+    std::vector<std::vector<int32_t>> edges;
+    /// The parameters of the polygon nodes on each edge
+    std::vector<std::vector<double>> edgeParameters;
+
+    /// Extracts the triangulation of a meshed face
+    static std::shared_ptr<FaceTessellation>
+    fromFace(const TopoDS_Face& face, double deflection, bool normalsFromUV);
+    /// Checks whether the tessellation has a complete polygon for each edge of the face
+    bool canAttachTo(const TopoDS_Face& face) const;
+    /** Sets the tessellation as triangulation of the face's TShape. When a neighbouring face is
+     * meshed afterwards the mesher reuses the polygons of the shared edges, so the two meshes
+     * fit together without cracks.
+     */
+    void attachTo(const TopoDS_Face& face) const;
+    std::size_t getMemSize() const;
+};
+
+/** A process-wide cache of face tessellations. The key is a digest of the face geometry and the
+ * meshing parameters that don't depend on the size of the whole shape. Thus, unchanged faces
+ * don't need to be meshed again after a recompute or when reopening a document.
+ * The cache is limited by its memory size and drops the least recently used entries first.
+ */
+class PartGuiExport TessellationCache
+{
+public:
+    static TessellationCache& instance();
+
+    /// Computes the key of a face. The location of the face is ignored.
+    static std::string computeKey(const TopoDS_Face& face, double angle, bool normalsFromUV);
+
+    bool isEnabled() const;
+    void setMaxSize(std::size_t bytes);
+    std::size_t getMaxSize() const;
+    std::size_t getMemSize() const;
+    std::size_t count() const;
+    void clear();
+
+    /** Returns the tessellation for \a key if its deflection differs by at most 10% from
+     * \a deflection. The deflection of a face depends on the bounding box of the whole shape,
+     * so a small tolerance keeps faces valid if the shape slightly grows or shrinks.
+     */
+    std::shared_ptr<const FaceTessellation> find(const std::string& key, double deflection);
+    void insert(const std::string& key, std::shared_ptr<const FaceTessellation> mesh);
+
+    /// Writes the entries of the given keys that are still in the cache
+    void save(Base::OutputStream& str, const std::vector<std::string>& keys) const;
+    /// Adds the entries of a stream written by save()
+    void restore(Base::InputStream& str);
+
+private:
+    TessellationCache();
+    void shrink(std::size_t maxSize);
+
+private:
+    using MeshPtr = std::shared_ptr<const FaceTessellation>;
+    using Entry = std::pair<MeshPtr, std::list<std::string>::iterator>;
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    /// The most recently used key is in front
+    std::list<std::string> order;
+    std::size_t memSize {0};
+    std::size_t maxSize;
+};
+
+/** Stores the tessellations of the faces that were last rendered by a view provider in the
+ * project file. The data is only written if enabled in the preferences. The property keeps the
+ * face keys only, setting them doesn't touch the document.
+ */
+class PartGuiExport PropertyTessellationCache: public App::Property
+{
+    TYPESYSTEM_HEADER_WITH_OVERRIDE();
+
+public:
+    PropertyTessellationCache() = default;
+
+    void setValue(std::vector<std::string> keys);
+    const std::vector<std::string>& getValues() const;
+
+    PyObject* getPyObject() override;
+    void setPyObject(PyObject* value) override;
+
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
+    App::Property* Copy() const override;
+    void Paste(const App::Property& from) override;
+    unsigned int getMemSize() const override;
+
+private:
+    bool isSaveEnabled() const;
+
+private:
+    std::vector<std::string> faceKeys;
+};
+
+}  // namespace PartGui
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+
+#include <Standard_Failure.hxx>
+
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentRun>
+
+#include "TessellationJob.h"
+
+
+using namespace PartGui;
+
+TessellationJob::TessellationJob(Callback callback)
+    : callback(std::move(callback))
+{}
+
+TessellationJob::~TessellationJob()
+{
+    cancel();
+}
+
+QThreadPool* TessellationJob::threadPool()
+{
+    // BRepMesh already meshes the faces of a shape in parallel, so a few jobs are enough to keep
+    // the GUI responsive without starving the other pools
+    static QThreadPool* pool = [] {
+        auto tp = new QThreadPool();
+        tp->setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 4));
+        return tp;
+    }();
+    return pool;
+}
+
+void TessellationJob::start(Task task)
+{
+    cancel();
+
+    auto flag = std::make_shared<std::atomic<bool>>(false);
+    canceled = flag;
+
+    QFuture<Result> future = QtConcurrent::run(threadPool(), [task = std::move(task), flag]() {
+        Result result;
+        try {
+            result = task(*flag);
+        }
+        catch (const Standard_Failure& e) {
+            result = std::make_shared<ShapeTessellation>();
+            result->error = e.GetMessageString();
+        }
+        catch (...) {
+            result = std::make_shared<ShapeTessellation>();
+            result->error = "Unknown exception";
+        }
+        return result;
+    });
+
+    watcher = new QFutureWatcher<Result>();
+    QObject::connect(watcher, &QFutureWatcherBase::finished, watcher, [this, flag]() {
+        if (*flag) {
+            return;
+        }
+        Result result = watcher->result();
+        // the watcher may be replaced by the callback
+        watcher->deleteLater();
+        watcher = nullptr;
+        canceled.reset();
+        if (result) {
+            callback(std::move(result));
+        }
+    });
+    watcher->setFuture(future);
+}
+
+void TessellationJob::cancel()
+{
+    if (canceled) {
+        *canceled = true;
+        canceled.reset();
+    }
+    if (watcher) {
+        // the worker finishes on its own, its result is dropped
+        watcher->disconnect();
+        watcher->deleteLater();
+        watcher = nullptr;
+    }
+}
+
+bool TessellationJob::isRunning() const
+{
+    return watcher != nullptr;
+}
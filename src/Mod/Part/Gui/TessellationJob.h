@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Inventor/SbVec3f.h>
+#include <QFutureWatcher>
+
+#include <Mod/Part/PartGlobal.h>
+
+class QThreadPool;
+
+namespace PartGui
+{
+
+/// The pre-packed arrays of the Coin nodes that render a shape
+struct PartGuiExport ShapeTessellation
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    /// Three point indices and SO_END_FACE_INDEX per triangle
+    std::vector<int32_t> faceIndex;
+    /// The number of triangles of each face
+    std::vector<int32_t> partIndex;
+    /// The point indices of each edge, terminated by -1
+    std::vector<int32_t> lineIndex;
+    /// The index of the first point of the vertices
+    int32_t pointStart {0};
+    /// The keys of the faces in the tessellation cache
+    std::vector<std::string> faceKeys;
+    /// Set if the tessellation failed
+    std::string error;
+};
+
+/** Computes the tessellation of a shape on a worker thread. Starting a new job cancels the
+ * running one and only the result of the last job is passed to the callback in the GUI thread.
+ */
+class PartGuiExport TessellationJob
+{
+public:
+    using Result = std::shared_ptr<ShapeTessellation>;
+    /// The task returns null if it has been canceled
+    using Task = std::function<Result(const std::atomic<bool>& canceled)>;
+    using Callback = std::function<void(Result)>;
+
+    explicit TessellationJob(Callback callback);
+    ~TessellationJob();
+
+    void start(Task task);
+    void cancel();
+    bool isRunning() const;
+
+    TessellationJob(const TessellationJob&) = delete;
+    TessellationJob& operator=(const TessellationJob&) = delete;
+
+private:
+    static QThreadPool* threadPool();
+
+private:
+    Callback callback;
+    std::shared_ptr<std::atomic<bool>> canceled;
+    QFutureWatcher<Result>* watcher {nullptr};
+};
+
+}  // namespace PartGui
@@ -23,13 +23,16 @@
  ***************************************************************************/
 
 #include <Bnd_Box.hxx>
+#include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepTools.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <gp_Trsf.hxx>
+#include <Message_ProgressIndicator.hxx>
 #include <Precision.hxx>
 #include <Poly_Array1OfTriangle.hxx>
 #include <Poly_Polygon3D.hxx>
@@ -42,6 +45,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
@@ -91,6 +95,8 @@
 #include "SoBrepEdgeSet.h"
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
+#include "TessellationCache.h"
+#include "TessellationJob.h"
 #include "TaskFaceAppearances.h"
 
 
@@ -219,6 +225,13 @@ ViewProviderPartExt::ViewProviderPartExt()
         "Defines the style of the edges in the 3D view."
     );
     DrawStyle.setEnums(DrawStyleEnums);
+    ADD_PROPERTY_TYPE(
+        TessellationData,
+        (std::vector<std::string>()),
+        osgroup,
+        App::PropertyType(App::Prop_Hidden | App::Prop_NoRecompute),
+        "The tessellation of the faces that is stored in the project file if enabled."
+    );
     coords = new SoCoordinate3();
     coords->ref();
     faceset = new SoBrepFaceSet();
@@ -280,6 +293,7 @@ ViewProviderPartExt::ViewProviderPartExt()
 
 ViewProviderPartExt::~ViewProviderPartExt()
 {
+    tessellationJob.reset();
     pcFaceBind->unref();
     pcLineBind->unref();
     pcPointBind->unref();
@@ -312,6 +326,7 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     // https://forum.freecad.org/viewtopic.php?f=3&t=24912&p=195613
     if (prop == &Deviation) {
         lastRenderedShape = {};
+        pendingShape.Nullify();
         if (isUpdateForced() || Visibility.getValue()) {
             updateVisual();
         }
@@ -321,6 +336,7 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     }
     if (prop == &AngularDeflection) {
         lastRenderedShape = {};
+        pendingShape.Nullify();
         if (isUpdateForced() || Visibility.getValue()) {
             updateVisual();
         }
@@ -436,7 +452,9 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     }
     else {
         // if the object was invisible and has been changed, recreate the visual
-        if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && VisualTouched) {
+        // while restoring wait until the tessellation data is loaded, see finishRestoring()
+        if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && VisualTouched
+            && !isRestoring()) {
             updateVisual();
             // updateVisual() may not be triggered by any change (e.g.
             // triggered by an external object through forceUpdate()). And
@@ -571,7 +589,9 @@ std::vector<std::string> ViewProviderPartExt::getDisplayModes() const
 std::string ViewProviderPartExt::getElement(const SoDetail* detail) const
 {
     std::stringstream str;
-    if (detail) {
+    // while meshing the nodes belong to the bounding box or to the previous shape, so they
+    // don't map to the sub-elements of the current shape
+    if (detail && !showingProxy && pendingShape.IsNull()) {
         if (detail->getTypeId() == SoFaceDetail::getClassTypeId()) {
             const SoFaceDetail* face_detail = static_cast<const SoFaceDetail*>(detail);
             int face = face_detail->getPartIndex() + 1;
@@ -954,7 +974,7 @@ void ViewProviderPartExt::updateData(const App::Property* prop)
     const char* propName = prop->getName();
     if (propName && (strcmp(propName, "Shape") == 0 || strstr(propName, "Touched"))) {
         // calculate the visual only if visible
-        if (isUpdateForced() || Visibility.getValue()) {
+        if ((isUpdateForced() || Visibility.getValue()) && !isRestoring()) {
             updateVisual();
         }
         else {
@@ -985,6 +1005,11 @@ void ViewProviderPartExt::finishRestoring()
         onChanged(&_diffuseColor);
     }
     Gui::ViewProviderGeometryObject::finishRestoring();
+
+    // The visual update has been deferred until the stored tessellation data are available
+    if (VisualTouched && (isUpdateForced() || Visibility.getValue())) {
+        updateVisual();
+    }
 }
 
 void ViewProviderPartExt::setupContextMenu(QMenu* menu, QObject* receiver, const char* member)
@@ -1031,6 +1056,79 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
+namespace
+{
+// Stops the meshing of a shape when its tessellation job has been superseded
+class CancelIndicator: public Message_ProgressIndicator
+{
+public:
+    explicit CancelIndicator(const std::atomic<bool>* canceled)
+        : canceled(canceled)
+    {}
+
+    Standard_Boolean UserBreak() override
+    {
+        return canceled && *canceled;
+    }
+    void Show(const Message_ProgressScope& /*scope*/, const Standard_Boolean /*force*/) override
+    {}
+
+private:
+    const std::atomic<bool>* canceled;
+};
+
+// Returns the indices of the cached faces that share an edge with a face to be meshed. A cached
+// face whose tessellation cannot be attached to the shape must be meshed, too, which may add
+// further neighbours.
+std::vector<int> findCachedNeighbours(
+    const TopTools_IndexedMapOfShape& faceMap,
+    const TopTools_IndexedMapOfShape& edgeMap,
+    std::vector<std::shared_ptr<const FaceTessellation>>& faceMeshes
+)
+{
+    std::vector<int> neighbours;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        neighbours.clear();
+
+        std::set<int> meshedEdges;
+        for (int i = 1; i <= faceMap.Extent(); i++) {
+            if (!faceMeshes[i - 1]) {
+                for (TopExp_Explorer xp(faceMap(i), TopAbs_EDGE); xp.More(); xp.Next()) {
+                    meshedEdges.insert(edgeMap.FindIndex(xp.Current()));
+                }
+            }
+        }
+
+        for (int i = 1; i <= faceMap.Extent(); i++) {
+            auto& mesh = faceMeshes[i - 1];
+            if (!mesh) {
+                continue;
+            }
+
+            bool shared = false;
+            for (TopExp_Explorer xp(faceMap(i), TopAbs_EDGE); xp.More() && !shared; xp.Next()) {
+                shared = meshedEdges.find(edgeMap.FindIndex(xp.Current())) != meshedEdges.end();
+            }
+            if (!shared) {
+                continue;
+            }
+
+            if (mesh->canAttachTo(TopoDS::Face(faceMap(i)))) {
+                neighbours.push_back(i);
+            }
+            else {
+                mesh.reset();
+                changed = true;
+            }
+        }
+    }
+
+    return neighbours;
+}
+}  // namespace
+
 void ViewProviderPartExt::setupCoinGeometry(
     TopoDS_Shape shape,
     SoCoordinate3* coords,
@@ -1040,17 +1138,50 @@ void ViewProviderPartExt::setupCoinGeometry(
     SoBrepPointSet* nodeset,
     double deviation,
     double angularDeflection,
-    bool normalsFromUV
+    bool normalsFromUV,
+    std::vector<std::string>* faceKeys
+)
+{
+    auto data = computeCoinGeometry(shape, deviation, angularDeflection, normalsFromUV);
+    applyCoinGeometry(*data, coords, faceset, norm, lineset, nodeset);
+    if (faceKeys) {
+        *faceKeys = std::move(data->faceKeys);
+    }
+}
+
+void ViewProviderPartExt::applyCoinGeometry(
+    const ShapeTessellation& data,
+    SoCoordinate3* coords,
+    SoBrepFaceSet* faceset,
+    SoNormal* norm,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset
+)
+{
+    auto assign = [](auto& field, const auto& values) {
+        const int num = static_cast<int>(values.size());
+        field.setNum(num);
+        field.setValues(0, num, values.data());
+    };
+    assign(coords->point, data.points);
+    assign(norm->vector, data.normals);
+    assign(faceset->coordIndex, data.faceIndex);
+    assign(faceset->partIndex, data.partIndex);
+    assign(lineset->coordIndex, data.lineIndex);
+    nodeset->startIndex.setValue(data.pointStart);
+}
+
+std::shared_ptr<ShapeTessellation> ViewProviderPartExt::computeCoinGeometry(
+    TopoDS_Shape shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV,
+    const std::atomic<bool>* canceled
 )
 {
+    auto data = std::make_shared<ShapeTessellation>();
     if (Part::Tools::isShapeEmpty(shape)) {
-        coords->point.setNum(0);
-        norm->vector.setNum(0);
-        faceset->coordIndex.setNum(0);
-        faceset->partIndex.setNum(0);
-        lineset->coordIndex.setNum(0);
-        nodeset->startIndex.setValue(0);
-        return;
+        return data;
     }
 
     // time measurement and book keeping
@@ -1086,48 +1217,126 @@ void ViewProviderPartExt::setupCoinGeometry(
     meshParams.InParallel = Standard_True;
     meshParams.AllowQualityDecrease = Standard_True;
 
-    // Clear triangulation and PCurves from geometry which can slow down the process
-#if OCC_VERSION_HEX < 0x070600
-    BRepTools::Clean(shape);
-#else
-    BRepTools::Clean(shape, Standard_True);
-#endif
-
-    BRepMesh_IncrementalMesh(shape, meshParams);
-
     // We must reset the location here because the transformation data
     // are set in the placement property
     TopLoc_Location aLoc;
     shape.Location(aLoc);
 
-    // count triangles and nodes in the mesh
     TopTools_IndexedMapOfShape faceMap;
     TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
     for (int i = 1; i <= faceMap.Extent(); i++) {
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
-
-        if (mesh.IsNull()) {
-            mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
-        }
-
-        // Note: we must also count empty faces
-        if (!mesh.IsNull()) {
-            numTriangles += mesh->NbTriangles();
-            numNodes += mesh->NbNodes();
-            numNorms += mesh->NbNodes();
-        }
-
         TopExp_Explorer xp;
         for (xp.Init(faceMap(i), TopAbs_EDGE); xp.More(); xp.Next()) {
             faceEdges.insert(Part::ShapeMapHasher {}(xp.Current()));
         }
-        numFaces++;
     }
 
     // get an indexed map of edges
     TopTools_IndexedMapOfShape edgeMap;
     TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
 
+    // Take the unchanged faces from the tessellation cache and only mesh the other faces
+    // together with the free edges
+    TessellationCache& cache = TessellationCache::instance();
+    bool useCache = cache.isEnabled();
+    std::vector<std::string> keys(faceMap.Extent());
+    std::vector<std::shared_ptr<const FaceTessellation>> faceMeshes(faceMap.Extent());
+
+    if (useCache) {
+        for (int i = 1; i <= faceMap.Extent(); i++) {
+            const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+            keys[i - 1] = TessellationCache::computeKey(face, AngDeflectionRads, normalsFromUV);
+            faceMeshes[i - 1] = cache.find(keys[i - 1], deflection);
+        }
+    }
+
+    // The mesher discretizes a shared edge only once. Thus, the cached faces next to the faces
+    // to be meshed get their triangulation back, otherwise the polygons of the shared edges
+    // could differ and leave cracks between the faces.
+    std::vector<int> neighbours = findCachedNeighbours(faceMap, edgeMap, faceMeshes);
+
+    BRep_Builder builder;
+    TopoDS_Compound toMesh;
+    builder.MakeCompound(toMesh);
+    int numCached = 0;
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        if (faceMeshes[i - 1]) {
+            numCached++;
+        }
+        else {
+            builder.Add(toMesh, faceMap(i));
+        }
+    }
+    for (int i = 1; i <= edgeMap.Extent(); i++) {
+        if (faceEdges.find(Part::ShapeMapHasher {}(edgeMap(i))) == faceEdges.end()) {
+            builder.Add(toMesh, edgeMap(i));
+        }
+    }
+
+    TopoDS_Shape meshShape = numCached > 0 ? TopoDS_Shape(toMesh) : shape;
+
+    // Clear triangulation and PCurves from geometry which can slow down the process
+#if OCC_VERSION_HEX < 0x070600
+    BRepTools::Clean(meshShape);
+#else
+    BRepTools::Clean(meshShape, Standard_True);
+#endif
+
+    // The neighbours are extracted again after meshing because the mesher may still replace
+    // their triangulation
+    for (int i : neighbours) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+#if OCC_VERSION_HEX < 0x070600
+        BRepTools::Clean(face);
+#else
+        BRepTools::Clean(face, Standard_True);
+#endif
+        faceMeshes[i - 1]->attachTo(face);
+        faceMeshes[i - 1].reset();
+        builder.Add(toMesh, face);
+    }
+
+    if (canceled) {
+        Handle(CancelIndicator) indicator = new CancelIndicator(canceled);
+        BRepMesh_IncrementalMesh(meshShape, meshParams, indicator->Start());
+        if (*canceled) {
+            return {};
+        }
+    }
+    else {
+        BRepMesh_IncrementalMesh(meshShape, meshParams);
+    }
+
+    // count triangles and nodes in the mesh
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        auto& mesh = faceMeshes[i - 1];
+        if (!mesh) {
+            auto faceMesh = FaceTessellation::fromFace(
+                TopoDS::Face(faceMap(i)),
+                deflection,
+                normalsFromUV
+            );
+            if (useCache) {
+                cache.insert(keys[i - 1], faceMesh);
+            }
+            mesh = std::move(faceMesh);
+        }
+
+        // Note: we must also count empty faces
+        if (mesh) {
+            numTriangles += static_cast<int>(mesh->triangles.size() / 3);
+            numNodes += static_cast<int>(mesh->nodes.size());
+            numNorms += static_cast<int>(mesh->nodes.size());
+        }
+        numFaces++;
+    }
+
+    for (auto& key : keys) {
+        if (!key.empty()) {
+            data->faceKeys.push_back(std::move(key));
+        }
+    }
+
     // key is the edge number, value the coord indexes. This is needed to keep the same order as
     // the edges.
     std::map<int, std::vector<int32_t>> lineSetMap;
@@ -1165,32 +1374,32 @@ void ViewProviderPartExt::setupCoinGeometry(
     numNodes += vertexMap.Extent();
 
     // create memory for the nodes and indexes
-    coords->point.setNum(numNodes);
-    norm->vector.setNum(numNorms);
-    faceset->coordIndex.setNum(numTriangles * 4);
-    faceset->partIndex.setNum(numFaces);
+    data->points.resize(numNodes);
+    data->normals.resize(numNorms);
+    data->faceIndex.resize(numTriangles * 4);
+    data->partIndex.resize(numFaces);
 
     // get the raw memory for fast fill up
-    SbVec3f* verts = coords->point.startEditing();
-    SbVec3f* norms = norm->vector.startEditing();
-    int32_t* index = faceset->coordIndex.startEditing();
-    int32_t* parts = faceset->partIndex.startEditing();
+    SbVec3f* verts = data->points.data();
+    SbVec3f* norms = data->normals.data();
+    int32_t* index = data->faceIndex.data();
+    int32_t* parts = data->partIndex.data();
 
     // preset the normal vector with null vector
     for (int i = 0; i < numNorms; i++) {
         norms[i] = SbVec3f(0.0, 0.0, 0.0);
     }
 
+    auto toPnt = [](const Base::Vector3f& vec) {
+        return gp_Pnt(vec.x, vec.y, vec.z);
+    };
+
     int ii = 0, faceNodeOffset = 0, faceTriaOffset = 0;
     for (int i = 1; i <= faceMap.Extent(); i++, ii++) {
-        TopLoc_Location aLoc;
         const TopoDS_Face& actFace = TopoDS::Face(faceMap(i));
-        // get the mesh of the shape
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace, aLoc);
-        if (mesh.IsNull()) {
-            mesh = Part::Tools::triangulationOfFace(actFace);
-        }
-        if (mesh.IsNull()) {
+        // get the mesh of the face
+        const auto& mesh = faceMeshes[ii];
+        if (!mesh) {
             parts[ii] = 0;
             continue;
         }
@@ -1198,59 +1407,43 @@ void ViewProviderPartExt::setupCoinGeometry(
         // getting the transformation of the shape/face
         gp_Trsf myTransf;
         Standard_Boolean identity = true;
+        const TopLoc_Location& aLoc = actFace.Location();
         if (!aLoc.IsIdentity()) {
             identity = false;
             myTransf = aLoc.Transformation();
         }
 
         // getting size of node and triangle array of this face
-        int nbNodesInFace = mesh->NbNodes();
-        int nbTriInFace = mesh->NbTriangles();
+        int nbNodesInFace = static_cast<int>(mesh->nodes.size());
+        int nbTriInFace = static_cast<int>(mesh->triangles.size() / 3);
         // check orientation
         TopAbs_Orientation orient = actFace.Orientation();
+        // the cached normals belong to the forward oriented face
+        bool useNormals = normalsFromUV && !mesh->normals.empty();
+        double normalSign = orient == TopAbs_REVERSED ? -1.0 : 1.0;
 
         // cycling through the poly mesh
-#if OCC_VERSION_HEX < 0x070600
-        const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
-        const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
-        TColgp_Array1OfDir Normals(Nodes.Lower(), Nodes.Upper());
-#else
-        int numNodes = mesh->NbNodes();
-        TColgp_Array1OfDir Normals(1, numNodes);
-#endif
-        if (normalsFromUV) {
-            Part::Tools::getPointNormals(actFace, mesh, Normals);
-        }
-
-        for (int g = 1; g <= nbTriInFace; g++) {
+        for (int g = 0; g < nbTriInFace; g++) {
             // Get the triangle
-            Standard_Integer N1, N2, N3;
-#if OCC_VERSION_HEX < 0x070600
-            Triangles(g).Get(N1, N2, N3);
-#else
-            mesh->Triangle(g).Get(N1, N2, N3);
-#endif
+            int32_t N1 = mesh->triangles[3 * g];
+            int32_t N2 = mesh->triangles[3 * g + 1];
+            int32_t N3 = mesh->triangles[3 * g + 2];
 
             // change orientation of the triangle if the face is reversed
             if (orient != TopAbs_FORWARD) {
-                Standard_Integer tmp = N1;
-                N1 = N2;
-                N2 = tmp;
+                std::swap(N1, N2);
             }
 
             // get the 3 points of this triangle
-#if OCC_VERSION_HEX < 0x070600
-            gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
-#else
-            gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
-#endif
+            gp_Pnt V1(toPnt(mesh->nodes[N1])), V2(toPnt(mesh->nodes[N2])),
+                V3(toPnt(mesh->nodes[N3]));
 
             // get the 3 normals of this triangle
             gp_Vec NV1, NV2, NV3;
-            if (normalsFromUV) {
-                NV1.SetXYZ(Normals(N1).XYZ());
-                NV2.SetXYZ(Normals(N2).XYZ());
-                NV3.SetXYZ(Normals(N3).XYZ());
+            if (useNormals) {
+                NV1 = normalSign * gp_Vec(toPnt(mesh->normals[N1]).XYZ());
+                NV2 = normalSign * gp_Vec(toPnt(mesh->normals[N2]).XYZ());
+                NV3 = normalSign * gp_Vec(toPnt(mesh->normals[N3]).XYZ());
             }
             else {
                 gp_Vec v1 = Base::convertTo<gp_Vec>(V1);
@@ -1268,7 +1461,7 @@ void ViewProviderPartExt::setupCoinGeometry(
                 V1.Transform(myTransf);
                 V2.Transform(myTransf);
                 V3.Transform(myTransf);
-                if (normalsFromUV) {
+                if (useNormals) {
                     NV1.Transform(myTransf);
                     NV2.Transform(myTransf);
                     NV3.Transform(myTransf);
@@ -1276,27 +1469,28 @@ void ViewProviderPartExt::setupCoinGeometry(
             }
 
             // add the normals for all points of this triangle
-            norms[faceNodeOffset + N1 - 1] += Base::convertTo<SbVec3f>(NV1);
-            norms[faceNodeOffset + N2 - 1] += Base::convertTo<SbVec3f>(NV2);
-            norms[faceNodeOffset + N3 - 1] += Base::convertTo<SbVec3f>(NV3);
+            norms[faceNodeOffset + N1] += Base::convertTo<SbVec3f>(NV1);
+            norms[faceNodeOffset + N2] += Base::convertTo<SbVec3f>(NV2);
+            norms[faceNodeOffset + N3] += Base::convertTo<SbVec3f>(NV3);
 
             // set the vertices
-            verts[faceNodeOffset + N1 - 1] = Base::convertTo<SbVec3f>(V1);
-            verts[faceNodeOffset + N2 - 1] = Base::convertTo<SbVec3f>(V2);
-            verts[faceNodeOffset + N3 - 1] = Base::convertTo<SbVec3f>(V3);
+            verts[faceNodeOffset + N1] = Base::convertTo<SbVec3f>(V1);
+            verts[faceNodeOffset + N2] = Base::convertTo<SbVec3f>(V2);
+            verts[faceNodeOffset + N3] = Base::convertTo<SbVec3f>(V3);
 
             // set the index vector with the 3 point indexes and the end delimiter
-            index[faceTriaOffset * 4 + 4 * (g - 1)] = faceNodeOffset + N1 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 1] = faceNodeOffset + N2 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 2] = faceNodeOffset + N3 - 1;
-            index[faceTriaOffset * 4 + 4 * (g - 1) + 3] = SO_END_FACE_INDEX;
+            index[faceTriaOffset * 4 + 4 * g] = faceNodeOffset + N1;
+            index[faceTriaOffset * 4 + 4 * g + 1] = faceNodeOffset + N2;
+            index[faceTriaOffset * 4 + 4 * g + 2] = faceNodeOffset + N3;
+            index[faceTriaOffset * 4 + 4 * g + 3] = SO_END_FACE_INDEX;
         }
 
         parts[ii] = nbTriInFace;  // new part
 
         // handling the edges lying on this face
         TopExp_Explorer Exp;
-        for (Exp.Init(actFace, TopAbs_EDGE); Exp.More(); Exp.Next()) {
+        std::size_t edgeNumber = 0;
+        for (Exp.Init(actFace, TopAbs_EDGE); Exp.More(); Exp.Next(), edgeNumber++) {
             const TopoDS_Edge& curEdge = TopoDS::Edge(Exp.Current());
             // get the overall index of this edge
             int edgeIndex = edgeMap.FindIndex(curEdge);
@@ -1305,17 +1499,12 @@ void ViewProviderPartExt::setupCoinGeometry(
             if (edgeIdxSet.find(edgeIndex) != edgeIdxSet.end()) {
 
                 // this holds the indices of the edge's triangulation to the current polygon
-                Handle(Poly_PolygonOnTriangulation)
-                    aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
-                if (aPoly.IsNull()) {
+                if (edgeNumber >= mesh->edges.size() || mesh->edges[edgeNumber].empty()) {
                     continue;  // polygon does not exist
                 }
 
-                // getting the indexes of the edge polygon
-                const TColStd_Array1OfInteger& indices = aPoly->Nodes();
-                for (Standard_Integer i = indices.Lower(); i <= indices.Upper(); i++) {
-                    int nodeIndex = indices(i);
-                    int index = faceNodeOffset + nodeIndex - 1;
+                for (int32_t nodeIndex : mesh->edges[edgeNumber]) {
+                    int index = faceNodeOffset + nodeIndex;
                     lineSetMap[edgeIndex].push_back(index);
 
                     // usually the coordinates for this edge are already set by the
@@ -1323,11 +1512,7 @@ void ViewProviderPartExt::setupCoinGeometry(
                     // rare cases where some points are only referenced by the polygon
                     // but not by any triangle. Thus, we must apply the coordinates to
                     // make sure that everything is properly set.
-#if OCC_VERSION_HEX < 0x070600
-                    gp_Pnt p(Nodes(nodeIndex));
-#else
-                    gp_Pnt p(mesh->Node(nodeIndex));
-#endif
+                    gp_Pnt p(toPnt(mesh->nodes[nodeIndex]));
                     if (!identity) {
                         p.Transform(myTransf);
                     }
@@ -1382,7 +1567,7 @@ void ViewProviderPartExt::setupCoinGeometry(
         }
     }
 
-    nodeset->startIndex.setValue(faceNodeOffset);
+    data->pointStart = faceNodeOffset;
     for (int i = 0; i < vertexMap.Extent(); i++) {
         const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i + 1));
         gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
@@ -1395,28 +1580,12 @@ void ViewProviderPartExt::setupCoinGeometry(
         norms[i].normalize();
     }
 
-    std::vector<int32_t> lineSetCoords;
+    std::vector<int32_t>& lineSetCoords = data->lineIndex;
     for (const auto& it : lineSetMap) {
         lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
         lineSetCoords.push_back(-1);
     }
-
-    // preset the index vector size
     numLines = lineSetCoords.size();
-    lineset->coordIndex.setNum(numLines);
-    int32_t* lines = lineset->coordIndex.startEditing();
-
-    int l = 0;
-    for (auto it = lineSetCoords.begin(); it != lineSetCoords.end(); ++it, l++) {
-        lines[l] = *it;
-    }
-
-    // end the editing of the nodes
-    coords->point.finishEditing();
-    norm->vector.finishEditing();
-    faceset->coordIndex.finishEditing();
-    faceset->partIndex.finishEditing();
-    lineset->coordIndex.finishEditing();
 
 #ifdef FC_DEBUG
     Base::Console().log(
@@ -1432,6 +1601,8 @@ void ViewProviderPartExt::setupCoinGeometry(
         numLines
     );
 #endif
+
+    return data;
 }
 
 void ViewProviderPartExt::setupCoinGeometry(
@@ -1472,6 +1643,48 @@ void ViewProviderPartExt::updateVisual()
         return;
     }
 
+    if (tessellationJob && tessellationJob->isRunning()) {
+        // a forced update expects the nodes to be ready on return, so it cannot wait for the job
+        if (pendingShape.IsPartner(shape) && !isUpdateForced()) {
+            // this shape is already being meshed
+            return;
+        }
+        tessellationJob->cancel();
+    }
+    pendingShape.Nullify();
+
+    if (useBackgroundTessellation(shape)) {
+        startTessellation(shape);
+        return;
+    }
+
+    try {
+        auto data = computeCoinGeometry(
+            shape,
+            Deviation.getValue(),
+            AngularDeflection.getValue(),
+            NormalsFromUV
+        );
+        applyVisual(*data, shape);
+    }
+    catch (const Standard_Failure& e) {
+        FC_ERR(
+            "Cannot compute Inventor representation for the shape of "
+            << pcObject->getFullName() << ": " << e.GetMessageString()
+        );
+    }
+    catch (...) {
+        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+    }
+
+    // The material has to be checked again
+    setHighlightedFaces(ShapeAppearance.getValues());
+    setHighlightedEdges(LineColorArray.getValues());
+    setHighlightedPoints(PointColorArray.getValue());
+}
+
+void ViewProviderPartExt::applyVisual(const ShapeTessellation& data, const TopoDS_Shape& shape)
+{
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -1487,37 +1700,123 @@ void ViewProviderPartExt::updateVisual()
     haction.apply(this->lineset);
     haction.apply(this->nodeset);
 
-    try {
-        setupCoinGeometry(
-            shape,
-            coords,
-            faceset,
-            norm,
-            lineset,
-            nodeset,
-            Deviation.getValue(),
-            AngularDeflection.getValue(),
-            NormalsFromUV
-        );
+    applyCoinGeometry(data, coords, faceset, norm, lineset, nodeset);
+    TessellationData.setValue(data.faceKeys);
 
-        lastRenderedShape = shape;
+    showingProxy = false;
+    lastRenderedShape = shape;
+    VisualTouched = false;
+}
 
-        VisualTouched = false;
+bool ViewProviderPartExt::useBackgroundTessellation(const TopoDS_Shape& shape) const
+{
+    // a forced update expects the nodes to be ready on return, e.g. for an export
+    if (isUpdateForced() || Part::Tools::isShapeEmpty(shape)) {
+        return false;
     }
-    catch (const Standard_Failure& e) {
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    if (!hGrp->GetBool("AsyncTessellation", true)) {
+        return false;
+    }
+
+    // small shapes are meshed faster than a round trip through the thread pool
+    long minFaces = hGrp->GetInt("AsyncTessellationMinFaces", 100);
+    long numFaces = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        if (++numFaces >= minFaces) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ViewProviderPartExt::startTessellation(const TopoDS_Shape& shape)
+{
+    pendingShape = shape;
+    VisualTouched = true;
+
+    // BRepMesh stores the triangulation in the faces, so the worker meshes a copy of the
+    // topology that shares the geometry instead of the shape owned by the document
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(shape, Standard_False, Standard_False).Shape();
+
+    // show at least where the shape is until its first tessellation is available
+    if (coords->point.getNum() == 0) {
+        showBoundingBoxProxy(shape);
+    }
+
+    if (!tessellationJob) {
+        tessellationJob = std::make_unique<TessellationJob>([this](TessellationJob::Result data) {
+            onTessellationFinished(std::move(data));
+        });
+    }
+
+    double deviation = Deviation.getValue();
+    double angularDeflection = AngularDeflection.getValue();
+    bool normalsFromUV = NormalsFromUV;
+    tessellationJob->start([=](const std::atomic<bool>& canceled) {
+        return computeCoinGeometry(copy, deviation, angularDeflection, normalsFromUV, &canceled);
+    });
+}
+
+void ViewProviderPartExt::showBoundingBoxProxy(const TopoDS_Shape& shape)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape.Located(TopLoc_Location()), bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+
+    ShapeTessellation proxy;
+    for (int i = 0; i < 8; i++) {
+        proxy.points.emplace_back(
+            static_cast<float>(i & 1 ? xMax : xMin),
+            static_cast<float>(i & 2 ? yMax : yMin),
+            static_cast<float>(i & 4 ? zMax : zMin)
+        );
+    }
+    // the twelve edges of the box, each one connecting corners that differ in one bit
+    for (int i = 0; i < 8; i++) {
+        for (int bit = 1; bit < 8; bit <<= 1) {
+            if (!(i & bit)) {
+                proxy.lineIndex.insert(proxy.lineIndex.end(), {i, i | bit, -1});
+            }
+        }
+    }
+    proxy.pointStart = 8;
+
+    applyCoinGeometry(proxy, coords, faceset, norm, lineset, nodeset);
+    showingProxy = true;
+}
+
+void ViewProviderPartExt::onTessellationFinished(TessellationJob::Result data)
+{
+    TopoDS_Shape shape = pendingShape;
+    pendingShape.Nullify();
+
+    if (!data->error.empty()) {
         FC_ERR(
             "Cannot compute Inventor representation for the shape of "
-            << pcObject->getFullName() << ": " << e.GetMessageString()
+            << pcObject->getFullName() << ": " << data->error
         );
-    }
-    catch (...) {
-        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+        return;
     }
 
+    applyVisual(*data, shape);
+
     // The material has to be checked again
     setHighlightedFaces(ShapeAppearance.getValues());
     setHighlightedEdges(LineColorArray.getValues());
     setHighlightedPoints(PointColorArray.getValue());
+
+    if (this->faceset->partIndex.getNum() > this->pcShapeMaterial->diffuseColor.getNum()) {
+        this->pcFaceBind->value = SoMaterialBinding::OVERALL;
+    }
 }
 
 void ViewProviderPartExt::forceUpdate(bool enable)
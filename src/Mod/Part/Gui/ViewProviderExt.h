@@ -25,9 +25,15 @@
 #pragma once
 
 #include "SoFCShapeObject.h"
+#include "TessellationCache.h"
+#include "TessellationJob.h"
 
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -91,6 +97,8 @@ public:
     App::PropertyColor LineColor;
     App::PropertyMaterial LineMaterial;
     App::PropertyColorList LineColorArray;
+    // Tessellation
+    PropertyTessellationCache TessellationData;
 
     void attach(App::DocumentObject*) override;
     void setDisplayMode(const char* ModeName) override;
@@ -189,7 +197,8 @@ public:
         SoBrepPointSet* nodeset,
         double deviation,
         double angularDeflection,
-        bool normalsFromUV = false
+        bool normalsFromUV = false,
+        std::vector<std::string>* faceKeys = nullptr
     );
 
     static void setupCoinGeometry(
@@ -200,6 +209,26 @@ public:
         bool normalsFromUV = false
     );
 
+    /// meshes the shape and packs the Coin arrays without touching any node,
+    /// so it can run in a worker thread; returns null if \a canceled was set
+    static std::shared_ptr<ShapeTessellation> computeCoinGeometry(
+        TopoDS_Shape shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV = false,
+        const std::atomic<bool>* canceled = nullptr
+    );
+
+    /// copies the result of computeCoinGeometry() into the Coin nodes
+    static void applyCoinGeometry(
+        const ShapeTessellation& data,
+        SoCoordinate3* coords,
+        SoBrepFaceSet* faceset,
+        SoNormal* norm,
+        SoBrepEdgeSet* lineset,
+        SoBrepPointSet* nodeset
+    );
+
 protected:
     bool setEdit(int ModNum) override;
     void unsetEdit(int ModNum) override;
@@ -253,6 +282,18 @@ private:
 
     // shape that was last rendered so if it does not change we don't re-render it without need
     TopoDS_Shape lastRenderedShape;
+
+    bool useBackgroundTessellation(const TopoDS_Shape& shape) const;
+    void startTessellation(const TopoDS_Shape& shape);
+    void showBoundingBoxProxy(const TopoDS_Shape& shape);
+    void onTessellationFinished(TessellationJob::Result data);
+    void applyVisual(const ShapeTessellation& data, const TopoDS_Shape& shape);
+
+    // background meshing of large shapes and the shape it is working on
+    std::unique_ptr<TessellationJob> tessellationJob;
+    TopoDS_Shape pendingShape;
+    // true while only the bounding box is shown in place of the shape
+    bool showingProxy = false;
 };
 
 }  // namespace PartGui
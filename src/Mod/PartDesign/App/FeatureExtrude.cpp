@@ -26,6 +26,7 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <sstream>
 #include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
 #include <BRep_Builder.hxx>
 #include <BRepAdaptor_Surface.hxx>
@@ -46,6 +47,8 @@
 #include <Base/Converter.h>
 #include <Base/Tools.h>
 #include <Mod/Part/App/ExtrusionHelper.h>
+#include <Mod/Part/App/FuzzyHelper.h>
+#include <Mod/Part/App/ShapeOpCache.h>
 #include <Mod/Part/App/Tools.h>
 #include "Mod/Part/App/TopoShapeOpCode.h"
 #include <Mod/Part/App/PartFeature.h>
@@ -508,6 +511,21 @@ App::DocumentObjectExecReturn* FeatureExtrude::buildExtrusion(ExtrudeOptions opt
         // if the sketch's normal vector was used
         Direction.setValue(paddingDirection);
 
+        // Looked up once the placement and direction are final, as both are part of the key
+        auto& opCache = Part::ShapeOpCache::instance();
+        std::ostringstream context;
+        context.precision(std::numeric_limits<double>::max_digits10);
+        context << singleSolidRuleMode() << ' ' << Part::FuzzyHelper::getBooleanFuzzy();
+        std::string cacheKey = opCache.makeKey(this, context.str());
+        std::vector<TopoShape> cached;
+        if (opCache.lookup(cacheKey, cached)) {
+            this->rawShape = cached[0];
+            this->AddSubShape.setValue(cached[1]);
+            this->Shape.setValue(cached[2]);
+            updateProperties();
+            return App::DocumentObject::StdReturn;
+        }
+
         dir.Transform(invTrsf);
         if (Reversed.getValue()) {
             dir.Reverse();
@@ -856,6 +874,8 @@ App::DocumentObjectExecReturn* FeatureExtrude::buildExtrusion(ExtrudeOptions opt
             this->Shape.setValue(prism);
         }
 
+        opCache.store(cacheKey, {rawShape, AddSubShape.getShape(), Shape.getShape()});
+
         // eventually disable some settings that are not valid for the current method
         updateProperties();
 
@@ -37,6 +37,7 @@
 
 #include <Base/Exception.h>
 #include <Base/Reader.h>
+#include <Mod/Part/App/ShapeOpCache.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "FeatureFillet.h"
@@ -108,6 +109,15 @@ App::DocumentObjectExecReturn* Fillet::execute()
 
     this->positionByBaseFeature();
 
+    auto& opCache = Part::ShapeOpCache::instance();
+    std::string cacheKey = opCache.makeKey(this, std::to_string(singleSolidRuleMode()));
+    std::vector<TopoShape> cached;
+    if (opCache.lookup(cacheKey, cached)) {
+        this->rawShape = cached[0];
+        this->Shape.setValue(cached[1]);
+        return App::DocumentObject::StdReturn;
+    }
+
     try {
         TopoShape shape(0);  //,getDocument()->getStringHasher());
 
@@ -146,6 +156,7 @@ App::DocumentObjectExecReturn* Fillet::execute()
         }
 
         shape = getSolid(shape);
+        opCache.store(cacheKey, {rawShape, shape});
         this->Shape.setValue(shape);
         return App::DocumentObject::StdReturn;
     }
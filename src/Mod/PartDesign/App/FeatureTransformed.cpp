@@ -29,11 +29,19 @@
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <memory>
 #include <unordered_map>
 #include <algorithm>
 
@@ -41,6 +49,9 @@
 #include <Base/Exception.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
+#include <Mod/Part/App/FuzzyHelper.h>
+#include <Mod/Part/App/SignalException.h>
+#include <Mod/Part/App/TopoShapeMapper.h>
 #include <Mod/Part/App/modelRefine.h>
 
 #include "FeatureTransformed.h"
@@ -51,11 +62,354 @@
 #include "FeatureLinearPattern.h"
 #include "FeaturePolarPattern.h"
 #include "FeatureSketchBased.h"
+#include "PartDesignParameter.h"
 #include "Mod/Part/App/TopoShapeOpCode.h"
 
 
 using namespace PartDesign;
 
+namespace
+{
+
+/** Mapper for a boolean that is split into fusions of clusters of the tools
+ * and a final boolean of the support with the cluster results.
+ *
+ * The histories of both stages are composed, so that the result gets the
+ * same element map as a single boolean of the support with all the tools.
+ */
+struct MapperClusteredBoolean: Part::TopoShape::Mapper
+{
+    using MakerMap = std::
+        unordered_map<TopoDS_Shape, BRepBuilderAPI_MakeShape*, Part::ShapeHasher, Part::ShapeHasher>;
+
+    std::vector<std::unique_ptr<FCBRepAlgoAPI_Fuse>> clusters;
+    MakerMap clusterOf;
+    std::unique_ptr<BRepAlgoAPI_BooleanOperation> last;
+
+    // The shapes that the cluster fuse made of s, s itself if it is not part of a cluster
+    void firstStage(
+        const TopoDS_Shape& s,
+        std::vector<TopoDS_Shape>& modified,
+        std::vector<TopoDS_Shape>& generated
+    ) const
+    {
+        auto it = clusterOf.find(s);
+        if (it == clusterOf.end()) {
+            modified.push_back(s);
+            return;
+        }
+        BRepBuilderAPI_MakeShape& maker = *it->second;
+        for (TopTools_ListIteratorOfListOfShape li(maker.Generated(s)); li.More(); li.Next()) {
+            generated.push_back(li.Value());
+        }
+        if (maker.IsDeleted(s)) {
+            return;
+        }
+        for (TopTools_ListIteratorOfListOfShape li(maker.Modified(s)); li.More(); li.Next()) {
+            modified.push_back(li.Value());
+        }
+        if (modified.empty()) {
+            modified.push_back(s);
+        }
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        _res.clear();
+        try {
+            std::vector<TopoDS_Shape> stage;
+            std::vector<TopoDS_Shape> generated;
+            firstStage(s, stage, generated);
+            for (const auto& shape : stage) {
+                if (last->IsDeleted(shape)) {
+                    continue;
+                }
+                const TopTools_ListOfShape& list = last->Modified(shape);
+                if (list.IsEmpty()) {
+                    if (!shape.IsSame(s)) {
+                        _res.push_back(shape);
+                    }
+                    continue;
+                }
+                for (TopTools_ListIteratorOfListOfShape li(list); li.More(); li.Next()) {
+                    _res.push_back(li.Value());
+                }
+            }
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().warning("Exception on shape mapper: %s\n", e.GetMessageString());
+        }
+        return _res;
+    }
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        _res.clear();
+        try {
+            std::vector<TopoDS_Shape> stage;
+            std::vector<TopoDS_Shape> generated;
+            firstStage(s, stage, generated);
+            for (const auto& shape : generated) {
+                if (last->IsDeleted(shape)) {
+                    continue;
+                }
+                const TopTools_ListOfShape& list = last->Modified(shape);
+                if (list.IsEmpty()) {
+                    _res.push_back(shape);
+                    continue;
+                }
+                for (TopTools_ListIteratorOfListOfShape li(list); li.More(); li.Next()) {
+                    _res.push_back(li.Value());
+                }
+            }
+            for (const auto& shape : stage) {
+                for (TopTools_ListIteratorOfListOfShape li(last->Generated(shape)); li.More();
+                     li.Next()) {
+                    _res.push_back(li.Value());
+                }
+            }
+        }
+        catch (const Standard_Failure& e) {
+            Base::Console().warning("Exception on shape mapper: %s\n", e.GetMessageString());
+        }
+        return _res;
+    }
+};
+
+// Position of the box center on a Z-order curve through the given bounds
+uint64_t mortonCode(const Bnd_Box& box, const Bnd_Box& bounds)
+{
+    constexpr int bits = 16;
+    constexpr double cells = double((1 << bits) - 1);
+    gp_Pnt center = (box.CornerMin().XYZ() + box.CornerMax().XYZ()) / 2.0;
+    gp_Pnt min = bounds.CornerMin();
+    gp_Pnt max = bounds.CornerMax();
+    std::array<double, 3> pos = {center.X(), center.Y(), center.Z()};
+    std::array<double, 3> lower = {min.X(), min.Y(), min.Z()};
+    std::array<double, 3> upper = {max.X(), max.Y(), max.Z()};
+
+    uint64_t code = 0;
+    std::array<uint64_t, 3> cell {};
+    for (int i = 0; i < 3; i++) {
+        double size = upper[i] - lower[i];
+        double t = size > 0.0 ? (pos[i] - lower[i]) / size : 0.0;
+        cell[i] = static_cast<uint64_t>(std::clamp(t, 0.0, 1.0) * cells);
+    }
+    for (int bit = 0; bit < bits; bit++) {
+        for (int i = 0; i < 3; i++) {
+            code |= ((cell[i] >> bit) & 1U) << (3 * bit + i);
+        }
+    }
+    return code;
+}
+
+/** Fuse or cut the support shapes[0] with the pattern instances shapes[1..]
+ *
+ * The result and its element map are the same as of makeElementFuse() or
+ * makeElementCut() with all the shapes, but the instances are clustered
+ * spatially and the clusters are fused in parallel before the support is
+ * combined with the cluster results. Instances that do not touch the
+ * support or any other instance are added to the result of a fusion as is,
+ * and left out of a cut.
+ *
+ * @return false if the shapes are not suited or the operation failed, in
+ * which case the caller does a single boolean of all the shapes.
+ */
+bool makeClusteredBoolean(
+    Part::TopoShape& result,
+    const std::vector<Part::TopoShape>& shapes,
+    bool fuse
+)
+{
+    long threshold = PartDesignParameter::instance()->getPatternFuseTreeThreshold();
+    if (threshold <= 0 || shapes.size() < 2 || long(shapes.size() - 1) < threshold) {
+        return false;
+    }
+    // The support and every tool must be valid, a boolean of the clusters could hide defects
+    // that the single boolean of all the shapes reports
+    for (const auto& shape : shapes) {
+        if (shape.isNull() || shape.shapeType() == TopAbs_COMPOUND || !shape.isValid()) {
+            return false;
+        }
+    }
+
+    const std::size_t count = shapes.size();
+    std::vector<Bnd_Box> boxes(count);
+    Bnd_Box bounds;
+    for (std::size_t i = 0; i < count; i++) {
+        BRepBndLib::Add(shapes[i].getShape(), boxes[i]);
+        bounds.Add(boxes[i]);
+    }
+    // Same fuzzy value as for a single boolean of all the shapes
+    double fuzzy = Part::FuzzyHelper::getBooleanFuzzy() * std::sqrt(bounds.SquareExtent())
+        * Precision::Confusion();
+    for (auto& box : boxes) {
+        box.Enlarge(fuzzy + Precision::Confusion());
+    }
+
+    // Find the instances that touch another instance, sweeping along the X axis
+    std::vector<std::size_t> order;
+    for (std::size_t i = 1; i < count; i++) {
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&boxes](std::size_t a, std::size_t b) {
+        return boxes[a].CornerMin().X() < boxes[b].CornerMin().X();
+    });
+    std::vector<bool> touchesInstance(count, false);
+    for (std::size_t i = 0; i < order.size(); i++) {
+        const Bnd_Box& box = boxes[order[i]];
+        double xMax = box.CornerMax().X();
+        for (std::size_t j = i + 1; j < order.size(); j++) {
+            if (boxes[order[j]].CornerMin().X() > xMax) {
+                break;
+            }
+            if (!box.IsOut(boxes[order[j]])) {
+                touchesInstance[order[i]] = true;
+                touchesInstance[order[j]] = true;
+            }
+        }
+    }
+
+    std::vector<std::size_t> tools;
+    std::vector<std::size_t> isolated;
+    for (std::size_t i = 1; i < count; i++) {
+        bool touchesSupport = !boxes[i].IsOut(boxes[0]);
+        if (touchesSupport || (fuse && touchesInstance[i])) {
+            tools.push_back(i);
+        }
+        else if (fuse) {
+            isolated.push_back(i);
+        }
+    }
+    if (tools.empty()) {
+        return false;
+    }
+
+    // Neighbouring instances end up in the same cluster
+    std::vector<uint64_t> codes(count);
+    for (std::size_t i : tools) {
+        codes[i] = mortonCode(boxes[i], bounds);
+    }
+    std::stable_sort(tools.begin(), tools.end(), [&codes](std::size_t a, std::size_t b) {
+        return codes[a] < codes[b];
+    });
+    std::size_t clusterSize = std::max<std::size_t>(
+        2,
+        static_cast<std::size_t>(std::ceil(std::sqrt(double(tools.size()))))
+    );
+    std::vector<std::vector<std::size_t>> clusters;
+    for (std::size_t i = 0; i < tools.size(); i += clusterSize) {
+        auto end = std::min(tools.size(), i + clusterSize);
+        clusters.emplace_back(tools.begin() + i, tools.begin() + end);
+    }
+
+    MapperClusteredBoolean mapper;
+    mapper.clusters.resize(clusters.size());
+    std::vector<std::exception_ptr> failures(clusters.size());
+    {
+        // Install the signal handlers once, rather than by each boolean in the worker threads
+        Part::SignalException sig;
+        OSD_Parallel::For(0, static_cast<int>(clusters.size()), [&](int index) {
+            const auto& cluster = clusters[index];
+            if (cluster.size() < 2) {
+                return;
+            }
+            try {
+                auto mk = std::make_unique<FCBRepAlgoAPI_Fuse>();
+                TopTools_ListOfShape arguments;
+                TopTools_ListOfShape toolShapes;
+                arguments.Append(shapes[cluster.front()].getShape());
+                for (std::size_t i = 1; i < cluster.size(); i++) {
+                    toolShapes.Append(shapes[cluster[i]].getShape());
+                }
+                mk->SetArguments(arguments);
+                mk->SetTools(toolShapes);
+                mk->SetFuzzyValue(fuzzy);
+                mk->Build();
+                if (!mk->IsDone()) {
+                    throw Standard_Failure("Fusion of pattern instances failed");
+                }
+                mapper.clusters[index] = std::move(mk);
+            }
+            catch (...) {
+                failures[index] = std::current_exception();
+            }
+        });
+    }
+    for (const auto& failure : failures) {
+        if (failure) {
+            return false;
+        }
+    }
+    if (Base::Sequencer().wasCanceled()) {
+        return false;
+    }
+
+    TopTools_ListOfShape arguments;
+    TopTools_ListOfShape toolShapes;
+    arguments.Append(shapes[0].getShape());
+    for (std::size_t index = 0; index < clusters.size(); index++) {
+        const auto& mk = mapper.clusters[index];
+        if (!mk) {
+            toolShapes.Append(shapes[clusters[index].front()].getShape());
+            continue;
+        }
+        toolShapes.Append(mk->Shape());
+        for (std::size_t i : clusters[index]) {
+            TopTools_IndexedMapOfShape subShapes;
+            TopExp::MapShapes(shapes[i].getShape(), subShapes);
+            for (int j = 1; j <= subShapes.Extent(); j++) {
+                mapper.clusterOf.emplace(subShapes(j), mk.get());
+            }
+        }
+    }
+
+    if (fuse) {
+        mapper.last = std::make_unique<FCBRepAlgoAPI_Fuse>();
+    }
+    else {
+        mapper.last = std::make_unique<FCBRepAlgoAPI_Cut>();
+    }
+    try {
+        mapper.last->SetArguments(arguments);
+        mapper.last->SetTools(toolShapes);
+        mapper.last->SetFuzzyValue(fuzzy);
+        mapper.last->Build();
+    }
+    catch (const Standard_Failure&) {
+        return false;
+    }
+    if (!mapper.last->IsDone() || Base::Sequencer().wasCanceled()) {
+        return false;
+    }
+
+    TopoDS_Shape shape = mapper.last->Shape();
+    if (!isolated.empty()) {
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        if (shape.ShapeType() == TopAbs_COMPOUND) {
+            for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+                builder.Add(compound, it.Value());
+            }
+        }
+        else {
+            builder.Add(compound, shape);
+        }
+        for (std::size_t i : isolated) {
+            builder.Add(compound, shapes[i].getShape());
+        }
+        shape = compound;
+    }
+
+    const char* op = fuse ? Part::OpCodes::Fuse : Part::OpCodes::Cut;
+    result.makeShapeWithElementMap(shape, mapper, shapes, op);
+    result.makeElementShell(true);
+    return true;
+}
+
+}  // namespace
+
 namespace PartDesign
 {
 extern bool getPDRefineModelParameter();
@@ -410,7 +764,8 @@ App::DocumentObjectExecReturn* Transformed::execute()
             // transformations to each Original separately. This way it is easier to discover what
             // feature causes a fuse/cut to fail. The downside is that performance suffers when
             // there are many originals. But it seems safe to assume that in most cases there are
-            // few originals and many transformations
+            // few originals and many transformations. Many transformations of an original are
+            // combined by makeClusteredBoolean().
             for (auto original : originals) {
                 // Extract the original shape and determine whether to cut or to fuse
                 Part::TopoShape fuseShape;
@@ -442,14 +797,18 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     if (Base::Sequencer().wasCanceled()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
-                    supportShape.makeElementFuse(shapes);
+                    if (!makeClusteredBoolean(supportShape, shapes, true)) {
+                        supportShape.makeElementFuse(shapes);
+                    }
                 }
                 if (!cutShape.isNull()) {
                     auto shapes = getTransformedCompShape(supportShape, cutShape);
                     if (Base::Sequencer().wasCanceled()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
-                    supportShape.makeElementCut(shapes);
+                    if (!makeClusteredBoolean(supportShape, shapes, false)) {
+                        supportShape.makeElementCut(shapes);
+                    }
                 }
             }
             break;
@@ -458,7 +817,9 @@ App::DocumentObjectExecReturn* Transformed::execute()
             if (Base::Sequencer().wasCanceled()) {
                 return new App::DocumentObjectExecReturn("User aborted");
             }
-            supportShape.makeElementFuse(shapes);
+            if (!makeClusteredBoolean(supportShape, shapes, true)) {
+                supportShape.makeElementFuse(shapes);
+            }
             break;
         }
     }
@@ -44,6 +44,10 @@ public:
     bool getAllowCompoundDefault() const;
     void setAllowCompoundDefault(bool v);
 
+    /// Minimum number of pattern instances to fuse them as a tree of clusters, 0 to disable
+    long getPatternFuseTreeThreshold() const;
+    void setPatternFuseTreeThreshold(long v);
+
 private:
     void setup();
 };
@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 
@@ -31,11 +33,16 @@
 #include <App/DocumentObjectPy.h>
 #include <App/Property.h>
 #include <Base/Console.h>
+#include <Base/Converter.h>
 #include <Base/FileInfo.h>
+#include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
+#include <Base/Tools.h>
 
 #include "Points.h"
 #include "PointsAlgos.h"
+#include "PointsNormals.h"
 #include "PointsPy.h"
 #include "Properties.h"
 #include "Structured.h"
@@ -49,8 +56,20 @@ public:
     Module()
         : Py::ExtensionModule<Module>("Points")
     {
-        add_varargs_method("open", &Module::open);
-        add_varargs_method("insert", &Module::importer);
+        add_varargs_method(
+            "open",
+            &Module::open,
+            "open(string, [pointBudget]) -- Create a new document and load the points into it.\n"
+            "For E57 files the points are subsampled to roughly pointBudget points. 0 reads\n"
+            "all points and by default the budget of the preferences is used."
+        );
+        add_varargs_method(
+            "insert",
+            &Module::importer,
+            "insert(string, string, [pointBudget]) -- Load the points into the given document.\n"
+            "For E57 files the points are subsampled to roughly pointBudget points. 0 reads\n"
+            "all points and by default the budget of the preferences is used."
+        );
         add_varargs_method("export", &Module::exporter);
         add_varargs_method(
             "show",
@@ -58,11 +77,27 @@ public:
             "show(points,[string]) -- Add the points to the active document or "
             "create one if no document exists.  Returns document object."
         );
+        add_keyword_method(
+            "estimateNormals",
+            &Module::estimateNormals,
+            "estimateNormals(points, [kSearch=10, orient=True]) -- Estimate the normals of\n"
+            "a point cloud from the k nearest neighbours of each point. If orient is True\n"
+            "the normals are consistently oriented. Returns a list of vectors."
+        );
+        add_keyword_method(
+            "regionGrowing",
+            &Module::regionGrowing,
+            "regionGrowing(points, [normals, kSearch=10, smoothnessAngle=10.0,\n"
+            "curvature=0.05, minSize=50]) -- Segment a point cloud into smooth regions.\n"
+            "The smoothness angle is in degrees. If no normals are given they are estimated.\n"
+            "Returns a list of tuples with the point indices of each region."
+        );
         initialize("This module is the Points module.");  // register with Python
     }
 
 private:
-    std::tuple<bool, bool, double> readE57Settings() const
+    // A negative budget takes the budget of the preferences
+    std::unique_ptr<Reader> createE57Reader(long pointBudget) const
     {
         Base::Reference<ParameterGrp> hGrp = App::GetApplication()
                                                  .GetUserParameter()
@@ -72,13 +107,19 @@ private:
         bool useColor = hGrp->GetBool("UseColor", true);
         bool checkState = hGrp->GetBool("CheckInvalidState", true);
         double minDistance = hGrp->GetFloat("MinDistance", -1.);
+        if (pointBudget < 0) {
+            pointBudget = hGrp->GetInt("PointBudget", 0);
+        }
 
-        return std::make_tuple(useColor, checkState, minDistance);
+        auto reader = std::make_unique<E57Reader>(useColor, checkState, minDistance);
+        reader->setPointBudget(static_cast<std::size_t>(std::max<long>(pointBudget, 0)));
+        return reader;
     }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
-        if (!PyArg_ParseTuple(args.ptr(), "et", "utf-8", &Name)) {
+        long pointBudget {-1};
+        if (!PyArg_ParseTuple(args.ptr(), "et|l", "utf-8", &Name, &pointBudget)) {
             throw Py::Exception();
         }
         std::string EncodedName = std::string(Name);
@@ -98,12 +139,7 @@ private:
                 reader = std::make_unique<AscReader>();
             }
             else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(
-                    std::get<0>(setting),
-                    std::get<1>(setting),
-                    std::get<2>(setting)
-                );
+                reader = createE57Reader(pointBudget);
             }
             else if (file.hasExtension("ply")) {
                 reader = std::make_unique<PlyReader>();
@@ -205,7 +241,8 @@ private:
     {
         char* Name {};
         const char* DocName {};
-        if (!PyArg_ParseTuple(args.ptr(), "ets", "utf-8", &Name, &DocName)) {
+        long pointBudget {-1};
+        if (!PyArg_ParseTuple(args.ptr(), "ets|l", "utf-8", &Name, &DocName, &pointBudget)) {
             throw Py::Exception();
         }
         std::string EncodedName = std::string(Name);
@@ -225,12 +262,7 @@ private:
                 reader = std::make_unique<AscReader>();
             }
             else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(
-                    std::get<0>(setting),
-                    std::get<1>(setting),
-                    std::get<2>(setting)
-                );
+                reader = createE57Reader(pointBudget);
             }
             else if (file.hasExtension("ply")) {
                 reader = std::make_unique<PlyReader>();
@@ -442,6 +474,118 @@ private:
 
         return Py::None();
     }
+
+    Py::Object estimateNormals(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* pcObj {};
+        int kSearch = 10;
+        PyObject* orient = Py_True;
+        static const std::array<const char*, 4> kwList {"points", "kSearch", "orient", nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(
+                args.ptr(),
+                kwds.ptr(),
+                "O!|iO!",
+                kwList,
+                &(PointsPy::Type),
+                &pcObj,
+                &kSearch,
+                &PyBool_Type,
+                &orient
+            )) {
+            throw Py::Exception();
+        }
+
+        const PointKernel* kernel = static_cast<PointsPy*>(pcObj)->getPointKernelPtr();
+        NormalEstimation estimation(*kernel);
+        estimation.setKSearch(kSearch);
+        estimation.setOrientation(
+            Base::asBoolean(orient) ? NormalEstimation::Orientation::Propagate
+                                    : NormalEstimation::Orientation::None
+        );
+
+        std::vector<Base::Vector3f> normals;
+        estimation.perform(normals);
+
+        Py::List list(normals.size());
+        for (std::size_t i = 0; i < normals.size(); i++) {
+            list.setItem(i, Py::Vector(normals[i]));
+        }
+        return list;
+    }
+
+    Py::Object regionGrowing(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject* pcObj {};
+        PyObject* pyNormals = Py_None;
+        int kSearch = 10;
+        double angle = 10.0;
+        double curvature = 0.05;
+        int minSize = 50;
+        static const std::array<const char*, 7> kwList {
+            "points",
+            "normals",
+            "kSearch",
+            "smoothnessAngle",
+            "curvature",
+            "minSize",
+            nullptr
+        };
+        if (!Base::Wrapped_ParseTupleAndKeywords(
+                args.ptr(),
+                kwds.ptr(),
+                "O!|Oiddi",
+                kwList,
+                &(PointsPy::Type),
+                &pcObj,
+                &pyNormals,
+                &kSearch,
+                &angle,
+                &curvature,
+                &minSize
+            )) {
+            throw Py::Exception();
+        }
+
+        const PointKernel* kernel = static_cast<PointsPy*>(pcObj)->getPointKernelPtr();
+        std::vector<Base::Vector3f> normals;
+        std::vector<float> curvatures;
+        if (pyNormals == Py_None) {
+            NormalEstimation estimation(*kernel);
+            estimation.setKSearch(kSearch);
+            estimation.setOrientation(NormalEstimation::Orientation::None);
+            estimation.perform(normals, &curvatures);
+        }
+        else {
+            Py::Sequence list(pyNormals);
+            normals.reserve(list.size());
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                Base::Vector3d vec = Py::Vector(*it).toVector();
+                normals.push_back(Base::convertTo<Base::Vector3f>(vec));
+            }
+            if (normals.size() != kernel->size()) {
+                throw Py::ValueError("Number of normals doesn't match number of points");
+            }
+        }
+
+        RegionGrowing segm(*kernel, normals, curvatures);
+        segm.setKSearch(kSearch);
+        segm.setSmoothnessAngle(static_cast<float>(Base::toRadians(angle)));
+        segm.setCurvatureThreshold(static_cast<float>(curvature));
+        segm.setMinClusterSize(static_cast<std::size_t>(std::max(minSize, 1)));
+
+        std::vector<std::vector<unsigned long>> clusters;
+        segm.perform(clusters);
+
+        Py::List list;
+        for (const auto& it : clusters) {
+            Py::Tuple tuple(it.size());
+            for (std::size_t i = 0; i < it.size(); i++) {
+                tuple.setItem(i, Py::Long(it[i]));
+            }
+            list.append(tuple);
+        }
+        return list;
+    }
 };
 
 PyObject* initModule()
@@ -0,0 +1,617 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include <bit>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/Parameter.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Swap.h>
+
+#include "CompactFormat.h"
+#include "Properties.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+// Can't be the element count of the legacy layout because no list may have that many elements
+constexpr uint32_t Marker = 0xffffffff;
+constexpr uint8_t HeaderVersion = 1;
+
+enum class Encoding : uint8_t
+{
+    Float = 0,
+    Quantized = 1
+};
+
+struct Header
+{
+    bool compact {false};
+    Encoding encoding {Encoding::Float};
+    uint32_t count {0};
+};
+
+void checkStream(const std::istream& in)
+{
+    if (!in) {
+        throw Base::BadFormatError("Unexpected end of point data");
+    }
+}
+
+void checkCount(std::size_t count)
+{
+    if (count >= Marker) {
+        throw Base::ValueError("Too many elements to save");
+    }
+}
+
+void writeHeader(std::ostream& out, CompactFormat::Layout layout, std::size_t count)
+{
+    checkCount(count);
+
+    Base::OutputStream str(out);
+    if (layout == CompactFormat::Layout::Legacy) {
+        str << static_cast<uint32_t>(count);
+    }
+    else {
+        auto encoding = layout == CompactFormat::Layout::Quantized ? Encoding::Quantized
+                                                                   : Encoding::Float;
+        str << Marker << HeaderVersion << static_cast<uint8_t>(encoding)
+            << static_cast<uint32_t>(count);
+    }
+}
+
+Header readHeader(std::istream& in, bool compact)
+{
+    Base::InputStream str(in);
+    Header header;
+    uint32_t value = 0;
+    str >> value;
+    checkStream(in);
+    if (!compact) {
+        header.count = value;
+        return header;
+    }
+    if (value != Marker) {
+        throw Base::BadFormatError("Missing header of compact point data");
+    }
+
+    uint8_t version = 0;
+    uint8_t encoding = 0;
+    str >> version >> encoding >> header.count;
+    checkStream(in);
+    if (version != HeaderVersion || encoding > static_cast<uint8_t>(Encoding::Quantized)) {
+        throw Base::BadFormatError("Unsupported format of point data");
+    }
+
+    header.compact = true;
+    header.encoding = static_cast<Encoding>(encoding);
+    return header;
+}
+
+template<typename Func>
+void forEachChunk(std::size_t count, Func&& func)
+{
+    for (std::size_t first = 0; first < count; first += CompactFormat::ChunkSize) {
+        func(first, std::min(CompactFormat::ChunkSize, count - first));
+    }
+}
+
+// Writes the values as little-endian byte planes, i.e. the lowest byte of all values first
+template<typename T>
+void writePlanes(std::ostream& out, const std::vector<T>& values)
+{
+    const std::size_t num = values.size();
+    std::vector<char> buffer(num * sizeof(T));
+    const auto* src = reinterpret_cast<const char*>(values.data());
+    for (std::size_t byte = 0; byte < sizeof(T); byte++) {
+        std::size_t offset = std::endian::native == std::endian::little ? byte
+                                                                        : sizeof(T) - 1 - byte;
+        char* plane = buffer.data() + byte * num;
+        for (std::size_t i = 0; i < num; i++) {
+            plane[i] = src[i * sizeof(T) + offset];
+        }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+template<typename T>
+void readPlanes(std::istream& in, std::vector<T>& values)
+{
+    const std::size_t num = values.size();
+    std::vector<char> buffer(num * sizeof(T));
+    in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    checkStream(in);
+
+    auto* dst = reinterpret_cast<char*>(values.data());
+    for (std::size_t byte = 0; byte < sizeof(T); byte++) {
+        std::size_t offset = std::endian::native == std::endian::little ? byte
+                                                                        : sizeof(T) - 1 - byte;
+        const char* plane = buffer.data() + byte * num;
+        for (std::size_t i = 0; i < num; i++) {
+            dst[i * sizeof(T) + offset] = plane[i];
+        }
+    }
+}
+
+template<typename Getter>
+void writeFloats(std::ostream& out, std::size_t count, int components, Getter get)
+{
+    std::vector<float> plane;
+    forEachChunk(count, [&](std::size_t first, std::size_t num) {
+        plane.resize(num);
+        for (int comp = 0; comp < components; comp++) {
+            for (std::size_t i = 0; i < num; i++) {
+                plane[i] = get(first + i, comp);
+            }
+            writePlanes(out, plane);
+        }
+    });
+}
+
+template<typename Setter>
+void readFloats(std::istream& in, std::size_t count, int components, Setter set)
+{
+    std::vector<float> plane;
+    forEachChunk(count, [&](std::size_t first, std::size_t num) {
+        plane.resize(num);
+        for (int comp = 0; comp < components; comp++) {
+            readPlanes(in, plane);
+            for (std::size_t i = 0; i < num; i++) {
+                set(first + i, comp, plane[i]);
+            }
+        }
+    });
+}
+
+// The highest value marks non-finite values, e.g. the invalid points of a structured cloud
+template<typename T>
+constexpr T invalidValue()
+{
+    return std::numeric_limits<T>::max();
+}
+
+template<typename T>
+constexpr double quantizedRange()
+{
+    return static_cast<double>(invalidValue<T>() - 1);
+}
+
+// Writes for each chunk and component the range of the values followed by the values scaled to it
+template<typename T, typename Getter>
+void writeQuantized(std::ostream& out, std::size_t count, int components, Getter get)
+{
+    Base::OutputStream str(out);
+    std::vector<T> plane;
+    forEachChunk(count, [&](std::size_t first, std::size_t num) {
+        plane.resize(num);
+        for (int comp = 0; comp < components; comp++) {
+            float minValue = std::numeric_limits<float>::max();
+            float maxValue = -std::numeric_limits<float>::max();
+            for (std::size_t i = 0; i < num; i++) {
+                float value = get(first + i, comp);
+                if (std::isfinite(value)) {
+                    minValue = std::min(minValue, value);
+                    maxValue = std::max(maxValue, value);
+                }
+            }
+            if (minValue > maxValue) {
+                minValue = maxValue = 0.0F;
+            }
+
+            double range = static_cast<double>(maxValue) - static_cast<double>(minValue);
+            double scale = range > 0.0 ? quantizedRange<T>() / range : 0.0;
+            for (std::size_t i = 0; i < num; i++) {
+                float value = get(first + i, comp);
+                if (std::isfinite(value)) {
+                    plane[i] = static_cast<T>(std::lround((value - minValue) * scale));
+                }
+                else {
+                    plane[i] = invalidValue<T>();
+                }
+            }
+
+            str << minValue << maxValue;
+            writePlanes(out, plane);
+        }
+    });
+}
+
+template<typename T, typename Setter>
+void readQuantized(std::istream& in, std::size_t count, int components, Setter set)
+{
+    Base::InputStream str(in);
+    std::vector<T> plane;
+    forEachChunk(count, [&](std::size_t first, std::size_t num) {
+        plane.resize(num);
+        for (int comp = 0; comp < components; comp++) {
+            float minValue {};
+            float maxValue {};
+            str >> minValue >> maxValue;
+            readPlanes(in, plane);
+
+            double step = (static_cast<double>(maxValue) - static_cast<double>(minValue))
+                / quantizedRange<T>();
+            for (std::size_t i = 0; i < num; i++) {
+                if (plane[i] == invalidValue<T>()) {
+                    set(first + i, comp, std::numeric_limits<float>::quiet_NaN());
+                }
+                else {
+                    set(first + i, comp, static_cast<float>(minValue + plane[i] * step));
+                }
+            }
+        }
+    });
+}
+
+// The legacy layout writes the components of each element interleaved
+template<typename Getter>
+void writeLegacy(std::ostream& out, std::size_t count, int components, Getter get)
+{
+    Base::OutputStream str(out);
+    for (std::size_t i = 0; i < count; i++) {
+        for (int comp = 0; comp < components; comp++) {
+            str << get(i, comp);
+        }
+    }
+}
+
+template<typename Setter>
+void readLegacy(std::istream& in, std::size_t count, int components, Setter set)
+{
+    std::vector<float> values;
+    forEachChunk(count, [&](std::size_t first, std::size_t num) {
+        values.resize(num * components);
+        in.read(
+            reinterpret_cast<char*>(values.data()),
+            static_cast<std::streamsize>(values.size() * sizeof(float))
+        );
+        checkStream(in);
+        for (std::size_t i = 0; i < num; i++) {
+            for (int comp = 0; comp < components; comp++) {
+                float value = values[i * components + comp];
+                if constexpr (std::endian::native == std::endian::big) {
+                    Base::SwapEndian(value);
+                }
+                set(first + i, comp, value);
+            }
+        }
+    });
+}
+
+// Octahedral encoding of unit vectors: the vector is projected onto the octahedron and the lower
+// half is folded over the upper half so that the whole sphere maps onto the square [-1, 1]^2
+uint16_t toOctValue(double value)
+{
+    return static_cast<uint16_t>(std::lround((value * 0.5 + 0.5) * quantizedRange<uint16_t>()));
+}
+
+double fromOctValue(uint16_t value)
+{
+    return value / quantizedRange<uint16_t>() * 2.0 - 1.0;
+}
+
+double signNotZero(double value)
+{
+    return value < 0.0 ? -1.0 : 1.0;
+}
+
+void encodeNormal(const Base::Vector3f& normal, uint16_t& u, uint16_t& v)
+{
+    double x = normal.x;
+    double y = normal.y;
+    double z = normal.z;
+    double length = std::abs(x) + std::abs(y) + std::abs(z);
+    if (!std::isfinite(length)) {
+        u = v = invalidValue<uint16_t>();
+        return;
+    }
+    if (length == 0.0) {
+        z = length = 1.0;
+    }
+
+    double pu = x / length;
+    double pv = y / length;
+    if (z < 0.0) {
+        double fu = (1.0 - std::abs(pv)) * signNotZero(pu);
+        double fv = (1.0 - std::abs(pu)) * signNotZero(pv);
+        pu = fu;
+        pv = fv;
+    }
+
+    u = toOctValue(pu);
+    v = toOctValue(pv);
+}
+
+Base::Vector3f decodeNormal(uint16_t u, uint16_t v)
+{
+    if (u == invalidValue<uint16_t>() || v == invalidValue<uint16_t>()) {
+        float nan = std::numeric_limits<float>::quiet_NaN();
+        return Base::Vector3f(nan, nan, nan);
+    }
+
+    double x = fromOctValue(u);
+    double y = fromOctValue(v);
+    double z = 1.0 - std::abs(x) - std::abs(y);
+    if (z < 0.0) {
+        double fx = (1.0 - std::abs(y)) * signNotZero(x);
+        double fy = (1.0 - std::abs(x)) * signNotZero(y);
+        x = fx;
+        y = fy;
+    }
+
+    double length = std::sqrt(x * x + y * y + z * z);
+    return Base::Vector3f(
+        static_cast<float>(x / length),
+        static_cast<float>(y / length),
+        static_cast<float>(z / length)
+    );
+}
+
+template<typename Info>
+auto& curvatureComponent(Info& info, int comp)
+{
+    switch (comp) {
+        case 0:
+            return info.fMaxCurvature;
+        case 1:
+            return info.fMinCurvature;
+        case 2:
+        case 3:
+        case 4:
+            return info.cMaxCurvDir[comp - 2];
+        default:
+            return info.cMinCurvDir[comp - 5];
+    }
+}
+
+}  // namespace
+
+CompactFormat::Layout CompactFormat::getSaveLayout()
+{
+    ParameterGrp::handle hGrp = App::GetApplication()
+                                    .GetUserParameter()
+                                    .GetGroup("BaseApp")
+                                    ->GetGroup("Preferences")
+                                    ->GetGroup("Mod/Points");
+    if (!hGrp->GetBool("CompactFormat", false)) {
+        return Layout::Legacy;
+    }
+    return hGrp->GetBool("QuantizeOnSave", false) ? Layout::Quantized : Layout::Compact;
+}
+
+void CompactFormat::writeVersion(std::ostream& out)
+{
+    if (getSaveLayout() != Layout::Legacy) {
+        out << " version=\"" << Version << "\"";
+    }
+}
+
+bool CompactFormat::readVersion(const Base::XMLReader& reader)
+{
+    return reader.getAttribute<long>("version", 1) >= Version;
+}
+
+void CompactFormat::writePoints(
+    std::ostream& out,
+    const std::vector<Base::Vector3f>& pts,
+    Layout layout
+)
+{
+    auto get = [&pts](std::size_t index, int comp) {
+        return pts[index][comp];
+    };
+
+    writeHeader(out, layout, pts.size());
+    switch (layout) {
+        case Layout::Legacy:
+            writeLegacy(out, pts.size(), 3, get);
+            break;
+        case Layout::Compact:
+            writeFloats(out, pts.size(), 3, get);
+            break;
+        case Layout::Quantized:
+            writeQuantized<uint16_t>(out, pts.size(), 3, get);
+            break;
+    }
+}
+
+void CompactFormat::readPoints(std::istream& in, std::vector<Base::Vector3f>& pts, bool compact)
+{
+    Header header = readHeader(in, compact);
+    pts.resize(header.count);
+    auto set = [&pts](std::size_t index, int comp, float value) {
+        pts[index][comp] = value;
+    };
+
+    if (!header.compact) {
+        readLegacy(in, header.count, 3, set);
+    }
+    else if (header.encoding == Encoding::Quantized) {
+        readQuantized<uint16_t>(in, header.count, 3, set);
+    }
+    else {
+        readFloats(in, header.count, 3, set);
+    }
+}
+
+void CompactFormat::writeNormals(
+    std::ostream& out,
+    const std::vector<Base::Vector3f>& normals,
+    Layout layout
+)
+{
+    auto get = [&normals](std::size_t index, int comp) {
+        return normals[index][comp];
+    };
+
+    writeHeader(out, layout, normals.size());
+    if (layout == Layout::Legacy) {
+        writeLegacy(out, normals.size(), 3, get);
+        return;
+    }
+    if (layout == Layout::Compact) {
+        writeFloats(out, normals.size(), 3, get);
+        return;
+    }
+
+    std::vector<uint16_t> planeU;
+    std::vector<uint16_t> planeV;
+    forEachChunk(normals.size(), [&](std::size_t first, std::size_t num) {
+        planeU.resize(num);
+        planeV.resize(num);
+        for (std::size_t i = 0; i < num; i++) {
+            encodeNormal(normals[first + i], planeU[i], planeV[i]);
+        }
+        writePlanes(out, planeU);
+        writePlanes(out, planeV);
+    });
+}
+
+void CompactFormat::readNormals(
+    std::istream& in,
+    std::vector<Base::Vector3f>& normals,
+    bool compact
+)
+{
+    Header header = readHeader(in, compact);
+    normals.resize(header.count);
+    auto set = [&normals](std::size_t index, int comp, float value) {
+        normals[index][comp] = value;
+    };
+
+    if (!header.compact) {
+        readLegacy(in, header.count, 3, set);
+    }
+    else if (header.encoding == Encoding::Quantized) {
+        std::vector<uint16_t> planeU;
+        std::vector<uint16_t> planeV;
+        forEachChunk(header.count, [&](std::size_t first, std::size_t num) {
+            planeU.resize(num);
+            planeV.resize(num);
+            readPlanes(in, planeU);
+            readPlanes(in, planeV);
+            for (std::size_t i = 0; i < num; i++) {
+                normals[first + i] = decodeNormal(planeU[i], planeV[i]);
+            }
+        });
+    }
+    else {
+        readFloats(in, header.count, 3, set);
+    }
+}
+
+void CompactFormat::writeGreyValues(
+    std::ostream& out,
+    const std::vector<float>& values,
+    Layout layout
+)
+{
+    auto get = [&values](std::size_t index, int) {
+        return values[index];
+    };
+
+    writeHeader(out, layout, values.size());
+    switch (layout) {
+        case Layout::Legacy:
+            writeLegacy(out, values.size(), 1, get);
+            break;
+        case Layout::Compact:
+            writeFloats(out, values.size(), 1, get);
+            break;
+        case Layout::Quantized:
+            writeQuantized<uint8_t>(out, values.size(), 1, get);
+            break;
+    }
+}
+
+void CompactFormat::readGreyValues(std::istream& in, std::vector<float>& values, bool compact)
+{
+    Header header = readHeader(in, compact);
+    values.resize(header.count);
+    auto set = [&values](std::size_t index, int, float value) {
+        values[index] = value;
+    };
+
+    if (!header.compact) {
+        readLegacy(in, header.count, 1, set);
+    }
+    else if (header.encoding == Encoding::Quantized) {
+        readQuantized<uint8_t>(in, header.count, 1, set);
+    }
+    else {
+        readFloats(in, header.count, 1, set);
+    }
+}
+
+void CompactFormat::writeCurvatures(
+    std::ostream& out,
+    const std::vector<CurvatureInfo>& values,
+    Layout layout
+)
+{
+    auto get = [&values](std::size_t index, int comp) {
+        return curvatureComponent(values[index], comp);
+    };
+
+    if (layout == Layout::Quantized) {
+        layout = Layout::Compact;
+    }
+    writeHeader(out, layout, values.size());
+    if (layout == Layout::Legacy) {
+        writeLegacy(out, values.size(), 8, get);
+    }
+    else {
+        writeFloats(out, values.size(), 8, get);
+    }
+}
+
+void CompactFormat::readCurvatures(
+    std::istream& in,
+    std::vector<CurvatureInfo>& values,
+    bool compact
+)
+{
+    Header header = readHeader(in, compact);
+    values.resize(header.count);
+    auto set = [&values](std::size_t index, int comp, float value) {
+        curvatureComponent(values[index], comp) = value;
+    };
+
+    if (!header.compact) {
+        readLegacy(in, header.count, 8, set);
+    }
+    else {
+        readFloats(in, header.count, 8, set);
+    }
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Base
+{
+class XMLReader;
+}
+
+namespace Points
+{
+
+struct CurvatureInfo;
+
+/**
+ * The CompactFormat writes the data of the point cloud properties into the document files.
+ *
+ * The values are written in chunks of a fixed number of points. Inside a chunk the components
+ * are stored one after another and the bytes of the values are shuffled so that all first bytes
+ * come before all second bytes and so on. This way the data is read and written with a few large
+ * blocks and the compression of the project file finds far more redundancy than in interleaved
+ * floats.
+ *
+ * Optionally the values can be quantized: coordinates are stored as 16-bit fixed-point values
+ * relative to the bounding box of their chunk, normals as two 16-bit octahedral coordinates and
+ * grey values as 8-bit values relative to their chunk's range.
+ *
+ * Versions before the compact layout can't read it, so by default the legacy layout, i.e. the
+ * number of elements followed by the interleaved floats, is still written. The compact layout
+ * and the quantization must be enabled in the user parameters. The XML element of a property
+ * saved in the compact layout gets a version attribute, and its data starts with a marker that
+ * is never a valid element count of the legacy layout.
+ */
+class PointsExport CompactFormat
+{
+public:
+    /// Number of points per chunk
+    static constexpr std::size_t ChunkSize = 65536;
+    /// The value of the version attribute of the compact layout
+    static constexpr int Version = 2;
+
+    enum class Layout
+    {
+        /// The number of elements followed by the interleaved floats
+        Legacy,
+        /// Chunks of byte planes
+        Compact,
+        /// Chunks of byte planes with quantized values, this is lossy
+        Quantized
+    };
+
+    /// Returns the layout to save the document files with as set in the user parameters
+    static Layout getSaveLayout();
+    /// Writes the version attribute to an XML element if the compact layout is saved
+    static void writeVersion(std::ostream&);
+    /// Returns true if the current XML element was saved with the compact layout
+    static bool readVersion(const Base::XMLReader&);
+
+    static void writePoints(std::ostream&, const std::vector<Base::Vector3f>&, Layout);
+    static void readPoints(std::istream&, std::vector<Base::Vector3f>&, bool compact);
+
+    static void writeNormals(std::ostream&, const std::vector<Base::Vector3f>&, Layout);
+    static void readNormals(std::istream&, std::vector<Base::Vector3f>&, bool compact);
+
+    static void writeGreyValues(std::ostream&, const std::vector<float>&, Layout);
+    static void readGreyValues(std::istream&, std::vector<float>&, bool compact);
+
+    /// The curvatures are never quantized because the principal curvatures have no fixed range
+    static void writeCurvatures(std::ostream&, const std::vector<CurvatureInfo>&, Layout);
+    static void readCurvatures(std::istream&, std::vector<CurvatureInfo>&, bool compact);
+};
+
+}  // namespace Points
@@ -32,6 +32,7 @@
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
+#include "CompactFormat.h"
 #include "Points.h"
 #include "PointsAlgos.h"
 
@@ -192,19 +193,16 @@ void PointKernel::Save(Base::Writer& writer) const
     if (!writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Points file=\""
                         << writer.addFile(writer.ObjectName.c_str(), this) << "\" "
-                        << "mtrx=\"" << _Mtrx.toString() << "\"/>" << std::endl;
+                        << "mtrx=\"" << _Mtrx.toString() << "\"";
+        CompactFormat::writeVersion(writer.Stream());
+        writer.Stream() << "/>" << std::endl;
     }
 }
 
 void PointKernel::SaveDocFile(Base::Writer& writer) const
 {
-    Base::OutputStream str(writer.Stream());
-    uint32_t uCt = (uint32_t)size();
-    str << uCt;
     // store the data without transforming it
-    for (const auto& pnt : _Points) {
-        str << pnt.x << pnt.y << pnt.z;
-    }
+    CompactFormat::writePoints(writer.Stream(), _Points, CompactFormat::getSaveLayout());
 }
 
 void PointKernel::Restore(Base::XMLReader& reader)
@@ -213,6 +211,7 @@ void PointKernel::Restore(Base::XMLReader& reader)
 
     reader.readElement("Points");
     std::string file(reader.getAttribute<const char*>("file"));
+    compactFile = CompactFormat::readVersion(reader);
 
     if (!file.empty()) {
         // initiate a file read
@@ -226,17 +225,7 @@ void PointKernel::Restore(Base::XMLReader& reader)
 
 void PointKernel::RestoreDocFile(Base::Reader& reader)
 {
-    Base::InputStream str(reader);
-    uint32_t uCt = 0;
-    str >> uCt;
-    _Points.resize(uCt);
-    for (unsigned long i = 0; i < uCt; i++) {
-        float x {};
-        float y {};
-        float z {};
-        str >> x >> y >> z;
-        _Points[i].Set(x, y, z);
-    }
+    CompactFormat::readPoints(reader, _Points, compactFile);
 }
 
 void PointKernel::save(const char* file) const
@@ -129,6 +129,8 @@ public:
 private:
     Base::Matrix4D _Mtrx;
     std::vector<value_type> _Points;
+    /// The document file of the restored points uses the compact layout
+    bool compactFile {false};
 
 public:
     /// number of points stored
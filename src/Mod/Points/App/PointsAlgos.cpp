@@ -27,20 +27,32 @@
 #ifdef FC_OS_LINUX
 # include <unistd.h>
 #endif
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
 #include <sstream>
+#include <unordered_set>
+#include <QFile>
+#include <QtConcurrentMap>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
-#include <boost/regex.hpp>
 
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
-#include <Base/Sequencer.h>
 #include <Base/Stream.h>
+#include <Base/Tools.h>
 
 #include "PointsAlgos.h"
 #include <E57Format.h>
@@ -48,6 +60,358 @@
 
 using namespace Points;
 
+namespace
+{
+bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+bool isBlankLine(const char* first, const char* last)
+{
+    return std::all_of(first, last, isBlank);
+}
+
+const char* parseValueStrtod(const char* first, const char* last, double& value)
+{
+    // strtod needs a terminated string and mustn't skip over line breaks
+    std::array<char, 64> str {};
+    auto len = std::min<std::size_t>(last - first, str.size() - 1);
+    std::copy_n(first, len, str.begin());
+
+    char* end = nullptr;
+    value = std::strtod(str.data(), &end);
+    if (end == str.data()) {
+        return nullptr;
+    }
+    return first + (end - str.data());
+}
+
+// Parses a number after leading blanks and returns the position after it or null
+const char* parseValue(const char* first, const char* last, double& value)
+{
+    while (first != last && isBlank(*first)) {
+        ++first;
+    }
+    // from_chars doesn't accept a leading plus sign
+    if (first != last && *first == '+') {
+        ++first;
+    }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto [ptr, ec] = std::from_chars(first, last, value);
+    if (ec == std::errc()) {
+        return ptr;
+    }
+    if (ec == std::errc::invalid_argument) {
+        return nullptr;
+    }
+#endif
+    // not supported by the standard library or out of range
+    return parseValueStrtod(first, last, value);
+}
+
+// Parses the leading numbers of a line, advances first behind them and returns their number
+std::size_t parseLine(const char*& first, const char* last, double* values, std::size_t maxValues)
+{
+    std::size_t count = 0;
+    while (count < maxValues) {
+        const char* next = parseValue(first, last, values[count]);
+        if (!next) {
+            break;
+        }
+        first = next;
+        count++;
+    }
+    return count;
+}
+
+template<typename Func>
+void forEachLine(const char* begin, const char* end, Func&& func)
+{
+    while (begin < end) {
+        auto eol = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!eol) {
+            eol = end;
+        }
+        func(begin, eol);
+        begin = eol == end ? end : eol + 1;
+    }
+}
+
+// A range of whole lines that is parsed by one thread
+struct LineBlock
+{
+    const char* begin {nullptr};
+    const char* end {nullptr};
+    std::size_t firstRow {0};
+    std::size_t numRows {0};
+};
+
+std::vector<LineBlock> splitLines(const char* begin, const char* end)
+{
+    constexpr std::ptrdiff_t blockSize = 1 << 20;
+
+    std::vector<LineBlock> blocks;
+    while (begin < end) {
+        const char* stop = end;
+        if (end - begin > blockSize) {
+            const void* eol = std::memchr(begin + blockSize, '\n', end - begin - blockSize);
+            stop = eol ? static_cast<const char*>(eol) + 1 : end;
+        }
+
+        LineBlock block;
+        block.begin = begin;
+        block.end = stop;
+        blocks.push_back(block);
+        begin = stop;
+    }
+
+    return blocks;
+}
+
+// Returns the position after the first count non-blank lines
+const char* skipRows(const char* begin, const char* end, std::size_t count)
+{
+    while (count > 0 && begin < end) {
+        auto eol = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!eol) {
+            eol = end;
+        }
+        if (!isBlankLine(begin, eol)) {
+            count--;
+        }
+        begin = eol == end ? end : eol + 1;
+    }
+    return begin;
+}
+
+/* Parses the rows of numbers into data. The lines are first counted in parallel so that each
+ * block knows its first row and then parsed in parallel. Blank lines are skipped and lines
+ * behind the last row of data are ignored. Like the line-by-line readers did before, truncated
+ * data is tolerated: missing values of short lines and missing rows are set to zero.
+ */
+void parseRows(const char* begin, const char* end, Eigen::MatrixXd& data)
+{
+    std::vector<LineBlock> blocks = splitLines(begin, end);
+    QtConcurrent::blockingMap(blocks, [](LineBlock& block) {
+        forEachLine(block.begin, block.end, [&block](const char* first, const char* last) {
+            if (!isBlankLine(first, last)) {
+                block.numRows++;
+            }
+        });
+    });
+
+    std::size_t numRows = 0;
+    for (auto& it : blocks) {
+        it.firstRow = numRows;
+        numRows += it.numRows;
+    }
+
+    auto rows = static_cast<std::size_t>(data.rows());
+    if (numRows < rows) {
+        data.bottomRows(Eigen::Index(rows - numRows)).setZero();
+    }
+
+    Eigen::Index cols = data.cols();
+    QtConcurrent::blockingMap(blocks, [&data, rows, cols](LineBlock& block) {
+        std::vector<double> values(cols);
+        std::size_t row = block.firstRow;
+        forEachLine(block.begin, block.end, [&](const char* first, const char* last) {
+            if (row >= rows || isBlankLine(first, last)) {
+                return;
+            }
+            std::size_t num = parseLine(first, last, values.data(), values.size());
+            std::fill(values.begin() + std::ptrdiff_t(num), values.end(), 0.0);
+            for (Eigen::Index col = 0; col < cols; col++) {
+                data(Eigen::Index(row), col) = values[col];
+            }
+            row++;
+        });
+    });
+}
+
+/* Gives access to the data of a file behind the current position of the stream that has read
+ * the header. The data is mapped into memory and only read into a buffer if the file can't be
+ * mapped.
+ */
+class FileMapping
+{
+public:
+    FileMapping(const std::string& filename, std::istream& inp)
+        : file(QString::fromUtf8(filename.c_str()))
+    {
+        std::streamoff pos = inp.tellg();
+        if (pos >= 0 && file.open(QIODevice::ReadOnly)) {
+            qint64 size = file.size() - pos;
+            if (size <= 0) {
+                return;
+            }
+            if (uchar* ptr = file.map(pos, size)) {
+                mapped = {reinterpret_cast<const char*>(ptr), static_cast<std::size_t>(size)};
+                return;
+            }
+        }
+
+        buffer.assign(std::istreambuf_iterator<char>(inp), std::istreambuf_iterator<char>());
+        mapped = buffer;
+    }
+
+    std::span<const char> data() const
+    {
+        return mapped;
+    }
+
+    const char* begin() const
+    {
+        return mapped.data();
+    }
+
+    const char* end() const
+    {
+        return mapped.data() + mapped.size();
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping(FileMapping&&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+    FileMapping& operator=(FileMapping&&) = delete;
+
+private:
+    QFile file;
+    std::vector<char> buffer;
+    std::span<const char> mapped;
+};
+
+using ValueReader = double (*)(const char*);
+
+template<typename T, bool Swap>
+double readValue(const char* ptr)
+{
+    std::array<char, sizeof(T)> bytes {};
+    std::memcpy(bytes.data(), ptr, sizeof(T));
+    if constexpr (Swap) {
+        std::ranges::reverse(bytes);
+    }
+
+    T value {};
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return static_cast<double>(value);
+}
+
+template<typename T>
+ValueReader makeValueReader(bool swap)
+{
+    return swap ? &readValue<T, true> : &readValue<T, false>;
+}
+
+// Returns the function to decode a binary value of the kind 'I', 'U' or 'F'
+ValueReader makeValueReader(char kind, int size, bool bigEndian)
+{
+    bool swap = bigEndian != (std::endian::native == std::endian::big);
+    switch (size) {
+        case 1:
+            if (kind == 'I') {
+                return makeValueReader<int8_t>(swap);
+            }
+            if (kind == 'U') {
+                return makeValueReader<uint8_t>(swap);
+            }
+            break;
+        case 2:
+            if (kind == 'I') {
+                return makeValueReader<int16_t>(swap);
+            }
+            if (kind == 'U') {
+                return makeValueReader<uint16_t>(swap);
+            }
+            break;
+        case 4:
+            if (kind == 'I') {
+                return makeValueReader<int32_t>(swap);
+            }
+            if (kind == 'U') {
+                return makeValueReader<uint32_t>(swap);
+            }
+            if (kind == 'F') {
+                return makeValueReader<float>(swap);
+            }
+            break;
+        case 8:
+            if (kind == 'F') {
+                return makeValueReader<double>(swap);
+            }
+            break;
+        default:
+            break;
+    }
+
+    throw Base::BadFormatError("Unexpected type");
+}
+
+// Returns the kind of a PLY number type
+char plyValueKind(const std::string& type)
+{
+    if (type == "float" || type == "float32" || type == "double" || type == "float64") {
+        return 'F';
+    }
+    if (type == "uchar" || type == "uint8" || type == "ushort" || type == "uint16"
+        || type == "uint" || type == "uint32") {
+        return 'U';
+    }
+    if (type == "char" || type == "int8" || type == "short" || type == "int16" || type == "int"
+        || type == "int32") {
+        return 'I';
+    }
+    throw Base::BadFormatError("Not a valid number type");
+}
+
+/* Decodes the binary values of buffer into data. The values are stored point by point or, with
+ * transpose, field by field. Blocks of points are decoded in parallel.
+ */
+void decodeBinary(
+    std::span<const char> buffer,
+    const std::vector<ValueReader>& readers,
+    const std::vector<int>& sizes,
+    bool transpose,
+    Eigen::MatrixXd& data
+)
+{
+    Eigen::Index numPoints = data.rows();
+    Eigen::Index numFields = data.cols();
+
+    std::vector<std::size_t> offsets;
+    std::size_t stride = 0;
+    for (Eigen::Index j = 0; j < numFields; j++) {
+        offsets.push_back(stride);
+        stride += static_cast<std::size_t>(sizes[j]);
+    }
+    if (buffer.size() < stride * static_cast<std::size_t>(numPoints)) {
+        throw Base::BadFormatError("File expects too many elements");
+    }
+
+    constexpr Eigen::Index blockSize = 65536;
+    std::vector<std::pair<Eigen::Index, Eigen::Index>> blocks;
+    for (Eigen::Index i = 0; i < numPoints; i += blockSize) {
+        blocks.emplace_back(i, std::min(i + blockSize, numPoints));
+    }
+
+    const char* base = buffer.data();
+    QtConcurrent::blockingMap(blocks, [&](const std::pair<Eigen::Index, Eigen::Index>& block) {
+        for (Eigen::Index j = 0; j < numFields; j++) {
+            ValueReader read = readers[j];
+            std::size_t step = transpose ? static_cast<std::size_t>(sizes[j]) : stride;
+            std::size_t first = transpose ? offsets[j] * static_cast<std::size_t>(numPoints)
+                                          : offsets[j];
+            const char* ptr = base + first + static_cast<std::size_t>(block.first) * step;
+            for (Eigen::Index i = block.first; i < block.second; i++, ptr += step) {
+                data(i, j) = read(ptr);
+            }
+        }
+    });
+}
+}  // namespace
+
 void PointsAlgos::Load(PointKernel& points, const char* FileName)
 {
     Base::FileInfo File(FileName);
@@ -70,62 +434,51 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
 
 void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 {
-    boost::regex rx(
-        "^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$"
-    );
-    // boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    // boost::regex
-    // rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt = 0;
-    std::string line;
     Base::FileInfo fi(FileName);
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    FileMapping mapping(FileName, file);
 
-    Base::ifstream tmp_str(fi, std::ios::in);
+    struct PointBlock
+    {
+        LineBlock lines;
+        std::vector<Base::Vector3d> points;
+    };
 
-    // estimating size
-    while (std::getline(tmp_str, line)) {
-        LineCnt++;
+    std::vector<PointBlock> blocks;
+    for (const auto& it : splitLines(mapping.begin(), mapping.end())) {
+        blocks.push_back({it, {}});
     }
 
-    // resize the PointKernel
-    points.resize(LineCnt);
-
-    Base::SequencerLauncher seq("Loading points…", LineCnt);
-
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
-
     try {
-        // read file
-        while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
+        // read file: lines that don't consist of exactly three numbers are skipped
+        QtConcurrent::blockingMap(blocks, [](PointBlock& block) {
+            std::array<double, 3> xyz {};
+            forEachLine(block.lines.begin, block.lines.end, [&](const char* first, const char* last) {
+                if (parseLine(first, last, xyz.data(), xyz.size()) == xyz.size()
+                    && isBlankLine(first, last)) {
+                    block.points.emplace_back(xyz[0], xyz[1], xyz[2]);
+                }
+            });
+        });
 
-                points.setPoint(LineCnt, pt);
-                seq.next();
-                LineCnt++;
-            }
+        std::size_t numPoints = 0;
+        for (auto& it : blocks) {
+            it.lines.firstRow = numPoints;
+            numPoints += it.points.size();
         }
+
+        points.resize(numPoints);
+        QtConcurrent::blockingMap(blocks, [&points](const PointBlock& block) {
+            int index = static_cast<int>(block.lines.firstRow);
+            for (const auto& it : block.points) {
+                points.setPoint(index++, it);
+            }
+        });
     }
     catch (...) {
         points.clear();
         throw Base::BadFormatError("Reading in points failed.");
     }
-
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
-        points.erase(LineCnt, points.size());
-    }
 }
 
 // ----------------------------------------------------------------------------
@@ -252,94 +605,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(
-        std::streambuf::off_type off,
-        std::ios_base::seekdir way,
-        std::ios_base::openmode mode = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(
-        std::streambuf::pos_type pos,
-        std::ios_base::openmode which = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int lzfDecompress(
@@ -577,14 +842,15 @@ void PlyReader::read(const std::string& filename)
     this->height = 1;
 
     Eigen::MatrixXd data(numPoints, fields.size());
+    FileMapping mapping(filename, inp);
     if (format == "ascii") {
-        readAscii(inp, offset, data);
+        readAscii(mapping.data(), offset, data);
     }
     else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
+        readBinary(false, mapping.data(), offset, types, sizes, data);
     }
     else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
+        readBinary(true, mapping.data(), offset, types, sizes, data);
     }
 
     std::vector<std::string>::iterator it;
@@ -905,145 +1171,210 @@ std::size_t PlyReader::readHeader(
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
+void PlyReader::readAscii(std::span<const char> buffer, std::size_t offset, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
+    const char* end = buffer.data() + buffer.size();
 
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    // skip the lines of elements before the vertices
+    const char* begin = skipRows(buffer.data(), end, offset);
+    parseRows(begin, end, data);
 }
 
 void PlyReader::readBinary(
-    bool swapByteOrder,
-    std::istream& inp,
+    bool bigEndian,
+    std::span<const char> buffer,
     std::size_t offset,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
     Eigen::MatrixXd& data
 )
 {
-    Eigen::Index numPoints = data.rows();
     Eigen::Index numFields = data.cols();
 
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
+    std::vector<ValueReader> readers;
     for (Eigen::Index j = 0; j < numFields; j++) {
-        const std::string& t = types[j];
-        switch (sizes[j]) {
-            case 1:
-                if (t == "char" || t == "int8") {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == "uchar" || t == "uint8") {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == "short" || t == "int16") {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == "ushort" || t == "uint16") {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == "int" || t == "int32") {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == "uint" || t == "uint32") {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == "float" || t == "float32") {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == "double" || t == "float64") {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
+        readers.push_back(makeValueReader(plyValueKind(types[j]), sizes[j], bigEndian));
+    }
+
+    // skip the elements before the vertices and decode the whole vertex element at once
+    decodeBinary(buffer.subspan(std::min(offset, buffer.size())), readers, sizes, false, data);
+}
+
+// ----------------------------------------------------------------------------
+
+ChunkedReader::ChunkedReader() = default;
+
+ChunkedReader::~ChunkedReader() = default;
 
-        neededSize += converters.back()->getSizeOf();
+std::unique_ptr<ChunkedReader> ChunkedReader::create(const std::string& filename)
+{
+    Base::FileInfo fi(filename);
+    if (fi.hasExtension("asc")) {
+        return std::make_unique<AscChunkedReader>();
+    }
+    if (fi.hasExtension("ply")) {
+        return std::make_unique<PlyChunkedReader>();
+    }
+    if (fi.hasExtension("e57")) {
+        return std::make_unique<E57ChunkedReader>();
     }
 
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
+    return {};
+}
+
+AscChunkedReader::AscChunkedReader() = default;
+
+AscChunkedReader::~AscChunkedReader() = default;
+
+void AscChunkedReader::open(const std::string& filename)
+{
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileReadPermissionException(filename);
     }
+    inp = std::make_unique<Base::ifstream>(fi, std::ios::in);
+}
 
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
+bool AscChunkedReader::next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+{
+    pts.clear();
+    if (!inp) {
+        return false;
+    }
+
+    std::string line;
+    std::array<double, 3> xyz {};
+    while (pts.size() < maxPoints && std::getline(*inp, line)) {
+        // lines that don't start with three numbers are comments
+        const char* str = line.data();
+        if (parseLine(str, str + line.size(), xyz.data(), xyz.size()) == xyz.size()) {
+            pts.emplace_back(float(xyz[0]), float(xyz[1]), float(xyz[2]));
         }
     }
+
+    return !pts.empty();
 }
 
 // ----------------------------------------------------------------------------
 
-PcdReader::PcdReader() = default;
+PlyChunkedReader::PlyChunkedReader() = default;
 
-void PcdReader::read(const std::string& filename)
+PlyChunkedReader::~PlyChunkedReader() = default;
+
+void PlyChunkedReader::open(const std::string& filename)
 {
-    clear();
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileReadPermissionException(filename);
+    }
+    inp = std::make_unique<Base::ifstream>(fi, std::ios::in | std::ios::binary);
+
+    std::vector<std::string> fields;
+    std::vector<std::string> types;
+    std::vector<int> sizes;
+    numPoints = PlyReader::readHeader(*inp, format, offset, fields, types, sizes);
+    numRead = 0;
+
+    auto field = [&fields](const char* name) {
+        auto it = std::ranges::find(fields, name);
+        if (it == fields.end()) {
+            throw Base::BadFormatError("Missing coordinate in vertex element");
+        }
+        return static_cast<std::size_t>(std::distance(fields.begin(), it));
+    };
+    x = field("x");
+    y = field("y");
+    z = field("z");
+
+    readers.clear();
+    fieldOffsets.clear();
+    stride = 0;
+    if (format != "ascii") {
+        bool bigEndian = format == "binary_big_endian";
+        for (std::size_t i = 0; i < fields.size(); i++) {
+            readers.push_back(makeValueReader(plyValueKind(types[i]), sizes[i], bigEndian));
+            fieldOffsets.push_back(stride);
+            stride += static_cast<std::size_t>(sizes[i]);
+        }
+        inp->seekg(static_cast<std::streamoff>(offset), std::ios::cur);
+        offset = 0;
+    }
+}
+
+bool PlyChunkedReader::next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+{
+    pts.clear();
+    if (!inp || numRead >= numPoints) {
+        return false;
+    }
+
+    maxPoints = std::min(maxPoints, numPoints - numRead);
+    pts.reserve(maxPoints);
+    if (format == "ascii") {
+        return nextAscii(pts, maxPoints);
+    }
+    return nextBinary(pts, maxPoints);
+}
+
+bool PlyChunkedReader::nextAscii(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+{
+    std::size_t numFields = std::max({x, y, z}) + 1;
+    std::vector<double> values(numFields);
+    std::string line;
+    while (pts.size() < maxPoints && std::getline(*inp, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        // skip the lines of elements before the vertices
+        if (offset > 0) {
+            offset--;
+            continue;
+        }
+
+        // missing values of a short line are taken as zero
+        const char* str = line.data();
+        std::size_t num = parseLine(str, str + line.size(), values.data(), numFields);
+        std::fill(values.begin() + std::ptrdiff_t(num), values.end(), 0.0);
+        pts.emplace_back(float(values[x]), float(values[y]), float(values[z]));
+        numRead++;
+    }
+
+    // premature end of file
+    if (pts.size() < maxPoints) {
+        numRead = numPoints;
+    }
+    return !pts.empty();
+}
+
+bool PlyChunkedReader::nextBinary(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+{
+    std::vector<char> buffer(maxPoints * stride);
+    inp->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (static_cast<std::size_t>(inp->gcount()) < buffer.size()) {
+        throw Base::BadFormatError("File expects too many elements");
+    }
+
+    const char* ptr = buffer.data();
+    for (std::size_t i = 0; i < maxPoints; i++, ptr += stride) {
+        pts.emplace_back(
+            float(readers[x](ptr + fieldOffsets[x])),
+            float(readers[y](ptr + fieldOffsets[y])),
+            float(readers[z](ptr + fieldOffsets[z]))
+        );
+    }
+
+    numRead += pts.size();
+    return !pts.empty();
+}
+
+// ----------------------------------------------------------------------------
+
+PcdReader::PcdReader() = default;
+
+void PcdReader::read(const std::string& filename)
+{
+    clear();
     this->width = 0;
     this->height = 1;
 
@@ -1058,10 +1389,12 @@ void PcdReader::read(const std::string& filename)
 
     Eigen::MatrixXd data(numPoints, fields.size());
     if (format == "ascii") {
-        readAscii(inp, data);
+        FileMapping mapping(filename, inp);
+        readAscii(mapping.data(), data);
     }
     else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+        FileMapping mapping(filename, inp);
+        readBinary(false, mapping.data(), types, sizes, data);
     }
     else if (format == "binary_compressed") {
         unsigned int c {};
@@ -1073,10 +1406,7 @@ void PcdReader::read(const std::string& filename)
         inp.read(compressed.data(), c);
         std::vector<char> uncompressed(u);
         if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
+            readBinary(true, uncompressed, types, sizes, data);
         }
         else {
             throw Base::BadFormatError("Failed to decompress binary data");
@@ -1278,198 +1608,242 @@ std::size_t PcdReader::readHeader(
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
+void PcdReader::readAscii(std::span<const char> buffer, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    parseRows(buffer.data(), buffer.data() + buffer.size(), data);
 }
 
 void PcdReader::readBinary(
     bool transpose,
-    std::istream& inp,
+    std::span<const char> buffer,
     const std::vector<std::string>& types,
     const std::vector<int>& sizes,
     Eigen::MatrixXd& data
 )
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
+    // PCD files are written in little endian
+    std::vector<ValueReader> readers;
+    for (std::size_t j = 0; j < types.size(); j++) {
+        readers.push_back(makeValueReader(types[j][0], sizes[j], false));
+    }
 
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
+    decodeBinary(buffer, readers, sizes, transpose, data);
+}
 
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        char t = types[j][0];
-        switch (sizes[j]) {
-            case 1:
-                if (t == 'I') {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == 'I') {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == 'I') {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == 'F') {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == 'F') {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
+// ----------------------------------------------------------------------------
+
+VoxelSubsampler::VoxelSubsampler(std::size_t budget)
+    : budget {budget}
+{}
 
-        neededSize += converters.back()->getSizeOf();
+double VoxelSubsampler::getVoxelSize() const
+{
+    return voxelSize;
+}
+
+void VoxelSubsampler::setVoxelSize(double size)
+{
+    voxelSize = size;
+}
+
+bool VoxelSubsampler::isExceeded(std::size_t numPoints) const
+{
+    return budget > 0 && numPoints > budget;
+}
+
+bool VoxelSubsampler::insert(const Base::Vector3d& pnt)
+{
+    if (budget == 0 || voxelSize <= 0.0) {
+        return true;
     }
+    return voxels.insert(key(pnt)).second;
+}
 
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
+std::vector<bool> VoxelSubsampler::rebuild(const std::vector<Base::Vector3d>& pts)
+{
+    std::vector<bool> keep(pts.size(), true);
+    voxels.clear();
+    if (!isExceeded(pts.size()) && voxelSize <= 0.0) {
+        return keep;
+    }
+
+    if (voxelSize <= 0.0) {
+        // the points of a scan sample surfaces, so the number of voxels grows quadratically
+        Base::BoundBox3d box;
+        for (const auto& it : pts) {
+            box.Add(it);
+        }
+        voxelSize = box.CalcDiagonalLength() / std::sqrt(static_cast<double>(budget));
+        if (voxelSize <= 0.0) {
+            voxelSize = 1.0;
         }
     }
 
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
+    for (;;) {
+        voxels.clear();
+        bool fits = true;
+        for (std::size_t i = 0; i < pts.size() && fits; i++) {
+            keep[i] = voxels.insert(key(pts[i])).second;
+            fits = voxels.size() <= budget;
+        }
+        if (fits) {
+            return keep;
         }
+        voxelSize *= 1.5;
     }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
+}
+
+std::vector<bool> VoxelSubsampler::coarsen(const std::vector<Base::Vector3d>& pts)
+{
+    if (voxelSize > 0.0) {
+        voxelSize *= 1.5;
+    }
+    return rebuild(pts);
+}
+
+std::size_t VoxelSubsampler::KeyHash::operator()(const Key& key) const
+{
+    std::size_t seed = 0;
+    for (int64_t it : key) {
+        Base::hash_combine(seed, it);
+    }
+    return seed;
+}
+
+VoxelSubsampler::Key VoxelSubsampler::key(const Base::Vector3d& pnt) const
+{
+    return {
+        static_cast<int64_t>(std::floor(pnt.x / voxelSize)),
+        static_cast<int64_t>(std::floor(pnt.y / voxelSize)),
+        static_cast<int64_t>(std::floor(pnt.z / voxelSize))
+    };
+}
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+template<typename T>
+void compactValues(std::vector<T>& values, const std::vector<bool>& keep)
+{
+    if (values.size() != keep.size()) {
+        return;
+    }
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        if (keep[i]) {
+            values[count++] = values[i];
         }
     }
+    values.resize(count);
+}
+}  // namespace
+
+void ScanPoints::append(const ScanPoints& other)
+{
+    points.insert(points.end(), other.points.begin(), other.points.end());
+    colors.insert(colors.end(), other.colors.begin(), other.colors.end());
+    intensity.insert(intensity.end(), other.intensity.begin(), other.intensity.end());
+    normals.insert(normals.end(), other.normals.begin(), other.normals.end());
+}
+
+void ScanPoints::compact(const std::vector<bool>& keep)
+{
+    compactValues(points, keep);
+    compactValues(colors, keep);
+    compactValues(intensity, keep);
+    compactValues(normals, keep);
+}
+
+// ----------------------------------------------------------------------------
+
+ScanMerger::ScanMerger(std::size_t budget)
+    : sampler(budget)
+{}
+
+void ScanMerger::merge(ScanPoints& merged, const ScanPoints& scan)
+{
+    if (!merged.error.empty() || !scan.error.empty()) {
+        merged.error = merged.error.empty() ? scan.error : merged.error;
+        return;
+    }
+    merged.append(scan);
+    sampler.setVoxelSize(std::max(sampler.getVoxelSize(), scan.voxelSize));
+    if (sampler.isExceeded(merged.points.size())) {
+        merged.compact(sampler.rebuild(merged.points));
+    }
+    merged.voxelSize = sampler.getVoxelSize();
 }
 
 // ----------------------------------------------------------------------------
 
 namespace
 {
+// The XML parser of libE57Format isn't thread-safe while an image file is opened
+e57::ImageFile openImageFile(const std::string& filename)
+{
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    return {filename, "r"};
+}
+
+int countScans(const e57::ImageFile& imfi)
+{
+    e57::StructureNode root = imfi.root();
+    if (!root.isDefined("data3D")) {
+        return 0;
+    }
+    e57::VectorNode data3D(root.get("data3D"));
+    return static_cast<int>(data3D.childCount());
+}
+
+/* Reads one scan of an image file that is shared with the readers of the other scans.
+ * libE57Format doesn't allow concurrent access to an image file, so every call into it is
+ * guarded by the mutex while the decoded blocks are filtered and subsampled in parallel.
+ */
 class E57ReaderImp
 {
 public:
-    E57ReaderImp(const std::string& filename, bool color, bool state, double distance)
-        : imfi(filename, "r")
+    E57ReaderImp(
+        const e57::ImageFile& imfi,
+        std::mutex& mutex,
+        bool color,
+        bool state,
+        double distance,
+        std::size_t budget
+    )
+        : imfi(imfi)
+        , mutex(mutex)
         , useColor {color}
         , checkState {state}
         , minDistance {distance}
+        , sampler(budget)
     {}
 
-    void read()
+    // Reads the given scan of the data3D section
+    void readScan(int child)
     {
+        std::unique_lock<std::mutex> lock(mutex);
         e57::StructureNode root = imfi.root();
-        if (root.isDefined("data3D")) {
-            e57::VectorNode data3D(root.get("data3D"));
-            readData3D(data3D);
-        }
-    }
+        e57::VectorNode data3D(root.get("data3D"));
+        e57::StructureNode scan_data(data3D.get(child));
+        Base::Placement plm;
+        bool hasPlacement = getPlacement(scan_data, plm);
 
-    std::vector<Base::Color> getColors() const
-    {
-        return colors;
+        e57::CompressedVectorNode cvn(scan_data.get("points"));
+        e57::StructureNode prototype(cvn.prototype());
+        Proto proto = readProto(prototype);
+        processProto(lock, cvn, proto, hasPlacement, plm);
+        data.voxelSize = sampler.getVoxelSize();
     }
 
-    std::vector<float> getItensity() const
+    ScanPoints& getData()
     {
-        return intensity;
-    }
-
-    const PointKernel& getPoints() const
-    {
-        return points;
-    }
-
-    const std::vector<Base::Vector3f>& getNormals() const
-    {
-        return normals;
+        return data;
     }
 
 private:
-    void readData3D(const e57::VectorNode& data3D)
-    {
-        for (int child = 0; child < data3D.childCount(); ++child) {
-            e57::StructureNode scan_data(data3D.get(child));
-            Base::Placement plm;
-            bool hasPlacement = getPlacement(scan_data, plm);
-
-            e57::CompressedVectorNode cvn(scan_data.get("points"));
-            e57::StructureNode prototype(cvn.prototype());
-            Proto proto = readProto(prototype);
-            processProto(cvn, proto, hasPlacement, plm);
-        }
-    }
 
     struct Proto
     {
@@ -1716,9 +2090,11 @@ private:
         );
     }
 
+    // Expects the lock to be held and releases it only while a block is processed
     void processProto(
+        std::unique_lock<std::mutex>& lock,
         e57::CompressedVectorNode& cvn,
-        const Proto& proto,
+        Proto& proto,
         bool hasPlacement,
         const Base::Placement& plm
     )
@@ -1736,71 +2112,108 @@ private:
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
 
+        Base::Matrix4D mat = plm.toMatrix();
+        Base::Matrix4D rot;
+        plm.getRotation().getValue(rot);
+
         while ((count = cvr.read())) {
-            for (size_t i = 0; i < count; ++i) {
-                filter = false;
-                if (hasState) {
-                    if (proto.state[i] != 0) {
-                        filter = true;
-                    }
+            lock.unlock();
+            try {
+                if (hasPlacement) {
+                    applyPlacement(proto, count, hasNormal, mat, rot);
                 }
 
-                pt = getCoord(proto, i, hasPlacement, plm);
-
-                if ((!filter) && (cnt_pts > 0)) {
-                    if (Base::Distance(last, pt) < minDistance) {
-                        filter = true;
+                for (size_t i = 0; i < count; ++i) {
+                    filter = false;
+                    if (hasState) {
+                        if (proto.state[i] != 0) {
+                            filter = true;
+                        }
                     }
-                }
-                if (!filter) {
-                    cnt_pts++;
-                    points.push_back(pt);
-                    last = pt;
-                    if (hasColor) {
-                        colors.push_back(getColor(proto, i));
-                    }
-                    if (hasItensity) {
-                        intensity.push_back(proto.intensity[i]);
+
+                    pt = getCoord(proto, i);
+
+                    if ((!filter) && (cnt_pts > 0)) {
+                        if (Base::Distance(last, pt) < minDistance) {
+                            filter = true;
+                        }
                     }
-                    if (hasNormal) {
-                        normals.push_back(getNormal(proto, i, hasPlacement, plm.getRotation()));
+                    if (!filter) {
+                        cnt_pts++;
+                        last = pt;
+                        if (!sampler.insert(pt)) {
+                            continue;
+                        }
+                        data.points.push_back(pt);
+                        if (hasColor) {
+                            data.colors.push_back(getColor(proto, i));
+                        }
+                        if (hasItensity) {
+                            data.intensity.push_back(proto.intensity[i]);
+                        }
+                        if (hasNormal) {
+                            data.normals.push_back(getNormal(proto, i));
+                        }
                     }
                 }
+
+                if (sampler.isExceeded(data.points.size())) {
+                    data.compact(sampler.coarsen(data.points));
+                }
+            }
+            catch (...) {
+                // the reader must be destroyed with the lock held
+                lock.lock();
+                throw;
             }
+            lock.lock();
         }
+        cvr.close();
     }
 
-    Base::Vector3d getCoord(
-        const Proto& proto,
-        size_t index,
-        bool hasPlacement,
-        const Base::Placement& plm
+    // Transforms the coordinates and normals of a whole block at once
+    void applyPlacement(
+        Proto& proto,
+        std::size_t count,
+        bool hasNormal,
+        const Base::Matrix4D& mat,
+        const Base::Matrix4D& rot
     ) const
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            Base::Vector3d pt(proto.xData[i], proto.yData[i], proto.zData[i]);
+            mat.multVec(pt, pt);
+            proto.xData[i] = pt.x;
+            proto.yData[i] = pt.y;
+            proto.zData[i] = pt.z;
+        }
+
+        if (hasNormal) {
+            for (std::size_t i = 0; i < count; ++i) {
+                Base::Vector3d nor(proto.xNormal[i], proto.yNormal[i], proto.zNormal[i]);
+                rot.multVec(nor, nor);
+                proto.xNormal[i] = nor.x;
+                proto.yNormal[i] = nor.y;
+                proto.zNormal[i] = nor.z;
+            }
+        }
+    }
+
+    Base::Vector3d getCoord(const Proto& proto, size_t index) const
     {
         Base::Vector3d pt;
         pt.x = proto.xData[index];
         pt.y = proto.yData[index];
         pt.z = proto.zData[index];
-        if (hasPlacement) {
-            plm.multVec(pt, pt);
-        }
         return pt;
     }
 
-    Base::Vector3f getNormal(
-        const Proto& proto,
-        size_t index,
-        bool hasPlacement,
-        const Base::Rotation& rot
-    ) const
+    Base::Vector3f getNormal(const Proto& proto, size_t index) const
     {
         Base::Vector3f pt;
         pt.x = proto.xNormal[index];
         pt.y = proto.yNormal[index];
         pt.z = proto.zNormal[index];
-        if (hasPlacement) {
-            rot.multVec(pt, pt);
-        }
         return pt;
     }
 
@@ -1864,14 +2277,13 @@ private:
 
 private:
     e57::ImageFile imfi;
+    std::mutex& mutex;
     bool useColor;
     bool checkState;
     double minDistance;
-    const size_t buf_size = 1024;
-    std::vector<Base::Color> colors;
-    std::vector<float> intensity;
-    PointKernel points;
-    std::vector<Base::Vector3f> normals;
+    const size_t buf_size = 16384;
+    VoxelSubsampler sampler;
+    ScanPoints data;
 };
 }  // namespace
 
@@ -1881,15 +2293,64 @@ E57Reader::E57Reader(bool Color, bool State, double Distance)
     , minDistance {Distance}
 {}
 
+void E57Reader::setPointBudget(std::size_t budget)
+{
+    pointBudget = budget;
+}
+
 void E57Reader::read(const std::string& filename)
 {
     try {
-        E57ReaderImp reader(filename, useColor, checkState, minDistance);
-        reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
+        // The XML section is parsed once and the image file is shared by the scan readers
+        e57::ImageFile imfi = openImageFile(filename);
+        std::mutex mutex;
+        std::vector<int> scans(countScans(imfi));
+        std::iota(scans.begin(), scans.end(), 0);
+
+        // Each scan is decoded by its own reader and subsampled on its own. The results are
+        // merged in the order of the scans and subsampled again with the coarsest voxel size.
+        auto readScan = [&](int child) {
+            ScanPoints result;
+            try {
+                E57ReaderImp reader(imfi, mutex, useColor, checkState, minDistance, pointBudget);
+                reader.readScan(child);
+                result = std::move(reader.getData());
+            }
+            catch (const Base::Exception& e) {
+                result.error = e.what();
+            }
+            catch (const std::exception& e) {
+                result.error = e.what();
+            }
+            catch (...) {
+                result.error = "Reading E57 file failed";
+            }
+            return result;
+        };
+
+        ScanMerger merger(pointBudget);
+        auto mergeScan = [&merger](ScanPoints& merged, const ScanPoints& scan) {
+            merger.merge(merged, scan);
+        };
+
+        ScanPoints merged = QtConcurrent::blockingMappedReduced<ScanPoints>(
+            scans,
+            readScan,
+            mergeScan,
+            QtConcurrent::OrderedReduce | QtConcurrent::SequentialReduce
+        );
+        imfi.close();
+        if (!merged.error.empty()) {
+            throw Base::BadFormatError(merged.error);
+        }
+
+        points.reserve(merged.points.size());
+        for (const auto& it : merged.points) {
+            points.push_back(it);
+        }
+        normals = std::move(merged.normals);
+        colors = std::move(merged.colors);
+        intensity = std::move(merged.intensity);
         width = points.size();
         height = 1;
     }
@@ -1903,6 +2364,203 @@ void E57Reader::read(const std::string& filename)
 
 // ----------------------------------------------------------------------------
 
+class E57ChunkedReader::Private
+{
+public:
+    explicit Private(const std::string& filename)
+        : imfi(openImageFile(filename))
+        , numScans(countScans(imfi))
+        , xData(bufSize)
+        , yData(bufSize)
+        , zData(bufSize)
+        , state(bufSize)
+    {}
+
+    ~Private()
+    {
+        try {
+            closeScan();
+        }
+        catch (...) {
+        }
+    }
+
+    bool next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+    {
+        while (pts.size() < maxPoints) {
+            if (index >= count) {
+                if (!readBlock()) {
+                    break;
+                }
+                continue;
+            }
+
+            for (; index < count && pts.size() < maxPoints; index++) {
+                if (hasState && state[index] != 0) {
+                    continue;
+                }
+                Base::Vector3d pt(xData[index], yData[index], zData[index]);
+                if (hasPlacement) {
+                    mat.multVec(pt, pt);
+                }
+                pts.emplace_back(float(pt.x), float(pt.y), float(pt.z));
+            }
+        }
+
+        return !pts.empty();
+    }
+
+    Private(const Private&) = delete;
+    Private(Private&&) = delete;
+    Private& operator=(const Private&) = delete;
+    Private& operator=(Private&&) = delete;
+
+private:
+    // Reads the next block of the current scan or opens the next scan
+    bool readBlock()
+    {
+        index = 0;
+        count = 0;
+        while (count == 0) {
+            if (!reader) {
+                if (scan >= numScans) {
+                    return false;
+                }
+                openScan(scan++);
+                continue;
+            }
+
+            count = reader->read();
+            if (count == 0) {
+                closeScan();
+            }
+        }
+        return true;
+    }
+
+    void openScan(int child)
+    {
+        e57::StructureNode root = imfi.root();
+        e57::VectorNode data3D(root.get("data3D"));
+        e57::StructureNode scanData(data3D.get(child));
+        readPlacement(scanData);
+
+        e57::CompressedVectorNode cvn(scanData.get("points"));
+        e57::StructureNode prototype(cvn.prototype());
+        if (!prototype.isDefined("cartesianX") || !prototype.isDefined("cartesianY")
+            || !prototype.isDefined("cartesianZ")) {
+            throw Base::BadFormatError("Missing channels xyz");
+        }
+
+        // only the channels of interest are read
+        std::vector<e57::SourceDestBuffer> sdb;
+        sdb.emplace_back(imfi, "cartesianX", xData.data(), bufSize, true, true);
+        sdb.emplace_back(imfi, "cartesianY", yData.data(), bufSize, true, true);
+        sdb.emplace_back(imfi, "cartesianZ", zData.data(), bufSize, true, true);
+        hasState = prototype.isDefined("cartesianInvalidState");
+        if (hasState) {
+            sdb.emplace_back(imfi, "cartesianInvalidState", state.data(), bufSize, true, true);
+        }
+        reader = std::make_unique<e57::CompressedVectorReader>(cvn.reader(sdb));
+    }
+
+    void closeScan()
+    {
+        if (reader) {
+            reader->close();
+            reader.reset();
+        }
+    }
+
+    void readPlacement(const e57::StructureNode& scanData)
+    {
+        Base::Placement plm;
+        hasPlacement = false;
+        if (scanData.isDefined("pose")) {
+            e57::StructureNode pose(scanData.get("pose"));
+            if (pose.isDefined("rotation")) {
+                e57::StructureNode rotNode(pose.get("rotation"));
+                plm.setRotation(Base::Rotation(
+                    e57::FloatNode(rotNode.get("x")).value(),
+                    e57::FloatNode(rotNode.get("y")).value(),
+                    e57::FloatNode(rotNode.get("z")).value(),
+                    e57::FloatNode(rotNode.get("w")).value()
+                ));
+                hasPlacement = true;
+            }
+            if (pose.isDefined("translation")) {
+                e57::StructureNode transNode(pose.get("translation"));
+                plm.setPosition(Base::Vector3d(
+                    e57::FloatNode(transNode.get("x")).value(),
+                    e57::FloatNode(transNode.get("y")).value(),
+                    e57::FloatNode(transNode.get("z")).value()
+                ));
+                hasPlacement = true;
+            }
+        }
+        mat = plm.toMatrix();
+    }
+
+private:
+    static constexpr std::size_t bufSize = 16384;
+    e57::ImageFile imfi;
+    std::unique_ptr<e57::CompressedVectorReader> reader;
+    int numScans {0};
+    int scan {0};
+    std::size_t count {0};
+    std::size_t index {0};
+    bool hasState {false};
+    bool hasPlacement {false};
+    Base::Matrix4D mat;
+    std::vector<double> xData;
+    std::vector<double> yData;
+    std::vector<double> zData;
+    std::vector<int64_t> state;
+};
+
+E57ChunkedReader::E57ChunkedReader() = default;
+
+E57ChunkedReader::~E57ChunkedReader() = default;
+
+void E57ChunkedReader::open(const std::string& filename)
+{
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileReadPermissionException(filename);
+    }
+
+    try {
+        d = std::make_unique<Private>(filename);
+    }
+    catch (const Base::Exception&) {
+        throw;
+    }
+    catch (...) {
+        throw Base::BadFormatError("Reading E57 file failed");
+    }
+}
+
+bool E57ChunkedReader::next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints)
+{
+    pts.clear();
+    if (!d) {
+        return false;
+    }
+
+    try {
+        pts.reserve(maxPoints);
+        return d->next(pts, maxPoints);
+    }
+    catch (const Base::Exception&) {
+        throw;
+    }
+    catch (...) {
+        throw Base::BadFormatError("Reading E57 file failed");
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 Writer::Writer(const PointKernel& p)
     : points(p)
     , width(int(p.size()))
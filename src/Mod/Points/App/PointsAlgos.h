@@ -24,6 +24,12 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_set>
 #include <Eigen/Core>
 
 #include "Points.h"
@@ -95,8 +101,8 @@ public:
     PlyReader();
     void read(const std::string& filename) override;
 
-private:
-    std::size_t readHeader(
+    /// Reads the header and returns the number of vertices
+    static std::size_t readHeader(
         std::istream&,
         std::string& format,
         std::size_t& offset,
@@ -104,10 +110,12 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
+
+private:
+    void readAscii(std::span<const char> buffer, std::size_t offset, Eigen::MatrixXd& data);
     void readBinary(
-        bool swapByteOrder,
-        std::istream&,
+        bool bigEndian,
+        std::span<const char> buffer,
         std::size_t offset,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
@@ -129,25 +137,171 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
+    void readAscii(std::span<const char> buffer, Eigen::MatrixXd& data);
     void readBinary(
         bool transpose,
-        std::istream&,
+        std::span<const char> buffer,
         const std::vector<std::string>& types,
         const std::vector<int>& sizes,
         Eigen::MatrixXd& data
     );
 };
 
+/** Subsamples points with a voxel grid where only the first point of each voxel is kept.
+ * The grid starts once the budget is exceeded and is coarsened whenever more voxels than the
+ * budget are occupied, so that never much more than budget points must be held in memory.
+ */
+class PointsExport VoxelSubsampler
+{
+public:
+    /// With a budget of 0 all points are kept
+    explicit VoxelSubsampler(std::size_t budget);
+
+    double getVoxelSize() const;
+    void setVoxelSize(double size);
+    bool isExceeded(std::size_t numPoints) const;
+    /// Returns false if the point falls into an occupied voxel
+    bool insert(const Base::Vector3d& pnt);
+    /// Rebuilds the grid for the given points and returns which of them to keep
+    std::vector<bool> rebuild(const std::vector<Base::Vector3d>& pts);
+    /// Enlarges the voxels and returns which of the points to keep
+    std::vector<bool> coarsen(const std::vector<Base::Vector3d>& pts);
+
+private:
+    using Key = std::array<int64_t, 3>;
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+    Key key(const Base::Vector3d& pnt) const;
+
+private:
+    std::size_t budget;
+    double voxelSize {0.0};
+    std::unordered_set<Key, KeyHash> voxels;
+};
+
+/** The points and their attributes read from one or more scans
+ */
+struct PointsExport ScanPoints
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Color> colors;
+    std::vector<float> intensity;
+    std::vector<Base::Vector3f> normals;
+    /// The size of the voxels the points are subsampled with or 0
+    double voxelSize {0.0};
+    /// Set if the scan couldn't be read
+    std::string error;
+
+    void append(const ScanPoints& other);
+    /// Removes the points and their attributes that are not marked to keep
+    void compact(const std::vector<bool>& keep);
+};
+
+/** Merges scans in the order they are passed. Whenever the merged points exceed the budget
+ * they are subsampled again with the coarsest voxel size of the merged scans.
+ */
+class PointsExport ScanMerger
+{
+public:
+    explicit ScanMerger(std::size_t budget);
+    void merge(ScanPoints& merged, const ScanPoints& scan);
+
+private:
+    VoxelSubsampler sampler;
+};
+
 class PointsExport E57Reader: public Reader
 {
 public:
     E57Reader(bool Color, bool State, double Distance);
+    /** Limits the number of read points by voxel subsampling while the scans are read.
+     * With 0 all points are read.
+     */
+    void setPointBudget(std::size_t budget);
     void read(const std::string& filename) override;
 
 protected:
     bool useColor, checkState;
     double minDistance;
+    std::size_t pointBudget {0};
+};
+
+/** Reads the points of a file in chunks so that the whole point cloud never needs to be
+ * held in memory. This is meant for files that are too big to be loaded into a document.
+ */
+class PointsExport ChunkedReader
+{
+public:
+    ChunkedReader();
+    virtual ~ChunkedReader();
+    /// Opens the file and reads its header
+    virtual void open(const std::string& filename) = 0;
+    /** Reads at most \a maxPoints points into \a pts and returns false if there are no more
+     * points to read.
+     */
+    virtual bool next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints) = 0;
+
+    /// Returns a reader for the given file type or null if the type is not supported
+    static std::unique_ptr<ChunkedReader> create(const std::string& filename);
+
+    ChunkedReader(const ChunkedReader&) = delete;
+    ChunkedReader(ChunkedReader&&) = delete;
+    ChunkedReader& operator=(const ChunkedReader&) = delete;
+    ChunkedReader& operator=(ChunkedReader&&) = delete;
+};
+
+class PointsExport AscChunkedReader: public ChunkedReader
+{
+public:
+    AscChunkedReader();
+    ~AscChunkedReader() override;
+    void open(const std::string& filename) override;
+    bool next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints) override;
+
+private:
+    std::unique_ptr<std::istream> inp;
+};
+
+class PointsExport PlyChunkedReader: public ChunkedReader
+{
+public:
+    PlyChunkedReader();
+    ~PlyChunkedReader() override;
+    void open(const std::string& filename) override;
+    bool next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints) override;
+
+private:
+    bool nextAscii(std::vector<Base::Vector3f>& pts, std::size_t maxPoints);
+    bool nextBinary(std::vector<Base::Vector3f>& pts, std::size_t maxPoints);
+
+private:
+    std::unique_ptr<std::istream> inp;
+    std::vector<double (*)(const char*)> readers;
+    std::vector<std::size_t> fieldOffsets;
+    std::size_t stride {0};
+    std::string format;
+    std::size_t numPoints {0};
+    std::size_t numRead {0};
+    std::size_t offset {0};
+    std::size_t x {0}, y {0}, z {0};
+};
+
+/** Reads the points of all scans of an E57 file one after the other. The poses of the scans
+ * are applied and points with an invalid state are skipped.
+ */
+class PointsExport E57ChunkedReader: public ChunkedReader
+{
+public:
+    E57ChunkedReader();
+    ~E57ChunkedReader() override;
+    void open(const std::string& filename) override;
+    bool next(std::vector<Base::Vector3f>& pts, std::size_t maxPoints) override;
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
 };
 
 class PointsExport Writer
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <QtConcurrentMap>
+
+#include "PointsKdTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+float distanceToBox(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    float dx = std::max({box.MinX - pnt.x, 0.0F, pnt.x - box.MaxX});
+    float dy = std::max({box.MinY - pnt.y, 0.0F, pnt.y - box.MaxY});
+    float dz = std::max({box.MinZ - pnt.z, 0.0F, pnt.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+PointsKdTree::PointsKdTree(std::size_t maxPointsPerLeaf)
+    : maxPointsPerLeaf(std::max<std::size_t>(maxPointsPerLeaf, 2))
+{}
+
+void PointsKdTree::build(const std::vector<Base::Vector3f>& pts)
+{
+    clear();
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        const Base::Vector3f& pnt = pts[i];
+        if (!std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z)) {
+            indices.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    if (indices.empty()) {
+        return;
+    }
+
+    // the median splits give leaves of nearly the same size on the same level
+    std::size_t depth = 0;
+    while (((indices.size() - 1) >> depth) + 1 > maxPointsPerLeaf) {
+        depth++;
+    }
+    firstLeaf = (std::size_t(1) << depth) - 1;
+    nodes.resize(2 * firstLeaf + 1);
+    nodes[0].count = static_cast<uint32_t>(indices.size());
+
+    // build the upper levels serially and the subtrees below them in parallel
+    std::size_t level = std::min<std::size_t>(depth, 6);
+    std::size_t firstSubtree = (std::size_t(1) << level) - 1;
+    for (std::size_t node = 0; node < firstSubtree; node++) {
+        buildNode(pts, node, false);
+    }
+
+    std::vector<std::size_t> subtrees(firstSubtree + 1);
+    std::iota(subtrees.begin(), subtrees.end(), firstSubtree);
+    QtConcurrent::blockingMap(subtrees, [this, &pts](std::size_t node) {
+        buildNode(pts, node, true);
+    });
+
+    // keep the points in leaf order for a better memory locality
+    points.reserve(indices.size());
+    for (uint32_t index : indices) {
+        points.push_back(pts[index]);
+    }
+}
+
+void PointsKdTree::buildNode(
+    const std::vector<Base::Vector3f>& pts,
+    std::size_t node,
+    bool recursive
+)
+{
+    Node& current = nodes[node];
+    auto begin = indices.begin() + current.first;
+    auto end = begin + current.count;
+    for (auto it = begin; it != end; ++it) {
+        current.box.Add(pts[*it]);
+    }
+    if (isLeaf(node)) {
+        return;
+    }
+
+    // split at the median of the longest side
+    float lx = current.box.LengthX();
+    float ly = current.box.LengthY();
+    float lz = current.box.LengthZ();
+    unsigned short axis = (lx >= ly && lx >= lz) ? 0 : (ly >= lz ? 1 : 2);
+    uint32_t half = current.count / 2;
+    std::nth_element(begin, begin + half, end, [&pts, axis](uint32_t a, uint32_t b) {
+        return pts[a][axis] < pts[b][axis];
+    });
+
+    std::size_t left = 2 * node + 1;
+    nodes[left].first = current.first;
+    nodes[left].count = half;
+    nodes[left + 1].first = current.first + half;
+    nodes[left + 1].count = current.count - half;
+    if (recursive) {
+        buildNode(pts, left, true);
+        buildNode(pts, left + 1, true);
+    }
+}
+
+void PointsKdTree::clear()
+{
+    nodes.clear();
+    points.clear();
+    indices.clear();
+    firstLeaf = 0;
+}
+
+bool PointsKdTree::empty() const
+{
+    return points.empty();
+}
+
+std::size_t PointsKdTree::size() const
+{
+    return points.size();
+}
+
+bool PointsKdTree::isLeaf(std::size_t node) const
+{
+    return node >= firstLeaf;
+}
+
+void PointsKdTree::nearest(const Base::Vector3f& pnt, std::size_t k, std::vector<Neighbour>& result)
+    const
+{
+    result.clear();
+    if (nodes.empty() || k == 0) {
+        return;
+    }
+
+    // the result is used as max-heap while searching
+    search(0, pnt, k, result);
+    std::sort_heap(result.begin(), result.end());
+}
+
+void PointsKdTree::nearest(const Base::Vector3f& pnt, std::size_t k, std::vector<uint32_t>& result)
+    const
+{
+    std::vector<Neighbour> neighbours;
+    nearest(pnt, k, neighbours);
+    result.clear();
+    for (const auto& it : neighbours) {
+        result.push_back(it.second);
+    }
+}
+
+void PointsKdTree::search(
+    std::size_t node,
+    const Base::Vector3f& pnt,
+    std::size_t k,
+    std::vector<Neighbour>& heap
+) const
+{
+    const Node& current = nodes[node];
+    if (heap.size() == k && distanceToBox(current.box, pnt) >= heap.front().first) {
+        return;
+    }
+
+    if (isLeaf(node)) {
+        for (uint32_t i = current.first; i < current.first + current.count; i++) {
+            Neighbour candidate(Base::DistanceP2(points[i], pnt), indices[i]);
+            if (heap.size() < k) {
+                heap.push_back(candidate);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (candidate < heap.front()) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = candidate;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        return;
+    }
+
+    // visit the closer child first
+    std::size_t left = 2 * node + 1;
+    std::size_t right = left + 1;
+    if (distanceToBox(nodes[right].box, pnt) < distanceToBox(nodes[left].box, pnt)) {
+        std::swap(left, right);
+    }
+    search(left, pnt, k, heap);
+    search(right, pnt, k, heap);
+}
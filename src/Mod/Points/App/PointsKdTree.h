@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/** A balanced k-d tree for nearest neighbour queries on large point clouds.
+ * The tree is complete, so the children of node i are 2i+1 and 2i+2 and all leaves are on the
+ * same level. Points with NaN coordinates are not added. The queries are thread-safe.
+ */
+class PointsExport PointsKdTree
+{
+public:
+    /// The squared distance and the input index of a found point
+    using Neighbour = std::pair<float, uint32_t>;
+
+    explicit PointsKdTree(std::size_t maxPointsPerLeaf = 16);
+
+    /// Builds the tree for the given points. The subtrees are built in parallel.
+    void build(const std::vector<Base::Vector3f>& pts);
+    void clear();
+    bool empty() const;
+    std::size_t size() const;
+
+    /** Collects the \a k nearest points of \a pnt sorted by ascending distance. If \a pnt is part
+     * of the cloud it is the first result.
+     */
+    void nearest(const Base::Vector3f& pnt, std::size_t k, std::vector<Neighbour>& result) const;
+    /// Collects the input indices of the \a k nearest points of \a pnt.
+    void nearest(const Base::Vector3f& pnt, std::size_t k, std::vector<uint32_t>& result) const;
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        uint32_t first {0};
+        uint32_t count {0};
+    };
+
+    void buildNode(const std::vector<Base::Vector3f>& pts, std::size_t node, bool recursive);
+    void search(
+        std::size_t node,
+        const Base::Vector3f& pnt,
+        std::size_t k,
+        std::vector<Neighbour>& heap
+    ) const;
+    bool isLeaf(std::size_t node) const;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<Base::Vector3f> points;
+    std::vector<uint32_t> indices;
+    std::size_t maxPointsPerLeaf;
+    std::size_t firstLeaf {0};
+};
+
+}  // namespace Points
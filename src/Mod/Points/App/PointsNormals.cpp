@@ -0,0 +1,368 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <QtConcurrentMap>
+#include <Eigen/Eigenvalues>
+
+#include "PointsNormals.h"
+#include "Points.h"
+#include "PointsKdTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+constexpr uint32_t invalidIndex = std::numeric_limits<uint32_t>::max();
+
+std::vector<std::pair<std::size_t, std::size_t>> makeBlocks(std::size_t count)
+{
+    constexpr std::size_t blockSize = 4096;
+    std::vector<std::pair<std::size_t, std::size_t>> blocks;
+    blocks.reserve(count / blockSize + 1);
+    for (std::size_t i = 0; i < count; i += blockSize) {
+        blocks.emplace_back(i, std::min(i + blockSize, count));
+    }
+    return blocks;
+}
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+NormalEstimation::NormalEstimation(const PointKernel& pts)
+    : myPoints(pts)
+{}
+
+void NormalEstimation::setKSearch(int k)
+{
+    kSearch = k;
+}
+
+void NormalEstimation::setOrientation(Orientation orient)
+{
+    orientation = orient;
+}
+
+void NormalEstimation::setViewpoint(const Base::Vector3f& pnt)
+{
+    viewpoint = pnt;
+}
+
+void NormalEstimation::perform(std::vector<Base::Vector3f>& normals, std::vector<float>* curvatures)
+{
+    const std::vector<Base::Vector3f>& pts = myPoints.getBasicPoints();
+    std::size_t k = static_cast<std::size_t>(std::max(kSearch, 3));
+    bool keepNeighbours = orientation == Orientation::Propagate;
+
+    normals.assign(pts.size(), Base::Vector3f());
+    if (curvatures) {
+        curvatures->assign(pts.size(), 0.0F);
+    }
+
+    PointsKdTree tree;
+    tree.build(pts);
+
+    // the neighbourhood graph for the propagation of the orientation
+    std::vector<uint32_t> neighbours;
+    if (keepNeighbours) {
+        neighbours.resize(pts.size() * k, invalidIndex);
+    }
+
+    auto blocks = makeBlocks(pts.size());
+    QtConcurrent::blockingMap(blocks, [&](const std::pair<std::size_t, std::size_t>& block) {
+        std::vector<PointsKdTree::Neighbour> found;
+        for (std::size_t i = block.first; i < block.second; i++) {
+            const Base::Vector3f& pnt = pts[i];
+            if (!isValid(pnt)) {
+                continue;
+            }
+
+            tree.nearest(pnt, k, found);
+            if (keepNeighbours) {
+                for (std::size_t j = 0; j < found.size(); j++) {
+                    neighbours[i * k + j] = found[j].second;
+                }
+            }
+            if (found.size() < 3) {
+                continue;
+            }
+
+            // fit the tangent plane through the centroid of the neighbourhood
+            Eigen::Vector3d center = Eigen::Vector3d::Zero();
+            for (const auto& it : found) {
+                const Base::Vector3f& p = pts[it.second];
+                center += Eigen::Vector3d(p.x, p.y, p.z);
+            }
+            center /= static_cast<double>(found.size());
+
+            Eigen::Matrix3d cov = Eigen::Matrix3d::Zero();
+            for (const auto& it : found) {
+                const Base::Vector3f& p = pts[it.second];
+                Eigen::Vector3d d = Eigen::Vector3d(p.x, p.y, p.z) - center;
+                cov += d * d.transpose();
+            }
+
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig;
+            eig.computeDirect(cov);
+            Eigen::Vector3d ev = eig.eigenvalues();
+            Eigen::Vector3d nv = eig.eigenvectors().col(0);
+
+            Base::Vector3f normal(float(nv.x()), float(nv.y()), float(nv.z()));
+            if (orientation == Orientation::Viewpoint && normal * (viewpoint - pnt) < 0.0F) {
+                normal = -normal;
+            }
+            normals[i] = normal;
+
+            double sum = ev.sum();
+            if (curvatures && sum > 0.0) {
+                (*curvatures)[i] = float(std::max(ev[0], 0.0) / sum);
+            }
+        }
+    });
+
+    if (keepNeighbours) {
+        propagate(normals, neighbours);
+    }
+}
+
+void NormalEstimation::propagate(
+    std::vector<Base::Vector3f>& normals,
+    const std::vector<uint32_t>& neighbours
+) const
+{
+    const std::vector<Base::Vector3f>& pts = myPoints.getBasicPoints();
+    std::size_t k = neighbours.size() / std::max<std::size_t>(pts.size(), 1);
+
+    std::vector<bool> visited(pts.size(), false);
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        if (normals[i] == Base::Vector3f()) {
+            visited[i] = true;
+        }
+    }
+
+    // start each connected part with its highest point whose normal points upwards
+    std::vector<uint32_t> seeds(pts.size());
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(seeds.begin(), seeds.end(), [&pts](uint32_t a, uint32_t b) {
+        return pts[a].z > pts[b].z;
+    });
+
+    // Prim's algorithm on the neighbourhood graph where the weight of an edge is small if the
+    // normals are nearly parallel
+    using Edge = std::tuple<float, uint32_t, uint32_t>;
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<>> queue;
+    auto visit = [&](uint32_t index) {
+        visited[index] = true;
+        const Base::Vector3f& normal = normals[index];
+        for (std::size_t j = 0; j < k; j++) {
+            uint32_t next = neighbours[index * k + j];
+            if (next != invalidIndex && !visited[next]) {
+                queue.emplace(1.0F - std::fabs(normal * normals[next]), next, index);
+            }
+        }
+    };
+
+    for (uint32_t seed : seeds) {
+        if (visited[seed]) {
+            continue;
+        }
+        if (normals[seed].z < 0.0F) {
+            normals[seed] = -normals[seed];
+        }
+        visit(seed);
+
+        while (!queue.empty()) {
+            auto [weight, index, parent] = queue.top();
+            queue.pop();
+            if (visited[index]) {
+                continue;
+            }
+            if (normals[index] * normals[parent] < 0.0F) {
+                normals[index] = -normals[index];
+            }
+            visit(index);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+RegionGrowing::RegionGrowing(
+    const PointKernel& pts,
+    const std::vector<Base::Vector3f>& normals,
+    const std::vector<float>& curvatures
+)
+    : myPoints(pts)
+    , myNormals(normals)
+    , myCurvatures(curvatures)
+{}
+
+void RegionGrowing::setKSearch(int k)
+{
+    kSearch = k;
+}
+
+void RegionGrowing::setSmoothnessAngle(float angle)
+{
+    smoothnessAngle = angle;
+}
+
+void RegionGrowing::setCurvatureThreshold(float value)
+{
+    curvatureThreshold = value;
+}
+
+void RegionGrowing::setMinClusterSize(std::size_t size)
+{
+    minClusterSize = size;
+}
+
+void RegionGrowing::perform(std::vector<std::vector<unsigned long>>& clusters)
+{
+    clusters.clear();
+    const std::vector<Base::Vector3f>& pts = myPoints.getBasicPoints();
+    if (pts.size() != myNormals.size()
+        || (!myCurvatures.empty() && myCurvatures.size() != pts.size())) {
+        return;
+    }
+
+    std::size_t k = static_cast<std::size_t>(std::max(kSearch, 1)) + 1;
+    float cosAngle = std::cos(smoothnessAngle);
+    auto isUsable = [&](std::size_t index) {
+        return isValid(pts[index]) && myNormals[index] != Base::Vector3f();
+    };
+    auto isSmooth = [&](std::size_t index) {
+        return myCurvatures.empty() || myCurvatures[index] < curvatureThreshold;
+    };
+
+    PointsKdTree tree;
+    tree.build(pts);
+
+    // Instead of growing one region after the other the regions are the connected components of
+    // the graph of smooth neighbours. They are computed with a lock-free union-find where the
+    // root with the higher index is always linked below the other one. This makes the result
+    // independent of the order of the points and the number of threads.
+    std::vector<std::atomic<uint32_t>> parent(pts.size());
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        parent[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+    }
+
+    auto find = [&parent](uint32_t index) {
+        uint32_t next = parent[index].load(std::memory_order_relaxed);
+        while (next != index) {
+            // path halving only ever moves a node closer to its root
+            uint32_t grand = parent[next].load(std::memory_order_relaxed);
+            parent[index].compare_exchange_weak(next, grand, std::memory_order_relaxed);
+            index = next;
+            next = parent[index].load(std::memory_order_relaxed);
+        }
+        return index;
+    };
+    auto unite = [&parent, &find](uint32_t a, uint32_t b) {
+        for (;;) {
+            a = find(a);
+            b = find(b);
+            if (a == b) {
+                return;
+            }
+            if (a > b) {
+                std::swap(a, b);
+            }
+            uint32_t expected = b;
+            if (parent[b].compare_exchange_strong(expected, a, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    };
+
+    // points with a high curvature are edges of the regions and are attached to the nearest
+    // smooth neighbour without connecting it to anything else
+    std::vector<uint32_t> attach(pts.size(), invalidIndex);
+
+    auto blocks = makeBlocks(pts.size());
+    QtConcurrent::blockingMap(blocks, [&](const std::pair<std::size_t, std::size_t>& block) {
+        std::vector<PointsKdTree::Neighbour> found;
+        for (std::size_t i = block.first; i < block.second; i++) {
+            if (!isUsable(i)) {
+                continue;
+            }
+
+            bool smooth = isSmooth(i);
+            tree.nearest(pts[i], k, found);
+            for (const auto& it : found) {
+                uint32_t j = it.second;
+                if (j == i || !isUsable(j) || !isSmooth(j)) {
+                    continue;
+                }
+                if (std::fabs(myNormals[i] * myNormals[j]) < cosAngle) {
+                    continue;
+                }
+                if (smooth) {
+                    unite(static_cast<uint32_t>(i), j);
+                }
+                else {
+                    attach[i] = j;
+                    break;
+                }
+            }
+        }
+    });
+
+    std::vector<std::size_t> clusterOf(pts.size(), std::numeric_limits<std::size_t>::max());
+    std::vector<std::vector<unsigned long>> regions;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        if (!isUsable(i)) {
+            continue;
+        }
+        uint32_t root = attach[i] != invalidIndex ? find(attach[i])
+                                                  : find(static_cast<uint32_t>(i));
+        std::size_t& index = clusterOf[root];
+        if (index == std::numeric_limits<std::size_t>::max()) {
+            index = regions.size();
+            regions.emplace_back();
+        }
+        regions[index].push_back(static_cast<unsigned long>(i));
+    }
+
+    for (auto& it : regions) {
+        if (it.size() >= minClusterSize) {
+            clusters.push_back(std::move(it));
+        }
+    }
+    std::stable_sort(clusters.begin(), clusters.end(), [](const auto& a, const auto& b) {
+        return a.size() > b.size();
+    });
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+class PointKernel;
+
+/** Estimates the normals of a point cloud by a principal component analysis of the k nearest
+ * neighbours of each point. The curvature is the surface variation, i.e. the smallest eigenvalue
+ * divided by the sum of all eigenvalues.
+ */
+class PointsExport NormalEstimation
+{
+public:
+    enum class Orientation
+    {
+        /// The sign of the normals is arbitrary
+        None,
+        /// The normals point to the viewpoint, e.g. the position of the scanner
+        Viewpoint,
+        /// The orientation is propagated along a minimum spanning tree of the neighbourhood graph
+        Propagate
+    };
+
+    explicit NormalEstimation(const PointKernel&);
+
+    /// Sets the number of neighbours used to fit the tangent plane. The default is 10.
+    void setKSearch(int);
+    void setOrientation(Orientation);
+    void setViewpoint(const Base::Vector3f&);
+    /** Computes the normals and optionally the curvatures. Points with NaN coordinates or too few
+     * neighbours get a zero normal.
+     */
+    void perform(std::vector<Base::Vector3f>& normals, std::vector<float>* curvatures = nullptr);
+
+private:
+    void propagate(
+        std::vector<Base::Vector3f>& normals,
+        const std::vector<uint32_t>& neighbours
+    ) const;
+
+private:
+    const PointKernel& myPoints;
+    int kSearch {10};
+    Orientation orientation {Orientation::Propagate};
+    Base::Vector3f viewpoint;
+};
+
+/** Segments a point cloud into smooth regions. Two neighbouring points belong to the same region
+ * if the angle between their normals is below the smoothness angle. Points whose curvature exceeds
+ * the threshold are added to a neighbouring region but don't let it grow any further.
+ */
+class PointsExport RegionGrowing
+{
+public:
+    /// The curvatures may be empty, then all points can extend a region
+    RegionGrowing(
+        const PointKernel&,
+        const std::vector<Base::Vector3f>& normals,
+        const std::vector<float>& curvatures
+    );
+
+    /// Sets the number of neighbours of each point. The default is 10.
+    void setKSearch(int);
+    /// Sets the maximum angle in radians between the normals of neighbouring points
+    void setSmoothnessAngle(float);
+    void setCurvatureThreshold(float);
+    /// Regions with fewer points are ignored
+    void setMinClusterSize(std::size_t);
+    /// The regions are sorted by size in descending order
+    void perform(std::vector<std::vector<unsigned long>>& clusters);
+
+private:
+    const PointKernel& myPoints;
+    const std::vector<Base::Vector3f>& myNormals;
+    const std::vector<float>& myCurvatures;
+    int kSearch {10};
+    float smoothnessAngle {0.1745F};
+    float curvatureThreshold {0.05F};
+    std::size_t minClusterSize {1};
+};
+
+}  // namespace Points
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+bool PointsOctree::Node::isLeaf() const
+{
+    return std::ranges::all_of(children, [](int32_t child) { return child < 0; });
+}
+
+PointsOctree::PointsOctree(std::size_t maxPointsPerNode, int maxDepth)
+    : maxPointsPerNode(std::max<std::size_t>(maxPointsPerNode, 1))
+    , maxDepth(maxDepth)
+{}
+
+void PointsOctree::build(const std::vector<Base::Vector3f>& pts)
+{
+    clear();
+    if (pts.empty()) {
+        return;
+    }
+
+    indices.resize(pts.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    // the nodes are subdivided as cubes while their bounding boxes are kept tight
+    Base::BoundBox3f box;
+    for (const auto& it : pts) {
+        box.Add(it);
+    }
+    float length = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    Base::BoundBox3f cube(
+        box.MinX,
+        box.MinY,
+        box.MinZ,
+        box.MinX + length,
+        box.MinY + length,
+        box.MinZ + length
+    );
+    buildNode(pts, cube, 0, pts.size(), 0);
+}
+
+int32_t PointsOctree::buildNode(
+    const std::vector<Base::Vector3f>& pts,
+    const Base::BoundBox3f& cube,
+    std::size_t first,
+    std::size_t count,
+    int depth
+)
+{
+    auto nodeIndex = static_cast<int32_t>(nodes.size());
+    nodes.emplace_back();
+
+    Node node;
+    node.first = first;
+    node.count = count;
+    auto begin = indices.begin() + static_cast<std::ptrdiff_t>(first);
+    auto end = begin + static_cast<std::ptrdiff_t>(count);
+    for (auto it = begin; it != end; ++it) {
+        node.box.Add(pts[*it]);
+    }
+
+    if (count > maxPointsPerNode && depth < maxDepth) {
+        // sort the points into the octants: bit 0 for x, bit 1 for y and bit 2 for z
+        Base::Vector3f center = cube.GetCenter();
+        std::array<decltype(begin), 9> bounds {};
+        bounds[0] = begin;
+        bounds[8] = end;
+        bounds[4] = std::partition(begin, end, [&](uint32_t i) { return pts[i].z < center.z; });
+        for (int z = 0; z < 8; z += 4) {
+            bounds[z + 2] = std::partition(bounds[z], bounds[z + 4], [&](uint32_t i) {
+                return pts[i].y < center.y;
+            });
+            for (int y = 0; y < 4; y += 2) {
+                bounds[z + y + 1] = std::partition(bounds[z + y], bounds[z + y + 2], [&](uint32_t i) {
+                    return pts[i].x < center.x;
+                });
+            }
+        }
+
+        for (int octant = 0; octant < 8; octant++) {
+            auto num = static_cast<std::size_t>(std::distance(bounds[octant], bounds[octant + 1]));
+            if (num == 0) {
+                continue;
+            }
+
+            Base::BoundBox3f sub = cube;
+            ((octant & 1) ? sub.MinX : sub.MaxX) = center.x;
+            ((octant & 2) ? sub.MinY : sub.MaxY) = center.y;
+            ((octant & 4) ? sub.MinZ : sub.MaxZ) = center.z;
+            auto start = static_cast<std::size_t>(std::distance(indices.begin(), bounds[octant]));
+            node.children[octant] = buildNode(pts, sub, start, num, depth + 1);
+        }
+    }
+
+    // the vector may have been re-allocated by the children
+    nodes[nodeIndex] = node;
+    return nodeIndex;
+}
+
+void PointsOctree::clear()
+{
+    nodes.clear();
+    indices.clear();
+}
+
+bool PointsOctree::empty() const
+{
+    return indices.empty();
+}
+
+std::size_t PointsOctree::size() const
+{
+    return indices.size();
+}
+
+const std::vector<PointsOctree::Node>& PointsOctree::getNodes() const
+{
+    return nodes;
+}
+
+const std::vector<uint32_t>& PointsOctree::getIndices() const
+{
+    return indices;
+}
+
+void PointsOctree::select(
+    const std::vector<Base::Vector3f>& pts,
+    const CullFunction& cull,
+    const TestFunction& test,
+    std::vector<unsigned long>& result
+) const
+{
+    if (nodes.empty()) {
+        return;
+    }
+
+    std::vector<int32_t> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+
+        Visibility vis = cull ? cull(node.box) : Visibility::Partial;
+        if (vis == Visibility::Outside) {
+            continue;
+        }
+        if (vis == Visibility::Inside) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                result.push_back(indices[i]);
+            }
+        }
+        else if (!node.isLeaf()) {
+            for (int32_t child : node.children) {
+                if (child >= 0) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        else {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                if (test(pts[indices[i]])) {
+                    result.push_back(indices[i]);
+                }
+            }
+        }
+    }
+
+    std::ranges::sort(result);
+}
+
+std::vector<uint32_t> PointsOctree::progressiveOrder() const
+{
+    std::vector<uint32_t> order;
+    std::size_t num = indices.size();
+    if (num == 0) {
+        return order;
+    }
+
+    // Every index is taken once: first the multiples of the largest stride and then the
+    // indices whose lowest set bit is the current, halved stride.
+    order.reserve(num);
+    std::size_t stride = std::bit_floor(num);
+    for (std::size_t i = 0; i < num; i += stride) {
+        order.push_back(indices[i]);
+    }
+    for (std::size_t step = stride / 2; step > 0; step /= 2) {
+        for (std::size_t i = step; i < num; i += 2 * step) {
+            order.push_back(indices[i]);
+        }
+    }
+
+    return order;
+}
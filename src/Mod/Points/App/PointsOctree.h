@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/**
+ * The PointsOctree sorts a point cloud into an octree so that the points of each node and of its
+ * whole subtree are stored contiguously. This allows it to reject whole nodes when selecting
+ * points and to use every n-th point as a level of detail without storing any extra data.
+ *
+ * The octree doesn't replace the PointKernel and doesn't copy its points. It only keeps the
+ * indices of the input points in node order, so the points must be passed again to the methods
+ * that test them.
+ */
+class PointsExport PointsOctree
+{
+public:
+    struct Node
+    {
+        /// Tight bounding box of all points of the subtree
+        Base::BoundBox3f box;
+        /// Indices of the child nodes or -1
+        std::array<int32_t, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+        /// First point of the subtree in the sorted arrays
+        std::size_t first {0};
+        /// Number of points of the subtree
+        std::size_t count {0};
+
+        bool isLeaf() const;
+    };
+
+    enum class Visibility
+    {
+        Outside,
+        Partial,
+        Inside
+    };
+    using CullFunction = std::function<Visibility(const Base::BoundBox3f&)>;
+    using TestFunction = std::function<bool(const Base::Vector3f&)>;
+
+    explicit PointsOctree(std::size_t maxPointsPerNode = 4096, int maxDepth = 12);
+
+    /// Builds the octree for the given points. The points are not copied.
+    void build(const std::vector<Base::Vector3f>& pts);
+    void clear();
+    bool empty() const;
+    std::size_t size() const;
+
+    /// The root node is the first element
+    const std::vector<Node>& getNodes() const;
+    /// The index of the input point for each point in node order
+    const std::vector<uint32_t>& getIndices() const;
+
+    /** Collects the input indices of all points for which \a test returns true. Nodes that \a cull
+     * reports as outside are skipped and the points of nodes that are inside are taken without
+     * testing them. \a pts must be the points the octree was built for. The indices are sorted in
+     * ascending order.
+     */
+    void select(
+        const std::vector<Base::Vector3f>& pts,
+        const CullFunction& cull,
+        const TestFunction& test,
+        std::vector<unsigned long>& result
+    ) const;
+    /** Returns the input indices ordered so that each prefix is an evenly distributed subset of
+     * the point cloud. Rendering the first n points of this order gives a coarse level of detail.
+     */
+    std::vector<uint32_t> progressiveOrder() const;
+
+private:
+    int32_t buildNode(
+        const std::vector<Base::Vector3f>& pts,
+        const Base::BoundBox3f& cube,
+        std::size_t first,
+        std::size_t count,
+        int depth
+    );
+
+private:
+    std::vector<Node> nodes;
+    std::vector<uint32_t> indices;
+    std::size_t maxPointsPerNode;
+    int maxDepth;
+};
+
+}  // namespace Points
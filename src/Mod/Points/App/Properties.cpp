@@ -35,6 +35,7 @@
 #include <Base/VectorPy.h>
 #include <Base/Writer.h>
 
+#include "CompactFormat.h"
 #include "Points.h"
 #include "Properties.h"
 
@@ -130,7 +131,9 @@ void PropertyGreyValueList::Save(Base::Writer& writer) const
     }
     else {
         writer.Stream() << writer.ind() << "<FloatList file=\"" << writer.addFile(getName(), this)
-                        << "\"/>" << std::endl;
+                        << "\"";
+        CompactFormat::writeVersion(writer.Stream());
+        writer.Stream() << "/>" << std::endl;
     }
 }
 
@@ -138,6 +141,7 @@ void PropertyGreyValueList::Restore(Base::XMLReader& reader)
 {
     reader.readElement("FloatList");
     string file(reader.getAttribute<const char*>("file"));
+    compactFile = CompactFormat::readVersion(reader);
 
     if (!file.empty()) {
         // initiate a file read
@@ -147,23 +151,13 @@ void PropertyGreyValueList::Restore(Base::XMLReader& reader)
 
 void PropertyGreyValueList::SaveDocFile(Base::Writer& writer) const
 {
-    Base::OutputStream str(writer.Stream());
-    uint32_t uCt = (uint32_t)getSize();
-    str << uCt;
-    for (float it : _lValueList) {
-        str << it;
-    }
+    CompactFormat::writeGreyValues(writer.Stream(), _lValueList, CompactFormat::getSaveLayout());
 }
 
 void PropertyGreyValueList::RestoreDocFile(Base::Reader& reader)
 {
-    Base::InputStream str(reader);
-    uint32_t uCt = 0;
-    str >> uCt;
-    std::vector<float> values(uCt);
-    for (float& value : values) {
-        str >> value;
-    }
+    std::vector<float> values;
+    CompactFormat::readGreyValues(reader, values, compactFile);
     setValues(values);
 }
 
@@ -302,7 +296,9 @@ void PropertyNormalList::Save(Base::Writer& writer) const
 {
     if (!writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<VectorList file=\"" << writer.addFile(getName(), this)
-                        << "\"/>" << std::endl;
+                        << "\"";
+        CompactFormat::writeVersion(writer.Stream());
+        writer.Stream() << "/>" << std::endl;
     }
 }
 
@@ -310,6 +306,7 @@ void PropertyNormalList::Restore(Base::XMLReader& reader)
 {
     reader.readElement("VectorList");
     std::string file(reader.getAttribute<const char*>("file"));
+    compactFile = CompactFormat::readVersion(reader);
 
     if (!file.empty()) {
         // initiate a file read
@@ -319,23 +316,13 @@ void PropertyNormalList::Restore(Base::XMLReader& reader)
 
 void PropertyNormalList::SaveDocFile(Base::Writer& writer) const
 {
-    Base::OutputStream str(writer.Stream());
-    uint32_t uCt = (uint32_t)getSize();
-    str << uCt;
-    for (const auto& it : _lValueList) {
-        str << it.x << it.y << it.z;
-    }
+    CompactFormat::writeNormals(writer.Stream(), _lValueList, CompactFormat::getSaveLayout());
 }
 
 void PropertyNormalList::RestoreDocFile(Base::Reader& reader)
 {
-    Base::InputStream str(reader);
-    uint32_t uCt = 0;
-    str >> uCt;
-    std::vector<Base::Vector3f> values(uCt);
-    for (auto& value : values) {
-        str >> value.x >> value.y >> value.z;
-    }
+    std::vector<Base::Vector3f> values;
+    CompactFormat::readNormals(reader, values, compactFile);
     setValues(values);
 }
 
@@ -573,7 +560,9 @@ void PropertyCurvatureList::Save(Base::Writer& writer) const
 {
     if (!writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<CurvatureList file=\""
-                        << writer.addFile(getName(), this) << "\"/>" << std::endl;
+                        << writer.addFile(getName(), this) << "\"";
+        CompactFormat::writeVersion(writer.Stream());
+        writer.Stream() << "/>" << std::endl;
     }
 }
 
@@ -581,6 +570,7 @@ void PropertyCurvatureList::Restore(Base::XMLReader& reader)
 {
     reader.readElement("CurvatureList");
     std::string file(reader.getAttribute<const char*>("file"));
+    compactFile = CompactFormat::readVersion(reader);
 
     if (!file.empty()) {
         // initiate a file read
@@ -590,30 +580,13 @@ void PropertyCurvatureList::Restore(Base::XMLReader& reader)
 
 void PropertyCurvatureList::SaveDocFile(Base::Writer& writer) const
 {
-    Base::OutputStream str(writer.Stream());
-    uint32_t uCt = (uint32_t)getSize();
-    str << uCt;
-    if (uCt > 0) {
-        for (const auto& it : _lValueList) {
-            str << it.fMaxCurvature << it.fMinCurvature;
-            str << it.cMaxCurvDir.x << it.cMaxCurvDir.y << it.cMaxCurvDir.z;
-            str << it.cMinCurvDir.x << it.cMinCurvDir.y << it.cMinCurvDir.z;
-        }
-    }
+    CompactFormat::writeCurvatures(writer.Stream(), _lValueList, CompactFormat::getSaveLayout());
 }
 
 void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
 {
-    Base::InputStream str(reader);
-    uint32_t uCt = 0;
-    str >> uCt;
-    std::vector<CurvatureInfo> values(uCt);
-    for (auto& value : values) {
-        str >> value.fMaxCurvature >> value.fMinCurvature;
-        str >> value.cMaxCurvDir.x >> value.cMaxCurvDir.y >> value.cMaxCurvDir.z;
-        str >> value.cMinCurvDir.x >> value.cMinCurvDir.y >> value.cMinCurvDir.z;
-    }
-
+    std::vector<CurvatureInfo> values;
+    CompactFormat::readCurvatures(reader, values, compactFile);
     setValues(values);
 }
 
@@ -98,6 +98,7 @@ public:
 
 private:
     std::vector<float> _lValueList;
+    bool compactFile {false};
 };
 
 class PointsExport PropertyNormalList: public App::PropertyLists
@@ -152,6 +153,7 @@ public:
 
 private:
     std::vector<Base::Vector3f> _lValueList;
+    bool compactFile {false};
 };
 
 /** Curvature information. */
@@ -235,6 +237,7 @@ public:
 
 private:
     std::vector<CurvatureInfo> _lValueList;
+    bool compactFile {false};
 };
 
 }  // namespace Points
@@ -30,6 +30,7 @@
 
 #include <App/Application.h>
 #include <App/Document.h>
+#include <App/DocumentObjectGroup.h>
 #include <Base/Exception.h>
 #include <Base/Interpreter.h>
 #include <Base/Tools.h>
@@ -46,6 +47,7 @@
 #include <Gui/WaitCursor.h>
 
 #include "../App/PointsFeature.h"
+#include "../App/PointsNormals.h"
 #include "../App/Properties.h"
 #include "../App/Structured.h"
 #include "../App/Tools.h"
@@ -506,6 +508,136 @@ bool CmdPointsStructure::isActive()
     return getSelection().countObjectsOfType<Points::Feature>() == 1;
 }
 
+DEF_STD_CMD_A(CmdPointsEstimateNormals)
+
+CmdPointsEstimateNormals::CmdPointsEstimateNormals()
+    : Command("Points_EstimateNormals")
+{
+    sAppModule = "Points";
+    sGroup = QT_TR_NOOP("Points");
+    sMenuText = QT_TR_NOOP("Estimate Normals");
+    sToolTipText = QT_TR_NOOP("Estimates the normals of the selected point clouds");
+    sWhatsThis = "Points_EstimateNormals";
+    sStatusTip = sToolTipText;
+}
+
+void CmdPointsEstimateNormals::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+
+    App::Document* doc = App::GetApplication().getActiveDocument();
+    doc->openTransaction("Estimate normals");
+
+    Gui::WaitCursor wc;
+    std::vector<Points::Feature*> docObj = Gui::Selection().getObjectsOfType<Points::Feature>();
+    for (auto it : docObj) {
+        Points::NormalEstimation estimation(it->Points.getValue());
+        std::vector<Base::Vector3f> normals;
+        estimation.perform(normals);
+
+        auto prop = dynamic_cast<Points::PropertyNormalList*>(it->getPropertyByName("Normal"));
+        if (!prop) {
+            prop = static_cast<Points::PropertyNormalList*>(
+                it->addDynamicProperty("Points::PropertyNormalList", "Normal")
+            );
+        }
+        prop->setValues(normals);
+
+        if (auto vp = dynamic_cast<Gui::ViewProviderDocumentObject*>(
+                Gui::Application::Instance->getViewProvider(it)
+            )) {
+            vp->DisplayMode.setValue("Shaded");
+        }
+    }
+
+    doc->commitTransaction();
+    updateActive();
+}
+
+bool CmdPointsEstimateNormals::isActive()
+{
+    return getSelection().countObjectsOfType<Points::Feature>() > 0;
+}
+
+DEF_STD_CMD_A(CmdPointsRegionGrowing)
+
+CmdPointsRegionGrowing::CmdPointsRegionGrowing()
+    : Command("Points_RegionGrowing")
+{
+    sAppModule = "Points";
+    sGroup = QT_TR_NOOP("Points");
+    sMenuText = QT_TR_NOOP("Region Growing…");
+    sToolTipText = QT_TR_NOOP("Segments the selected point clouds into smooth regions");
+    sWhatsThis = "Points_RegionGrowing";
+    sStatusTip = sToolTipText;
+}
+
+void CmdPointsRegionGrowing::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+
+    bool ok;
+    double angle = QInputDialog::getDouble(
+        Gui::getMainWindow(),
+        QObject::tr("Region Growing"),
+        QObject::tr("Enter maximum angle between normals:"),
+        10.0,
+        0.1,
+        90.0,
+        1,
+        &ok,
+        Qt::MSWindowsFixedSizeDialogHint
+    );
+    if (!ok) {
+        return;
+    }
+
+    App::Document* doc = App::GetApplication().getActiveDocument();
+    doc->openTransaction("Region growing");
+
+    Gui::WaitCursor wc;
+    std::vector<Points::Feature*> docObj = Gui::Selection().getObjectsOfType<Points::Feature>();
+    for (auto it : docObj) {
+        const Points::PointKernel& kernel = it->Points.getValue();
+        std::vector<Base::Vector3f> normals;
+        std::vector<float> curvatures;
+        Points::NormalEstimation estimation(kernel);
+        estimation.setOrientation(Points::NormalEstimation::Orientation::None);
+        estimation.perform(normals, &curvatures);
+
+        Points::RegionGrowing segm(kernel, normals, curvatures);
+        segm.setSmoothnessAngle(static_cast<float>(Base::toRadians(angle)));
+        segm.setMinClusterSize(50);
+        std::vector<std::vector<unsigned long>> clusters;
+        segm.perform(clusters);
+
+        std::string internalname = "Segments_";
+        internalname += it->getNameInDocument();
+        auto* group = doc->addObject<App::DocumentObjectGroup>(internalname.c_str());
+        std::string labelname = "Segments ";
+        labelname += it->Label.getValue();
+        group->Label.setValue(labelname);
+
+        for (const auto& jt : clusters) {
+            auto* feaSegm = group->addObject<Points::Feature>("Segment");
+            Points::PointKernel* segment = feaSegm->Points.startEditing();
+            segment->resize(jt.size());
+            for (std::size_t i = 0; i < jt.size(); ++i) {
+                segment->setPoint(i, kernel.getPoint(jt[i]));
+            }
+            feaSegm->Points.finishEditing();
+        }
+    }
+
+    doc->commitTransaction();
+    updateActive();
+}
+
+bool CmdPointsRegionGrowing::isActive()
+{
+    return getSelection().countObjectsOfType<Points::Feature>() > 0;
+}
+
 void CreatePointsCommands()
 {
     Gui::CommandManager& rcCmdMgr = Gui::Application::Instance->commandManager();
@@ -515,4 +647,6 @@ void CreatePointsCommands()
     rcCmdMgr.addCommand(new CmdPointsPolyCut());
     rcCmdMgr.addCommand(new CmdPointsMerge());
     rcCmdMgr.addCommand(new CmdPointsStructure());
+    rcCmdMgr.addCommand(new CmdPointsEstimateNormals());
+    rcCmdMgr.addCommand(new CmdPointsRegionGrowing());
 }
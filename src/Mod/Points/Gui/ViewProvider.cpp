@@ -43,6 +43,7 @@
 #include <Gui/Selection/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 #include <Mod/Points/App/Properties.h>
 
 #include "ViewProvider.h"
@@ -117,9 +118,10 @@ void ViewProviderPoints::setVertexColorMode(App::PropertyColorList* pcProperty)
     pcColorMat->diffuseColor.setNum(val.size());
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        col[i++].setValue(it.r, it.g, it.b);
+    bool reorder = displayOrder.size() == val.size();
+    for (std::size_t i = 0; i < val.size(); i++) {
+        const auto& it = val[reorder ? displayOrder[i] : i];
+        col[i].setValue(it.r, it.g, it.b);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -132,9 +134,10 @@ void ViewProviderPoints::setVertexGreyvalueMode(Points::PropertyGreyValueList* p
     pcColorMat->diffuseColor.setNum(val.size());
     SbColor* col = pcColorMat->diffuseColor.startEditing();
 
-    std::size_t i = 0;
-    for (float it : val) {
-        col[i++].setValue(it, it, it);
+    bool reorder = displayOrder.size() == val.size();
+    for (std::size_t i = 0; i < val.size(); i++) {
+        float it = val[reorder ? displayOrder[i] : i];
+        col[i].setValue(it, it, it);
     }
 
     pcColorMat->diffuseColor.finishEditing();
@@ -147,9 +150,10 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
     pcPointsNormal->vector.setNum(val.size());
     SbVec3f* norm = pcPointsNormal->vector.startEditing();
 
-    std::size_t i = 0;
-    for (const auto& it : val) {
-        norm[i++].setValue(it.x, it.y, it.z);
+    bool reorder = displayOrder.size() == val.size();
+    for (std::size_t i = 0; i < val.size(); i++) {
+        const auto& it = val[reorder ? displayOrder[i] : i];
+        norm[i].setValue(it.x, it.y, it.z);
     }
 
     pcPointsNormal->vector.finishEditing();
@@ -372,6 +376,16 @@ PROPERTY_SOURCE(PointsGui::ViewProviderScattered, PointsGui::ViewProviderPoints)
 
 ViewProviderScattered::ViewProviderScattered()
 {
+    static const char* osgroup = "Object Style";
+
+    ADD_PROPERTY_TYPE(
+        PointBudget,
+        (0),
+        osgroup,
+        App::Prop_None,
+        "Maximum number of displayed points. With 0 all points are displayed."
+    );
+
     pcPoints = new SoPointSet();
     pcPoints->ref();
 }
@@ -431,8 +445,8 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        octree.reset();
+        updatePoints();
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -448,6 +462,58 @@ void ViewProviderScattered::updateData(const App::Property* prop)
     }
 }
 
+void ViewProviderScattered::onChanged(const App::Property* prop)
+{
+    if (prop == &PointBudget) {
+        if (pcObject) {
+            updatePoints();
+            setActiveMode();
+        }
+    }
+    else {
+        ViewProviderPoints::onChanged(prop);
+    }
+}
+
+const Points::PointsOctree& ViewProviderScattered::getOctree()
+{
+    if (!octree) {
+        Points::Feature* fea = static_cast<Points::Feature*>(pcObject);
+        octree = std::make_unique<Points::PointsOctree>();
+        octree->build(fea->Points.getValue().getBasicPoints());
+    }
+
+    return *octree;
+}
+
+void ViewProviderScattered::updatePoints()
+{
+    Points::Feature* fea = static_cast<Points::Feature*>(pcObject);
+    const Points::PointKernel& kernel = fea->Points.getValue();
+    long budget = PointBudget.getValue();
+    if (budget <= 0 || kernel.size() <= static_cast<std::size_t>(budget)) {
+        displayOrder.clear();
+        ViewProviderPointsBuilder builder;
+        builder.createPoints(&fea->Points, pcPointsCoord, pcPoints);
+        return;
+    }
+
+    // Pass the points in progressive order so that the first points are evenly distributed
+    // over the cloud and only draw as many of them as the budget allows. All coordinates are
+    // kept to let the per-vertex properties match the number of points.
+    displayOrder = getOctree().progressiveOrder();
+    const std::vector<Points::PointKernel::value_type>& pts = kernel.getBasicPoints();
+
+    pcPointsCoord->point.setNum(displayOrder.size());
+    SbVec3f* vec = pcPointsCoord->point.startEditing();
+    for (std::size_t i = 0; i < displayOrder.size(); i++) {
+        const auto& it = pts[displayOrder[i]];
+        vec[i].setValue(it.x, it.y, it.z);
+    }
+    pcPointsCoord->point.finishEditing();
+    pcPoints->numPoints = budget;
+}
+
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer)
 {
     // create the polygon from the picked points
@@ -463,20 +529,46 @@ void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked, Gui::View3DI
     SoCamera* pCam = Viewer.getSoRenderManager()->getCamera();
     SbViewVolume vol = pCam->getViewVolume();
 
-    // search for all points inside/outside the polygon
-    std::vector<unsigned long> removeIndices;
-    removeIndices.reserve(points.size());
+    Base::Matrix4D mat = points.getTransform();
+    auto transform = [&mat](const Base::Vector3f& pnt) {
+        Base::Vector3d vec = mat * Base::toVector<double>(pnt);
+        return SbVec3f(float(vec.x), float(vec.y), float(vec.z));
+    };
+
+    // A node can only be rejected by the bounding box of its projected corners if it's
+    // completely in front of the camera
+    bool perspective = vol.getProjectionType() == SbViewVolume::PERSPECTIVE;
+    SbVec3f eye = vol.getProjectionPoint();
+    SbVec3f dir = vol.getProjectionDirection();
+    Base::BoundBox2d polyBox = cPoly.CalcBoundBox();
+
+    auto cull = [&](const Base::BoundBox3f& box) {
+        Base::BoundBox2d screen;
+        for (unsigned short i = 0; i < 8; i++) {
+            SbVec3f pt = transform(box.CalcPoint(i));
+            if (perspective && (pt - eye).dot(dir) <= 0.0F) {
+                return Points::PointsOctree::Visibility::Partial;
+            }
+            vol.projectToScreen(pt, pt);
+            screen.Add(Base::Vector2d(pt[0], pt[1]));
+        }
 
-    unsigned long index = 0;
-    for (Points::PointKernel::const_iterator jt = points.begin(); jt != points.end(); ++jt, ++index) {
-        SbVec3f pt(jt->x, jt->y, jt->z);
+        if (!screen.Intersect(polyBox)) {
+            return Points::PointsOctree::Visibility::Outside;
+        }
+        return Points::PointsOctree::Visibility::Partial;
+    };
+    auto test = [&](const Base::Vector3f& pnt) {
+        SbVec3f pt = transform(pnt);
 
         // project from 3d to 2d
         vol.projectToScreen(pt, pt);
-        if (cPoly.Contains(Base::Vector2d(pt[0], pt[1]))) {
-            removeIndices.push_back(index);
-        }
-    }
+        return cPoly.Contains(Base::Vector2d(pt[0], pt[1]));
+    };
+
+    // search for all points inside/outside the polygon
+    std::vector<unsigned long> removeIndices;
+    getOctree().select(points.getBasicPoints(), cull, test, removeIndices);
 
     if (removeIndices.empty()) {
         return;  // nothing needs to be done
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <Inventor/SbVec2f.h>
 
 #include <Gui/ViewProviderBuilder.h>
@@ -55,6 +56,7 @@ namespace Points
 class PropertyGreyValueList;
 class PropertyNormalList;
 class PointKernel;
+class PointsOctree;
 class Feature;
 }  // namespace Points
 
@@ -108,6 +110,8 @@ protected:
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) = 0;
 
 protected:
+    /// The order in which the points are passed to Coin, empty if it's the order of the kernel
+    std::vector<uint32_t> displayOrder;
     Gui::SoFCSelection* pcHighlight;
     SoCoordinate3* pcPointsCoord;
     SoMaterial* pcColorMat;
@@ -131,6 +135,8 @@ public:
     ViewProviderScattered();
     ~ViewProviderScattered() override;
 
+    App::PropertyInteger PointBudget;
+
     /**
      * Extracts the point data from the feature \a pcFeature and creates
      * an Inventor node \a SoNode with these data.
@@ -140,10 +146,18 @@ public:
     void updateData(const App::Property*) override;
 
 protected:
+    void onChanged(const App::Property* prop) override;
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
+private:
+    void updatePoints();
+    const Points::PointsOctree& getOctree();
+
 protected:
     SoPointSet* pcPoints;
+
+private:
+    std::unique_ptr<Points::PointsOctree> octree;
 };
 
 /**
@@ -87,6 +87,9 @@ Gui::MenuItem* Workbench::setupMenuBar() const
           << "Points_Export"
           << "Separator"
           << "Points_PolyCut"
-          << "Points_Merge";
+          << "Points_Merge"
+          << "Separator"
+          << "Points_EstimateNormals"
+          << "Points_RegionGrowing";
     return root;
 }
@@ -22,14 +22,15 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <QFuture>
-#include <QFutureWatcher>
+#include <algorithm>
 #include <QtConcurrentMap>
 
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
-#include <math_Gauss.hxx>
-#include <math_Householder.hxx>
+
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseLU>
+#include <Eigen/SparseQR>
 
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -39,7 +40,6 @@
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
 
 // SplineBasisfunction
 
@@ -972,15 +972,16 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
     double fMaxDiff = 0.0, fMaxScalar = 1.0;
     double fWeight = _fSmoothInfluence;
 
-    Base::SequencerLauncher seq(
-        "Calc surface...",
-        static_cast<size_t>(iIter) * static_cast<size_t>(_pvcPoints->Length())
-    );
+    // The points are corrected in parallel, so the progress is only reported per iteration
+    Base::SequencerLauncher seq("Calc surface...", static_cast<size_t>(iIter));
 
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
+    struct Correction
+    {
+        double fMaxDiff = 0.0;
+        double fMaxScalar = 1.0;
+    };
 
+    do {
         Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
             _vCtrlPntsOfSurf,
             _vUKnots,
@@ -991,50 +992,29 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             _usVOrder - 1
         );
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-            double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
-            gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
-            gp_Pnt PntX;
-            gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
-            // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
-            gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
-            gp_Vec ErrorVec = X - P;
-
-            // Calculate Xu x Xv the normal in X(u,v)
-            gp_Dir clNormal = Xu ^ Xv;
-
-            // Check, if X = P
-            if (!(X.IsEqual(P, 0.001, 0.001))) {
-                ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
-                }
-            }
-
-            fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
-            if (fabs(fDeltaU) < Precision::Confusion()) {
-                fDeltaU = 0.0;
+        auto correct = [this, pclBSplineSurf](const std::pair<int, int>& block) {
+            // every block evaluates its own copy of the surface
+            Handle(Geom_BSplineSurface) surf = Handle(Geom_BSplineSurface)::DownCast(
+                pclBSplineSurf->Copy()
+            );
+            Correction result;
+            for (int ii = block.first; ii < block.second; ii++) {
+                CorrectParameter(surf, ii, result.fMaxDiff, result.fMaxScalar);
             }
-            fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
-            if (fabs(fDeltaV) < Precision::Confusion()) {
-                fDeltaV = 0.0;
-            }
-
-            // Replace old u/v values with new ones
-            fU = uvValue.X() - fDeltaU;
-            fV = uvValue.Y() - fDeltaV;
-            if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
-                uvValue.SetX(fU);
-                uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
-            }
-
-            seq.next();
-        }
+            return result;
+        };
+        auto reduce = [](Correction& result, const Correction& block) {
+            result.fMaxDiff = std::max<double>(result.fMaxDiff, block.fMaxDiff);
+            result.fMaxScalar = std::min<double>(result.fMaxScalar, block.fMaxScalar);
+        };
+
+        Correction correction = QtConcurrent::blockingMappedReduced<Correction>(
+            GetPointBlocks(),
+            correct,
+            reduce
+        );
+        fMaxDiff = correction.fMaxDiff;
+        fMaxScalar = correction.fMaxScalar;
 
         if (_bSmoothing) {
             fWeight *= 0.5f;
@@ -1044,237 +1024,397 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
             SolveWithoutSmoothing();
         }
 
+        seq.next();
         i++;
     } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
 }
 
-bool BSplineParameterCorrection::SolveWithoutSmoothing()
+void BSplineParameterCorrection::CorrectParameter(
+    const Handle(Geom_BSplineSurface) & pclBSplineSurf,
+    int ii,
+    double& fMaxDiff,
+    double& fMaxScalar
+)
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Matrix Xx(0, ulDim - 1, 0, 0);
-    math_Matrix Xy(0, ulDim - 1, 0, 0);
-    math_Matrix Xz(0, ulDim - 1, 0, 0);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
-
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
-            }
+    double fDeltaU, fDeltaV, fU, fV;
+    const gp_Pnt& pnt = (*_pvcPoints)(ii);
+    gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
+    gp_Pnt PntX;
+    gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
+    // Calculate the first two derivatives and point at (u,v)
+    gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+    pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+    gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
+    gp_Vec ErrorVec = X - P;
+
+    // Calculate Xu x Xv the normal in X(u,v)
+    gp_Dir clNormal = Xu ^ Xv;
+
+    // Check, if X = P
+    if (!(X.IsEqual(P, 0.001, 0.001))) {
+        ErrorVec.Normalize();
+        if (fabs(clNormal * ErrorVec) < fMaxScalar) {
+            fMaxScalar = fabs(clNormal * ErrorVec);
         }
     }
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
+    fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
+    if (fabs(fDeltaU) < Precision::Confusion()) {
+        fDeltaU = 0.0;
     }
-
-    // Solve the over-determined LGS with Householder-Transformation
-    math_Householder hhX(M, bx);
-    math_Householder hhY(M, by);
-    math_Householder hhZ(M, bz);
-
-    if (!(hhX.IsDone() && hhY.IsDone() && hhZ.IsDone())) {
-        // LGS could not be solved
-        return false;
+    fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
+    if (fabs(fDeltaV) < Precision::Confusion()) {
+        fDeltaV = 0.0;
     }
-    Xx = hhX.AllValues();
-    Xy = hhY.AllValues();
-    Xz = hhZ.AllValues();
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx, 0), Xy(ulIdx, 0), Xz(ulIdx, 0));
-            ulIdx++;
-        }
+    // Replace old u/v values with new ones
+    fU = uvValue.X() - fDeltaU;
+    fV = uvValue.Y() - fDeltaV;
+    if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
+        uvValue.SetX(fU);
+        uvValue.SetY(fV);
+        fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
+        fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
     }
+}
 
-    return true;
+std::vector<std::pair<int, int>> BSplineParameterCorrection::GetPointBlocks() const
+{
+    const int blockSize = 4096;
+    std::vector<std::pair<int, int>> blocks;
+    for (int first = _pvcPoints->Lower(); first <= _pvcPoints->Upper(); first += blockSize) {
+        blocks.emplace_back(first, std::min(first + blockSize, _pvcPoints->Upper() + 1));
+    }
+    return blocks;
 }
 
 namespace Reen
 {
-class ScalarProduct
+/**
+ * Accumulates the normal equations M^T.M * X = M^T.b of the over-determined system for a
+ * block of points. Because of the local support of the B-splines a control point is only
+ * coupled with the control points whose u and v indices differ by less than the order.
+ * Therefore M^T.M is stored as a band and M itself is never built.
+ */
+class NormalEquations
 {
 public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
+    NormalEquations() = default;
+    NormalEquations(int uCtrl, int vCtrl, int uOrder, int vOrder)
+        : uCtrl(uCtrl)
+        , vCtrl(vCtrl)
+        , uOrder(uOrder)
+        , vOrder(vOrder)
+        , uWidth(2 * uOrder - 1)
+        , vWidth(2 * vOrder - 1)
+        , band(static_cast<std::size_t>(uCtrl * vCtrl * uWidth * vWidth), 0.0)
+        , rhs(Eigen::MatrixX3d::Zero(uCtrl * vCtrl, 3))
     {}
-    std::vector<double> multiply(int col) const
+
+    /**
+     * Adds a point whose non-zero basis functions in u start at index uFirst and in v at
+     * vFirst. The arrays @a basisU and @a basisV hold order many values.
+     */
+    void add(
+        int uFirst,
+        int vFirst,
+        const TColStd_Array1OfReal& basisU,
+        const TColStd_Array1OfReal& basisV,
+        const gp_Pnt& pnt
+    )
     {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
+        for (int i1 = 0; i1 < uOrder; i1++) {
+            for (int j1 = 0; j1 < vOrder; j1++) {
+                double value1 = basisU(basisU.Lower() + i1) * basisV(basisV.Lower() + j1);
+                if (value1 == 0.0) {
+                    continue;
+                }
+
+                int row = (uFirst + i1) * vCtrl + vFirst + j1;
+                rhs(row, 0) += value1 * pnt.X();
+                rhs(row, 1) += value1 * pnt.Y();
+                rhs(row, 2) += value1 * pnt.Z();
+
+                double* entries = &band[static_cast<std::size_t>(row * uWidth * vWidth)];
+                for (int i2 = 0; i2 < uOrder; i2++) {
+                    double* column = entries + (i2 - i1 + uOrder - 1) * vWidth + vOrder - 1 - j1;
+                    double value2 = value1 * basisU(basisU.Lower() + i2);
+                    for (int j2 = 0; j2 < vOrder; j2++) {
+                        column[j2] += value2 * basisV(basisV.Lower() + j2);
+                    }
+                }
+            }
         }
-        return out;
     }
 
-private:
-    const math_Matrix& mat;
-};
-}  // namespace Reen
-
-bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
-{
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Vector Xx(0, ulDim - 1);
-    math_Vector Xy(0, ulDim - 1);
-    math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-    math_Vector Mbx(0, ulDim - 1);
-    math_Vector Mby(0, ulDim - 1);
-    math_Vector Mbz(0, ulDim - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
+    void merge(const NormalEquations& other)
+    {
+        if (band.empty()) {
+            *this = other;
+            return;
         }
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+        std::transform(band.begin(), band.end(), other.band.begin(), band.begin(), std::plus<>());
+        rhs += other.rhs;
+    }
+
+    void addTriplets(std::vector<Eigen::Triplet<double>>& triplets) const
+    {
+        for (int i1 = 0; i1 < uCtrl; i1++) {
+            for (int j1 = 0; j1 < vCtrl; j1++) {
+                int row = i1 * vCtrl + j1;
+                const double* entries = &band[static_cast<std::size_t>(row * uWidth * vWidth)];
+                for (int di = 0; di < uWidth; di++) {
+                    for (int dj = 0; dj < vWidth; dj++) {
+                        double value = entries[di * vWidth + dj];
+                        if (value != 0.0) {
+                            int i2 = i1 + di - uOrder + 1;
+                            int j2 = j1 + dj - vOrder + 1;
+                            triplets.emplace_back(row, i2 * vCtrl + j2, value);
+                        }
+                    }
                 }
             }
         }
     }
 
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
-        }
+    const Eigen::MatrixX3d& getRhs() const
+    {
+        return rhs;
     }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future
-        = QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end(); ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
+
+private:
+    int uCtrl {0};
+    int vCtrl {0};
+    int uOrder {0};
+    int vOrder {0};
+    int uWidth {0};
+    int vWidth {0};
+    std::vector<double> band;
+    Eigen::MatrixX3d rhs;
+};
+}  // namespace Reen
+
+namespace
+{
+// The smallest pivot of the factorization relative to the largest one
+constexpr double minPivotRatio = 1e-12;
+// The residual of the solution relative to the right-hand side
+constexpr double maxResidual = 1e-8;
+
+bool IsAccurate(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::MatrixX3d& b,
+    const Eigen::MatrixX3d& X
+)
+{
+    return X.allFinite() && (A * X - b).norm() <= maxResidual * b.norm();
+}
+
+void SetControlPoints(TColgp_Array2OfPnt& ctrlPoints, const Eigen::MatrixX3d& X)
+{
+    int ulIdx = 0;
+    for (int j = ctrlPoints.LowerRow(); j <= ctrlPoints.UpperRow(); j++) {
+        for (int k = ctrlPoints.LowerCol(); k <= ctrlPoints.UpperCol(); k++) {
+            ctrlPoints(j, k) = gp_Pnt(X(ulIdx, 0), X(ulIdx, 1), X(ulIdx, 2));
+            ulIdx++;
         }
-        rowIndex++;
     }
-#endif
+}
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
+bool SolveWithCholesky(
+    const Eigen::SparseMatrix<double>& MTM,
+    const Eigen::MatrixX3d& rhs,
+    Eigen::MatrixX3d& X
+)
+{
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(MTM);
+    if (solver.info() != Eigen::Success) {
+        return false;
     }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
+
+    // A nearly singular matrix can be factorized but the solution is then inaccurate
+    Eigen::VectorXd pivots = solver.vectorD().cwiseAbs();
+    if (pivots.size() == 0 || pivots.minCoeff() <= minPivotRatio * pivots.maxCoeff()) {
+        return false;
     }
 
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
+    X = solver.solve(rhs);
+    return solver.info() == Eigen::Success && IsAccurate(MTM, rhs, X);
+}
 
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
+bool SolveWithLU(
+    const Eigen::SparseMatrix<double>& MTM,
+    const Eigen::MatrixX3d& rhs,
+    Eigen::MatrixX3d& X
+)
+{
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+    solver.compute(MTM);
+    if (solver.info() != Eigen::Success) {
         return false;
     }
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
+    X = solver.solve(rhs);
+    return solver.info() == Eigen::Success && X.allFinite();
+}
+}  // namespace
+
+bool BSplineParameterCorrection::SolveWithQR()
+{
+    int uCtrl = static_cast<int>(_usUCtrlpoints);
+    int vCtrl = static_cast<int>(_usVCtrlpoints);
+    int uOrder = static_cast<int>(_usUOrder);
+    int vOrder = static_cast<int>(_usVOrder);
+    int ulSize = _pvcPoints->Length();
+    int ulDim = uCtrl * vCtrl;
+
+    // Determining the coefficient matrix of the overdetermined LGS, only the basis functions of
+    // the knot span of a point are non-zero
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(static_cast<std::size_t>(ulSize * uOrder * vOrder));
+    Eigen::MatrixX3d b(ulSize, 3);
+    TColStd_Array1OfReal basisU(0, uOrder - 1);
+    TColStd_Array1OfReal basisV(0, vOrder - 1);
+    for (int i = 0; i < ulSize; i++) {
+        int ii = _pvcPoints->Lower() + i;
+        const gp_Pnt& pnt = (*_pvcPoints)(ii);
+        b.row(i) << pnt.X(), pnt.Y(), pnt.Z();
+
+        const gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+        double fU = uvValue.X();
+        double fV = uvValue.Y();
+        if (!(fU >= _vUKnots(_vUKnots.Lower()) && fU <= _vUKnots(_vUKnots.Upper())
+              && fV >= _vVKnots(_vVKnots.Lower()) && fV <= _vVKnots(_vVKnots.Upper()))) {
+            continue;
+        }
+
+        int uFirst = _clUSpline.FindSpan(fU) - uOrder + 1;
+        int vFirst = _clVSpline.FindSpan(fV) - vOrder + 1;
+        _clUSpline.AllBasisFunctions(fU, basisU);
+        _clVSpline.AllBasisFunctions(fV, basisV);
+        for (int j = 0; j < uOrder; j++) {
+            for (int k = 0; k < vOrder; k++) {
+                double value = basisU(j) * basisV(k);
+                if (value != 0.0) {
+                    triplets.emplace_back(i, (uFirst + j) * vCtrl + vFirst + k, value);
+                }
+            }
+        }
+    }
+
+    Eigen::SparseMatrix<double> M(ulSize, ulDim);
+    M.setFromTriplets(triplets.begin(), triplets.end());
+    M.makeCompressed();
+
+    // Solve the over-determined LGS with a QR decomposition
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> solver;
+    solver.compute(M);
+    if (solver.info() != Eigen::Success || solver.rank() < ulDim) {
         return false;
     }
 
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
+    Eigen::MatrixX3d X(ulDim, 3);
+    for (int c = 0; c < 3; c++) {
+        Eigen::VectorXd column = b.col(c);
+        X.col(c) = solver.solve(column);
+    }
+    if (solver.info() != Eigen::Success || !X.allFinite()) {
         return false;
     }
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
-            ulIdx++;
+    SetControlPoints(_vCtrlPntsOfSurf, X);
+    return true;
+}
+
+bool BSplineParameterCorrection::SolveWithoutSmoothing()
+{
+    return SolveNormalEquations(false, 0.0);
+}
+
+bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+{
+    return SolveNormalEquations(true, fWeight);
+}
+
+bool BSplineParameterCorrection::SolveNormalEquations(bool bSmoothing, double fWeight)
+{
+    int uCtrl = static_cast<int>(_usUCtrlpoints);
+    int vCtrl = static_cast<int>(_usVCtrlpoints);
+    int uOrder = static_cast<int>(_usUOrder);
+    int vOrder = static_cast<int>(_usVOrder);
+    int ulDim = uCtrl * vCtrl;
+
+    // Determining the normal equations of the over-determined LGS block-wise
+    auto assemble = [&](const std::pair<int, int>& block) {
+        NormalEquations equations(uCtrl, vCtrl, uOrder, vOrder);
+        TColStd_Array1OfReal basisU(0, uOrder - 1);
+        TColStd_Array1OfReal basisV(0, vOrder - 1);
+        for (int ii = block.first; ii < block.second; ii++) {
+            const gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+            double fU = uvValue.X();
+            double fV = uvValue.Y();
+            // outside of the knot range all basis functions are zero
+            if (!(fU >= _vUKnots(_vUKnots.Lower()) && fU <= _vUKnots(_vUKnots.Upper())
+                  && fV >= _vVKnots(_vVKnots.Lower()) && fV <= _vVKnots(_vVKnots.Upper()))) {
+                continue;
+            }
+
+            // only the basis functions of the knot span are non-zero
+            int uFirst = _clUSpline.FindSpan(fU) - uOrder + 1;
+            int vFirst = _clVSpline.FindSpan(fV) - vOrder + 1;
+            _clUSpline.AllBasisFunctions(fU, basisU);
+            _clVSpline.AllBasisFunctions(fV, basisV);
+            equations.add(uFirst, vFirst, basisU, basisV, (*_pvcPoints)(ii));
+        }
+        return equations;
+    };
+    auto reduce = [](NormalEquations& result, const NormalEquations& equations) {
+        result.merge(equations);
+    };
+
+    NormalEquations equations = QtConcurrent::blockingMappedReduced<NormalEquations>(
+        GetPointBlocks(),
+        assemble,
+        reduce,
+        QtConcurrent::OrderedReduce | QtConcurrent::SequentialReduce
+    );
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    equations.addTriplets(triplets);
+    if (bSmoothing) {
+        for (int m = 0; m < ulDim; m++) {
+            for (int n = 0; n < ulDim; n++) {
+                double value = _clSmoothMatrix(m, n);
+                if (value != 0.0) {
+                    triplets.emplace_back(m, n, fWeight * value);
+                }
+            }
         }
     }
 
+    Eigen::SparseMatrix<double> MTM(ulDim, ulDim);
+    MTM.setFromTriplets(triplets.begin(), triplets.end());
+
+    // Solve the symmetric LGS with a sparse Cholesky decomposition
+    Eigen::MatrixX3d X;
+    if (SolveWithCholesky(MTM, equations.getRhs(), X)) {
+        SetControlPoints(_vCtrlPntsOfSurf, X);
+        return true;
+    }
+
+    // The normal equations square the condition of the over-determined LGS, so if they are
+    // nearly singular the LGS is solved as before: with a QR decomposition of the coefficient
+    // matrix or, with smoothing terms, with an LU decomposition of the regular LGS
+    if (!bSmoothing) {
+        return SolveWithQR();
+    }
+    if (!SolveWithLU(MTM, equations.getRhs(), X)) {
+        // LGS could not be solved
+        return false;
+    }
+
+    SetControlPoints(_vCtrlPntsOfSurf, X);
     return true;
 }
 
@@ -1295,8 +1435,33 @@ void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc, double fFirst,
     _clSmoothMatrix = fFirst * _clFirstMatrix + fSecond * _clSecondMatrix + fThird * _clThirdMatrix;
 }
 
+math_Matrix BSplineParameterCorrection::GetIntegralTable(
+    BSplineBasis& spline,
+    int iSize,
+    int iOrd1,
+    int iOrd2
+)
+{
+    // the integrals only depend on the two indices of one direction, so they are
+    // computed once instead of for every entry of the smoothing matrices
+    math_Matrix table(0, iSize - 1, 0, iSize - 1, 0.0);
+    for (int i = 0; i < iSize; i++) {
+        for (int k = 0; k < iSize; k++) {
+            table(i, k) = spline.GetIntegralOfProductOfBSplines(i, k, iOrd1, iOrd2);
+        }
+    }
+    return table;
+}
+
 void BSplineParameterCorrection::CalcFirstSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    int uSize = static_cast<int>(_usUCtrlpoints);
+    int vSize = static_cast<int>(_usVCtrlpoints);
+    math_Matrix U00 = GetIntegralTable(_clUSpline, uSize, 0, 0);
+    math_Matrix U11 = GetIntegralTable(_clUSpline, uSize, 1, 1);
+    math_Matrix V00 = GetIntegralTable(_clVSpline, vSize, 0, 0);
+    math_Matrix V11 = GetIntegralTable(_clVSpline, vSize, 1, 1);
+
     unsigned m = 0;
     for (unsigned k = 0; k < _usUCtrlpoints; k++) {
         for (unsigned l = 0; l < _usVCtrlpoints; l++) {
@@ -1304,10 +1469,7 @@ void BSplineParameterCorrection::CalcFirstSmoothMatrix(Base::SequencerLauncher&
 
             for (unsigned i = 0; i < _usUCtrlpoints; i++) {
                 for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clFirstMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1);
+                    _clFirstMatrix(m, n) = U11(i, k) * V00(j, l) + U00(i, k) * V11(j, l);
                     seq.next();
                     n++;
                 }
@@ -1319,6 +1481,15 @@ void BSplineParameterCorrection::CalcFirstSmoothMatrix(Base::SequencerLauncher&
 
 void BSplineParameterCorrection::CalcSecondSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    int uSize = static_cast<int>(_usUCtrlpoints);
+    int vSize = static_cast<int>(_usVCtrlpoints);
+    math_Matrix U00 = GetIntegralTable(_clUSpline, uSize, 0, 0);
+    math_Matrix U11 = GetIntegralTable(_clUSpline, uSize, 1, 1);
+    math_Matrix U22 = GetIntegralTable(_clUSpline, uSize, 2, 2);
+    math_Matrix V00 = GetIntegralTable(_clVSpline, vSize, 0, 0);
+    math_Matrix V11 = GetIntegralTable(_clVSpline, vSize, 1, 1);
+    math_Matrix V22 = GetIntegralTable(_clVSpline, vSize, 2, 2);
+
     unsigned m = 0;
     for (unsigned k = 0; k < _usUCtrlpoints; k++) {
         for (unsigned l = 0; l < _usVCtrlpoints; l++) {
@@ -1326,12 +1497,8 @@ void BSplineParameterCorrection::CalcSecondSmoothMatrix(Base::SequencerLauncher&
 
             for (unsigned i = 0; i < _usUCtrlpoints; i++) {
                 for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clSecondMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + 2 * _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 2);
+                    _clSecondMatrix(m, n) = U22(i, k) * V00(j, l) + 2 * U11(i, k) * V11(j, l)
+                        + U00(i, k) * V22(j, l);
                     seq.next();
                     n++;
                 }
@@ -1343,6 +1510,25 @@ void BSplineParameterCorrection::CalcSecondSmoothMatrix(Base::SequencerLauncher&
 
 void BSplineParameterCorrection::CalcThirdSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    int uSize = static_cast<int>(_usUCtrlpoints);
+    int vSize = static_cast<int>(_usVCtrlpoints);
+    math_Matrix U00 = GetIntegralTable(_clUSpline, uSize, 0, 0);
+    math_Matrix U02 = GetIntegralTable(_clUSpline, uSize, 0, 2);
+    math_Matrix U11 = GetIntegralTable(_clUSpline, uSize, 1, 1);
+    math_Matrix U13 = GetIntegralTable(_clUSpline, uSize, 1, 3);
+    math_Matrix U20 = GetIntegralTable(_clUSpline, uSize, 2, 0);
+    math_Matrix U22 = GetIntegralTable(_clUSpline, uSize, 2, 2);
+    math_Matrix U31 = GetIntegralTable(_clUSpline, uSize, 3, 1);
+    math_Matrix U33 = GetIntegralTable(_clUSpline, uSize, 3, 3);
+    math_Matrix V00 = GetIntegralTable(_clVSpline, vSize, 0, 0);
+    math_Matrix V02 = GetIntegralTable(_clVSpline, vSize, 0, 2);
+    math_Matrix V11 = GetIntegralTable(_clVSpline, vSize, 1, 1);
+    math_Matrix V13 = GetIntegralTable(_clVSpline, vSize, 1, 3);
+    math_Matrix V20 = GetIntegralTable(_clVSpline, vSize, 2, 0);
+    math_Matrix V22 = GetIntegralTable(_clVSpline, vSize, 2, 2);
+    math_Matrix V31 = GetIntegralTable(_clVSpline, vSize, 3, 1);
+    math_Matrix V33 = GetIntegralTable(_clVSpline, vSize, 3, 3);
+
     unsigned m = 0;
     for (unsigned k = 0; k < _usUCtrlpoints; k++) {
         for (unsigned l = 0; l < _usVCtrlpoints; l++) {
@@ -1350,22 +1536,9 @@ void BSplineParameterCorrection::CalcThirdSmoothMatrix(Base::SequencerLauncher&
 
             for (unsigned i = 0; i < _usUCtrlpoints; i++) {
                 for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clThirdMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 3, 3)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 3, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 2)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 3)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 2)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 3, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 3)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 3, 3);
+                    _clThirdMatrix(m, n) = U33(i, k) * V00(j, l) + U31(i, k) * V02(j, l)
+                        + U13(i, k) * V20(j, l) + U11(i, k) * V22(j, l) + U22(i, k) * V11(j, l)
+                        + U02(i, k) * V31(j, l) + U20(i, k) * V13(j, l) + U00(i, k) * V33(j, l);
                     seq.next();
                     n++;
                 }
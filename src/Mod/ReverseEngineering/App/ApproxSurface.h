@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <Geom_BSplineSurface.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -409,20 +412,50 @@ protected:
 
     /**
      * Carries out a parameter correction.
+     * The points are corrected block-wise in parallel.
      */
     void DoParameterCorrection(int iIter) override;
 
     /**
-     * Solve an overdetermined LGS with the help of the Householder-Tansformation
+     * Corrects the (u,v) parameter of the point with index ii and updates the
+     * maximum parameter change and the minimum angle cosine.
+     */
+    void CorrectParameter(
+        const Handle(Geom_BSplineSurface) & pclBSplineSurf,
+        int ii,
+        double& fMaxDiff,
+        double& fMaxScalar
+    );
+
+    /**
+     * Solve an overdetermined LGS by its normal equations
      */
     bool SolveWithoutSmoothing() override;
 
     /**
-     * Solve a regular system of equations by LU decomposition. Depending on the weighting,
+     * Solve a regular system of equations. Depending on the weighting,
      * smoothing terms are included
      */
     bool SolveWithSmoothing(double fWeight) override;
 
+    /**
+     * Assembles the normal equations block-wise in parallel, exploiting the local support
+     * of the B-splines, and solves them with a sparse Cholesky decomposition. If they are
+     * nearly singular the LGS without smoothing terms is solved by SolveWithQR() and the one
+     * with smoothing terms by an LU decomposition.
+     */
+    bool SolveNormalEquations(bool bSmoothing, double fWeight);
+
+    /**
+     * Solves the overdetermined LGS with a sparse QR decomposition of its coefficient matrix
+     */
+    bool SolveWithQR();
+
+    /**
+     * Splits the point indices into blocks that can be processed in parallel
+     */
+    std::vector<std::pair<int, int>> GetPointBlocks() const;
+
 public:
     /**
      * Setting the knot vector
@@ -481,6 +514,12 @@ protected:
      */
     virtual void CalcSmoothingTerms(bool bRecalc, double fFirst, double fSecond, double fThird);
 
+    /**
+     * Calculates the integrals of the products of the iOrd1-th and iOrd2-th derivatives
+     * of all pairs of basis functions of one direction
+     */
+    static math_Matrix GetIntegralTable(BSplineBasis& spline, int iSize, int iOrd1, int iOrd2);
+
     /**
      * Calculates the matrix for the first smoothing term
      * (see U.Dietz dissertation)
@@ -697,6 +697,10 @@ public:
     {
         GCSsys.autoQRThreshold = val;
     }
+    inline void setSparseJacobiThreshold(int val)
+    {
+        GCSsys.sparseJacobiThreshold = val;
+    }
     inline void setSketchAutoAlgo(bool val)
     {
         GCSsys.autoChooseAlgorithm = val;
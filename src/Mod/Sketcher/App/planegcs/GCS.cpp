@@ -49,10 +49,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
+#include <numeric>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -85,6 +88,8 @@
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
 # include <Eigen/OrderingMethods>
 #endif
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseQR>
 
 // _GCS_EXTRACT_SOLVER_SUBSYSTEM_ to be enabled in Constraints.h when needed.
 #if defined(_GCS_EXTRACT_SOLVER_SUBSYSTEM_) || defined(_DEBUG_TO_FILE)
@@ -488,6 +493,7 @@ System::System()
     , qrAlgorithm(EigenSparseQR)
     , autoChooseAlgorithm(true)
     , autoQRThreshold(1000)
+    , sparseJacobiThreshold(300)
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
@@ -1902,30 +1908,160 @@ int System::solve(VEC_pD& params, bool isFine, Algorithm alg, bool isRedundantso
     return solve(isFine, alg, isRedundantsolving);
 }
 
+namespace
+{
+
+// Systems with fewer parameters than this are solved faster than threads are started
+constexpr int concurrencyThreshold = 100;
+
+// Calls task(i) for every i in [0, count) on up to hardware_concurrency threads, including the
+// calling one. The tasks must be independent of each other.
+template<typename Task>
+void concurrentFor(int count, const Task& task)
+{
+    int threadsNum = std::min(count, static_cast<int>(std::thread::hardware_concurrency()));
+    std::atomic<int> next {0};
+    auto worker = [&]() {
+        for (int i = next++; i < count; i = next++) {
+            task(i);
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (int i = 1; i < threadsNum; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+// Splits the constraints into subsystems of the components that share none of params.
+// Constraints without any of params go into the first subsystem.
+std::vector<SubSystem*> makeDecoupledSubSystems(
+    std::vector<Constraint*>& constraints,
+    VEC_pD& params
+)
+{
+    MAP_pD_I pindex;
+    for (int i = 0; i < int(params.size()); i++) {
+        pindex[params[i]] = i;
+    }
+    std::vector<int> parent(params.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::vector<int> firstParam(constraints.size(), -1);
+    for (std::size_t i = 0; i < constraints.size(); i++) {
+        for (const auto& param : constraints[i]->params()) {
+            auto it = pindex.find(param);
+            if (it == pindex.end()) {
+                continue;
+            }
+            if (firstParam[i] < 0) {
+                firstParam[i] = it->second;
+            }
+            else {
+                int root1 = find(firstParam[i]);
+                int root2 = find(it->second);
+                parent[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+    }
+
+    std::map<int, int> rootComponent;
+    std::vector<std::vector<Constraint*>> clists(1);
+    for (std::size_t i = 0; i < constraints.size(); i++) {
+        int cid = 0;
+        if (firstParam[i] >= 0) {
+            auto [it, inserted] =
+                rootComponent.try_emplace(find(firstParam[i]), int(clists.size()));
+            if (inserted) {
+                clists.emplace_back();
+            }
+            cid = it->second;
+        }
+        clists[cid].push_back(constraints[i]);
+    }
+
+    std::vector<VEC_pD> plists(clists.size());
+    for (int i = 0; i < int(params.size()); i++) {
+        auto it = rootComponent.find(find(i));
+        if (it != rootComponent.end()) {
+            plists[it->second].push_back(params[i]);
+        }
+    }
+
+    // merge the constraints without parameters into the first actual component
+    if (clists.size() > 1) {
+        clists[1].insert(clists[1].begin(), clists[0].begin(), clists[0].end());
+    }
+
+    std::vector<SubSystem*> subsystems;
+    for (std::size_t cid = (clists.size() > 1 ? 1 : 0); cid < clists.size(); cid++) {
+        if (!clists[cid].empty()) {
+            subsystems.push_back(new SubSystem(clists[cid], plists[cid]));
+        }
+    }
+    return subsystems;
+}
+
+}  // namespace
+
 int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (!isInit) {
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    bool hasSubSystems = false;
+    int paramsNum = 0;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            hasSubSystems = true;
+            paramsNum += int(plists[cid].size());
         }
+    }
+    if (hasSubSystems) {
+        resetToReference();
+    }
+
+    // The components share no parameters, so they can be solved concurrently. Each one stores its
+    // own result and the results are merged afterwards, independently of the scheduling.
+    std::vector<int> results(subSystems.size(), Success);
+    auto solveComponent = [&](int cid) {
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            results[cid] = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            results[cid] = solve(subSystems[cid], isFine, alg, isRedundantsolving);
         }
         else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+            results[cid] = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
         }
+    };
+    // iteration level output is neither thread-safe nor readable when interleaved
+    if (subSystems.size() > 1 && paramsNum >= concurrencyThreshold && debugMode != IterationLevel) {
+        concurrentFor(int(subSystems.size()), solveComponent);
+    }
+    else {
+        for (int cid = 0; cid < int(subSystems.size()); cid++) {
+            solveComponent(cid);
+        }
+    }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
     }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
@@ -1944,6 +2080,37 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     return res;
 }
 
+int System::solveDecoupled(
+    std::vector<SubSystem*>& subsystems,
+    Algorithm alg,
+    bool isRedundantsolving
+)
+{
+    int paramsNum = 0;
+    for (auto subsys : subsystems) {
+        paramsNum += subsys->pSize();
+    }
+
+    std::vector<int> results(subsystems.size(), Success);
+    auto solveSubSystem = [&](int i) {
+        results[i] = solve(subsystems[i], true, alg, isRedundantsolving);
+    };
+    if (subsystems.size() > 1 && paramsNum >= concurrencyThreshold && debugMode != IterationLevel) {
+        concurrentFor(int(subsystems.size()), solveSubSystem);
+    }
+    else {
+        for (int i = 0; i < int(subsystems.size()); i++) {
+            solveSubSystem(i);
+        }
+    }
+
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
+    }
+    return res;
+}
+
 int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (alg == BFGS) {
@@ -2087,6 +2254,173 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// Normal equations A*h=g of the Levenberg-Marquardt step, with A=J^T J augmented by the damping
+template<typename JacobiMatrix>
+class DampedNormalEquations;
+
+template<>
+class DampedNormalEquations<Eigen::MatrixXd>
+{
+public:
+    void setJacobi(const Eigen::MatrixXd& J)
+    {
+        A = J.transpose() * J;
+        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
+    }
+
+    const Eigen::VectorXd& diagonal() const
+    {
+        return diag_A;
+    }
+
+    // solves (A+uI)*h=g and returns the relative error of the solution
+    double solve(double mu, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+    {
+        A.diagonal() = diag_A.array() + mu;
+        h = A.fullPivLu().solve(g);
+        return (A * h - g).norm() / g.norm();
+    }
+
+private:
+    Eigen::MatrixXd A;
+    Eigen::VectorXd diag_A;
+};
+
+template<>
+class DampedNormalEquations<Eigen::SparseMatrix<double>>
+{
+public:
+    void setJacobi(const Eigen::SparseMatrix<double>& J)
+    {
+        A = J.transpose() * J;
+        diag_A = A.diagonal();
+        if (identity.rows() != A.rows()) {
+            identity.resize(A.rows(), A.cols());
+            identity.setIdentity();
+        }
+    }
+
+    const Eigen::VectorXd& diagonal() const
+    {
+        return diag_A;
+    }
+
+    double solve(double mu, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+    {
+        A_aug = A + mu * identity;
+        // the sparsity pattern of the Jacobian does not change while iterating on a subsystem,
+        // so the fill-reducing ordering is only computed once
+        if (!analysed) {
+            ldlt.analyzePattern(A_aug);
+            analysed = true;
+        }
+        ldlt.factorize(A_aug);
+        if (ldlt.info() != Eigen::Success) {
+            return std::numeric_limits<double>::infinity();
+        }
+        h = ldlt.solve(g);
+        return (A_aug * h - g).norm() / g.norm();
+    }
+
+private:
+    Eigen::SparseMatrix<double> A, A_aug, identity;
+    Eigen::VectorXd diag_A;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    bool analysed = false;
+};
+
+// Gauss-Newton step h_gn of the DogLeg method, solving Jx*h_gn=-fx
+template<typename JacobiMatrix>
+class GaussNewtonStep;
+
+template<>
+class GaussNewtonStep<Eigen::MatrixXd>
+{
+public:
+    explicit GaussNewtonStep(DogLegGaussStep mode)
+        : mode(mode)
+    {}
+
+    void solve(const Eigen::MatrixXd& Jx, const Eigen::VectorXd& fx, Eigen::VectorXd& h_gn)
+    {
+        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+        switch (mode) {
+            case FullPivLU:
+                h_gn = Jx.fullPivLu().solve(-fx);
+                break;
+            case LeastNormFullPivLU:
+                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+                break;
+            case LeastNormLdlt:
+                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+                break;
+        }
+    }
+
+private:
+    DogLegGaussStep mode;
+};
+
+template<>
+class GaussNewtonStep<Eigen::SparseMatrix<double>>
+{
+public:
+    explicit GaussNewtonStep(DogLegGaussStep /*mode*/)
+    {}
+
+    // All modes take the least norm step through a Cholesky factorization of Jx*Jx^T, which is
+    // much cheaper than any sparse factorization of Jx itself. Sparse QR, the counterpart of
+    // FullPivLU, is only used when a rank deficient Jacobian makes that step unusable. As for the
+    // Levenberg-Marquardt normal equations, the orderings are only computed once.
+    void solve(
+        const Eigen::SparseMatrix<double>& Jx,
+        const Eigen::VectorXd& fx,
+        Eigen::VectorXd& h_gn
+    )
+    {
+        JJt = Jx * Jx.transpose();
+        if (!ldltAnalysed) {
+            ldlt.analyzePattern(JJt);
+            ldltAnalysed = true;
+        }
+        ldlt.factorize(JJt);
+        if (ldlt.info() == Eigen::Success) {
+            h_gn = Jx.transpose() * ldlt.solve(-fx);
+            if ((Jx * h_gn + fx).norm() <= 1e-6 * fx.norm()) {
+                return;
+            }
+        }
+        if (!qrAnalysed) {
+            qr.analyzePattern(Jx);
+            qrAnalysed = true;
+        }
+        qr.factorize(Jx);
+        h_gn = qr.solve(-fx);
+    }
+
+private:
+    Eigen::SparseMatrix<double> JJt;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
+    bool ldltAnalysed = false;
+    bool qrAnalysed = false;
+};
+
+}  // namespace
+
+int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
+{
+    if (subsys->pSize() >= sparseJacobiThreshold) {
+        return solve_LM<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solve_LM<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobiMatrix>
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
@@ -2102,8 +2436,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    JacobiMatrix J(csize, xsize);  // Jacobi of the subsystem
+    DampedNormalEquations<JacobiMatrix> A;
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2156,12 +2490,12 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // J^T J, J^T e
         subsys->calcJacobi(J);
 
-        A = J.transpose() * J;
+        A.setJacobi(J);
         g = J.transpose() * e;
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
+        diag_A = A.diagonal();
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2178,14 +2512,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
-
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
+            // augment normal equations A = A+uI and solve augmented functions A*h=-g
+            double rel_error = A.solve(mu, g, h);
 
             // check if solving works
             if (rel_error < 1e-5) {
@@ -2235,9 +2563,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
 
             k++;
         }
@@ -2266,6 +2591,15 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
     return (stop == 1) ? Success : Failed;
 }
 
+int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+    if (subsys->pSize() >= sparseJacobiThreshold) {
+        return solve_DL<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solve_DL<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobiMatrix>
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
@@ -2302,7 +2636,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                        : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
                                                                 : "LeastNormLdlt"))
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
-               << "\n";
+               << ", sparse: " << (xsize >= sparseJacobiThreshold ? "yes" : "no") << "\n";
 
         const std::string tmp = stream.str();
         Base::Console().log(tmp.c_str());
@@ -2310,8 +2644,9 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    JacobiMatrix Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
+    GaussNewtonStep<JacobiMatrix> gaussNewtonStep(dogLegGaussStep);
 
     subsys->redirectParams();
 
@@ -2362,19 +2697,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        gaussNewtonStep.solve(Jx, fx, h_gn);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -4916,39 +5239,216 @@ int System::diagnose(Algorithm alg)
     // From here on, presuming `J.rows() > 0`.
     emptyDiagnoseMatrix = false;
 
-    if (qrAlgorithm == EigenDenseQR) {
 #ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed DenseQR_start_time;
+    Base::TimeElapsed QR_start_time;
+#endif
+
+    // The reduced Jacobian of decoupled components is block diagonal up to permutations, and its
+    // rank and dependencies are those of the blocks. Each block is diagnosed on its own, and the
+    // results are merged in block order, independently of the scheduling.
+    std::vector<DiagnosedBlock> blocks;
+    splitReducedJacobian(J, jacobianconstraintmap, pdiagnoselist, blocks);
+
+    // a single block reports the system information itself, as the whole system did before
+    bool silent = blocks.size() > 1;
+    if (blocks.size() > 1 && dofs >= concurrencyThreshold) {
+        concurrentFor(int(blocks.size()), [&](int i) {
+            diagnoseBlock(blocks[i], /*isConcurrent=*/true, silent);
+        });
+    }
+    else {
+        for (auto& block : blocks) {
+            diagnoseBlock(block, /*isConcurrent=*/false, silent);
+        }
+    }
+
+    int paramsNum = 0;
+    int constrNum = 0;
+    int rank = 0;
+    std::vector<std::vector<Constraint*>> conflictGroups;
+    for (auto& block : blocks) {
+        paramsNum += block.paramsNum;
+        constrNum += block.constrNum;
+        rank += block.rank;
+        std::ranges::move(block.conflictGroups, std::back_inserter(conflictGroups));
+        for (auto& group : block.dependentParametersGroups) {
+            std::ranges::copy(group, std::back_inserter(pDependentParameters));
+            pDependentParametersGroups.push_back(std::move(group));
+        }
+    }
+
+    if (debugMode == IterationLevel && silent) {
+        SolverReportingManager::Manager().LogQRSystemInformation(*this, paramsNum, constrNum, rank);
+    }
+
+    dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+
+    // Detecting conflicting or redundant constraints
+    if (constrNum > rank) {
+        int nonredundantconstrNum;
+        identifyConflictingRedundantConstraints(
+            alg,
+            conflictGroups,
+            tagmultiplicity,
+            pdiagnoselist,
+            constrNum,
+            nonredundantconstrNum
+        );
+        if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
+            dofs = paramsNum - nonredundantconstrNum;
+        }
+    }
+
+#ifdef PROFILE_DIAGNOSE
+    Base::TimeElapsed QR_end_time;
+
+    auto SolveTime = Base::TimeElapsed::diffTimeF(QR_start_time, QR_end_time);
+
+    Base::Console().log("\nQR diagnosis - Lapsed Time: %f seconds\n", SolveTime);
+#endif
+
+    return dofs;
+}
+
+void System::splitReducedJacobian(
+    Eigen::MatrixXd& J,
+    const std::map<int, int>& jacobianconstraintmap,
+    const GCS::VEC_pD& pdiagnoselist,
+    std::vector<DiagnosedBlock>& blocks
+)
+{
+    // union-find of the rows (constraints) and the columns (parameters) linked by non zero entries
+    int rowsNum = int(jacobianconstraintmap.size());
+    int colsNum = int(pdiagnoselist.size());
+    std::vector<int> parent(rowsNum + colsNum);
+    std::iota(parent.begin(), parent.end(), 0);
+    std::vector<bool> linked(rowsNum + colsNum, false);
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (int col = 0; col < colsNum; col++) {
+        for (int row = 0; row < rowsNum; row++) {
+            if (J(row, col) != 0.) {
+                int root1 = find(row);
+                int root2 = find(rowsNum + col);
+                parent[std::max(root1, root2)] = std::min(root1, root2);
+                linked[row] = true;
+                linked[rowsNum + col] = true;
+            }
+        }
+    }
+
+    // rows and columns without any non zero entry are gathered in one block of their own
+    std::vector<int> blockOf(rowsNum + colsNum);
+    std::vector<int> rootBlock(rowsNum + colsNum, -1);
+    int unlinkedBlock = -1;
+    int blocksNum = 0;
+    for (int i = 0; i < rowsNum + colsNum; i++) {
+        int& block = linked[i] ? rootBlock[find(i)] : unlinkedBlock;
+        if (block < 0) {
+            block = blocksNum++;
+        }
+        blockOf[i] = block;
+    }
+
+    blocks.resize(blocksNum);
+    if (blocksNum == 1) {
+        blocks[0].J = std::move(J);
+        blocks[0].jacobianconstraintmap = jacobianconstraintmap;
+        blocks[0].pdiagnoselist = pdiagnoselist;
+        return;
+    }
+
+    std::vector<VEC_I> blockRows(blocksNum);
+    for (int row = 0; row < rowsNum; row++) {
+        auto& block = blocks[blockOf[row]];
+        int blockRow = int(block.jacobianconstraintmap.size());
+        block.jacobianconstraintmap[blockRow] = jacobianconstraintmap.at(row);
+        blockRows[blockOf[row]].push_back(row);
+    }
+    for (int col = 0; col < colsNum; col++) {
+        blocks[blockOf[rowsNum + col]].pdiagnoselist.push_back(pdiagnoselist[col]);
+    }
+    for (auto& block : blocks) {
+        block.J =
+            Eigen::MatrixXd::Zero(block.jacobianconstraintmap.size(), block.pdiagnoselist.size());
+    }
+    std::vector<int> blockCols(blocksNum, 0);
+    for (int col = 0; col < colsNum; col++) {
+        int b = blockOf[rowsNum + col];
+        int blockCol = blockCols[b]++;
+        for (int blockRow = 0; blockRow < int(blockRows[b].size()); blockRow++) {
+            blocks[b].J(blockRow, blockCol) = J(blockRows[b][blockRow], col);
+        }
+    }
+}
+
+void System::diagnoseBlock(DiagnosedBlock& block, bool isConcurrent, bool silent)
+{
+    if (block.J.isZero(0.)) {
+        // every parameter is free and every constraint is conflicting or redundant on its own
+        block.paramsNum = int(block.pdiagnoselist.size());
+        block.constrNum = int(block.jacobianconstraintmap.size());
+        for (const auto& [row, index] : block.jacobianconstraintmap) {
+            block.conflictGroups.push_back({clist[index]});
+        }
+        for (const auto& param : block.pdiagnoselist) {
+            block.dependentParametersGroups.push_back({param});
+        }
+        return;
+    }
+
+    QRAlgorithm algorithm = qrAlgorithm;
+    if (autoChooseAlgorithm) {
+        algorithm = int(block.pdiagnoselist.size()) < autoQRThreshold ? EigenDenseQR
+                                                                      : EigenSparseQR;
+    }
+#ifndef EIGEN_SPARSEQR_COMPATIBLE
+    algorithm = EigenDenseQR;
 #endif
 
-        int rank = 0;  // rank is not cheap to retrieve from qrJT in DenseQR
-        Eigen::MatrixXd R;
+    // Here we give the system the possibility to run the two QR decompositions in parallel,
+    // depending on the load of the system so we are using the default std::launch::async |
+    // std::launch::deferred policy, as nobody better than the system nows if it can run the
+    // task in parallel or is oversubscribed and should deferred it. Blocks that are diagnosed
+    // concurrently already keep the system busy, so they defer it. Care to wait() for the
+    // future before any prospective detection of conflicting/redundant. Care to call the thread
+    // with silent=true, unless the present thread does not use Base::Console, or the launch
+    // policy is set to std::launch::deferred policy, as it is not thread-safe to use them in
+    // both at the same time.
+    auto policy = isConcurrent ? std::launch::deferred : std::launch::async | std::launch::deferred;
+    Eigen::MatrixXd R;
+
+    if (algorithm == EigenDenseQR) {
         Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT;
-        // Here we give the system the possibility to run the two QR decompositions in parallel,
-        // depending on the load of the system so we are using the default std::launch::async |
-        // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
-        //
-        // identifyDependentParametersDenseQR(J, jacobianconstraintmap, pdiagnoselist, true)
-        //
         auto fut = std::async(
+            policy,
             &System::identifyDependentParametersDenseQR,
             this,
-            J,
-            jacobianconstraintmap,
-            pdiagnoselist,
+            std::cref(block.J),
+            std::cref(block.jacobianconstraintmap),
+            std::cref(block.pdiagnoselist),
+            std::ref(block.dependentParametersGroups),
             true
         );
 
-        makeDenseQRDecomposition(J, jacobianconstraintmap, qrJT, rank, R);
+        // rank is not cheap to retrieve from qrJT in DenseQR
+        makeDenseQRDecomposition(
+            block.J,
+            block.jacobianconstraintmap,
+            qrJT,
+            block.rank,
+            R,
+            true,
+            silent
+        );
 
-        int paramsNum = qrJT.rows();
-        int constrNum = qrJT.cols();
+        block.paramsNum = qrJT.rows();
+        block.constrNum = qrJT.cols();
 
         // This function is legacy code that was used to obtain partial geometry dependency
         // information from a SINGLE Dense QR decomposition. I am reluctant to remove it from
@@ -4956,122 +5456,64 @@ int System::diagnose(Algorithm alg)
         // identifyDependentGeometryParametersInTransposedJacobianDenseQRDecomposition( qrJT,
         // pdiagnoselist, paramsNum, rank);
 
-        fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
-
-        dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+        fut.wait();  // wait for the execution of identifyDependentParametersDenseQR to finish
 
-        // Detecting conflicting or redundant constraints
-        if (constrNum > rank) {
-            // conflicting or redundant constraints
-            int nonredundantconstrNum;
-            identifyConflictingRedundantConstraints(
-                alg,
+        if (block.constrNum > block.rank) {
+            identifyConflictGroups(
                 qrJT,
-                jacobianconstraintmap,
-                tagmultiplicity,
-                pdiagnoselist,
+                block.jacobianconstraintmap,
                 R,
-                constrNum,
-                rank,
-                nonredundantconstrNum
+                block.constrNum,
+                block.rank,
+                block.conflictGroups
             );
-            if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
-                dofs = paramsNum - nonredundantconstrNum;
-            }
         }
-
-#ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed DenseQR_end_time;
-
-        auto SolveTime = Base::TimeElapsed::diffTimeF(DenseQR_start_time, DenseQR_end_time);
-
-        Base::Console().log("\nDenseQR - Lapsed Time: %f seconds\n", SolveTime);
-#endif
     }
-
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-    else if (qrAlgorithm == EigenSparseQR) {
-# ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed SparseQR_start_time;
-# endif
-        int rank = 0;
-        Eigen::MatrixXd R;
+    else if (algorithm == EigenSparseQR) {
         Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT;
-        // Here we give the system the possibility to run the two QR decompositions in parallel,
-        // depending on the load of the system so we are using the default std::launch::async |
-        // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
-        //
-        // identifyDependentParametersSparseQR(J, jacobianconstraintmap, pdiagnoselist, true)
-        //
         // Debug:
         // auto fut =
         // std::async(std::launch::deferred,&System::identifyDependentParametersSparseQR, this,
-        // J, jacobianconstraintmap, pdiagnoselist, false);
+        // J, jacobianconstraintmap, pdiagnoselist, dependentParametersGroups, false);
         auto fut = std::async(
+            policy,
             &System::identifyDependentParametersSparseQR,
             this,
-            J,
-            jacobianconstraintmap,
-            pdiagnoselist,
+            std::cref(block.J),
+            std::cref(block.jacobianconstraintmap),
+            std::cref(block.pdiagnoselist),
+            std::ref(block.dependentParametersGroups),
             /*silent=*/true
         );
 
         makeSparseQRDecomposition(
-            J,
-            jacobianconstraintmap,
+            block.J,
+            block.jacobianconstraintmap,
             SqrJT,
-            rank,
+            block.rank,
             R,
             /*transposed=*/true,
-            /*silent=*/false
+            silent
         );
 
-        int paramsNum = SqrJT.rows();
-        int constrNum = SqrJT.cols();
+        block.paramsNum = SqrJT.rows();
+        block.constrNum = SqrJT.cols();
 
         fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
 
-        dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
-
-        // Detecting conflicting or redundant constraints
-        if (constrNum > rank) {
-            int nonredundantconstrNum;
-
-            identifyConflictingRedundantConstraints(
-                alg,
+        if (block.constrNum > block.rank) {
+            identifyConflictGroups(
                 SqrJT,
-                jacobianconstraintmap,
-                tagmultiplicity,
-                pdiagnoselist,
+                block.jacobianconstraintmap,
                 R,
-                constrNum,
-                rank,
-                nonredundantconstrNum
+                block.constrNum,
+                block.rank,
+                block.conflictGroups
             );
-
-            if (paramsNum == rank && nonredundantconstrNum > rank) {
-                // over-constrained
-                dofs = paramsNum - nonredundantconstrNum;
-            }
         }
-
-# ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed SparseQR_end_time;
-
-        auto SolveTime = Base::TimeElapsed::diffTimeF(SparseQR_start_time, SparseQR_end_time);
-
-        Base::Console().log("\nSparseQR - Lapsed Time: %f seconds\n", SolveTime);
-# endif
     }
 #endif
-
-    return dofs;
 }
 
 void System::makeDenseQRDecomposition(
@@ -5255,6 +5697,7 @@ void System::identifyDependentParametersDenseQR(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
     const GCS::VEC_pD& pdiagnoselist,
+    std::vector<std::vector<double*>>& dependentParametersGroups,
     bool silent
 )
 {
@@ -5265,7 +5708,14 @@ void System::identifyDependentParametersDenseQR(
 
     makeDenseQRDecomposition(J, jacobianconstraintmap, qrJ, rank, Rparams, false, true);
 
-    identifyDependentParameters(qrJ, Rparams, rank, pdiagnoselist, silent);
+    identifyDependentParameters(
+        qrJ,
+        Rparams,
+        rank,
+        pdiagnoselist,
+        dependentParametersGroups,
+        silent
+    );
 }
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
@@ -5273,6 +5723,7 @@ void System::identifyDependentParametersSparseQR(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
     const GCS::VEC_pD& pdiagnoselist,
+    std::vector<std::vector<double*>>& dependentParametersGroups,
     bool silent
 )
 {
@@ -5291,7 +5742,14 @@ void System::identifyDependentParametersSparseQR(
         true
     );  // do not transpose allow one to diagnose parameters
 
-    identifyDependentParameters(SqrJ, Rparams, nontransprank, pdiagnoselist, silent);
+    identifyDependentParameters(
+        SqrJ,
+        Rparams,
+        nontransprank,
+        pdiagnoselist,
+        dependentParametersGroups,
+        silent
+    );
 }
 #endif
 
@@ -5301,6 +5759,7 @@ void System::identifyDependentParameters(
     Eigen::MatrixXd& Rparams,
     int rank,
     const GCS::VEC_pD& pdiagnoselist,
+    std::vector<std::vector<double*>>& dependentParametersGroups,
     bool silent
 )
 {
@@ -5318,20 +5777,18 @@ void System::identifyDependentParameters(
     }
 #endif
 
-    pDependentParametersGroups.resize(qrJ.cols() - rank);
+    dependentParametersGroups.resize(qrJ.cols() - rank);
     for (int j = rank; j < qrJ.cols(); j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(Rparams(row, j)) > 1e-10) {
                 int origCol = qrJ.colsPermutation().indices()[row];
 
-                pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-                pDependentParameters.push_back(pdiagnoselist[origCol]);
+                dependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
             }
         }
         int origCol = qrJ.colsPermutation().indices()[j];
 
-        pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-        pDependentParameters.push_back(pdiagnoselist[origCol]);
+        dependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
     }
 
 #ifdef _GCS_DEBUG
@@ -5343,7 +5800,7 @@ void System::identifyDependentParameters(
 
         SolverReportingManager::Manager().LogGroupOfParameters(
             "ParameterGroups",
-            pDependentParametersGroups
+            dependentParametersGroups
         );
     }
 
@@ -5457,21 +5914,18 @@ void System::eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd&
 }
 
 template<typename T>
-void System::identifyConflictingRedundantConstraints(
-    Algorithm alg,
+void System::identifyConflictGroups(
     const T& qrJT,
     const std::map<int, int>& jacobianconstraintmap,
-    const std::map<int, int>& tagmultiplicity,
-    GCS::VEC_pD& pdiagnoselist,
     Eigen::MatrixXd& R,
     int constrNum,
     int rank,
-    int& nonredundantconstrNum
+    std::vector<std::vector<Constraint*>>& conflictGroups
 )
 {
     eliminateNonZerosOverPivotInUpperTriangularMatrix(R, rank);
 
-    std::vector<std::vector<Constraint*>> conflictGroups(constrNum - rank);
+    conflictGroups.resize(constrNum - rank);
     for (int j = rank; j < constrNum; j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(R(row, j)) > 1e-10) {
@@ -5484,7 +5938,17 @@ void System::identifyConflictingRedundantConstraints(
 
         conflictGroups[j - rank].push_back(clist[jacobianconstraintmap.at(origCol)]);
     }
+}
 
+void System::identifyConflictingRedundantConstraints(
+    Algorithm alg,
+    std::vector<std::vector<Constraint*>>& conflictGroups,
+    const std::map<int, int>& tagmultiplicity,
+    GCS::VEC_pD& pdiagnoselist,
+    int constrNum,
+    int& nonredundantconstrNum
+)
+{
     // Augment the information regarding the group of constraints that are conflicting or redundant.
     if (debugMode == IterationLevel) {
         SolverReportingManager::Manager().LogGroupOfConstraints(
@@ -5594,8 +6058,9 @@ void System::identifyConflictingRedundantConstraints(
         return (constr->isDriving() && skipped.count(constr) == 0);
     });
 
-    SubSystem* subSysTmp = new SubSystem(clistTmp, pdiagnoselist);
-    int res = solve(subSysTmp, true, alg, true);
+    // the remaining constraints are solved component by component, as in the regular solve
+    std::vector<SubSystem*> subSysTmp = makeDecoupledSubSystems(clistTmp, pdiagnoselist);
+    int res = solveDecoupled(subSysTmp, alg, true);
 
     if (debugMode == Minimal || debugMode == IterationLevel) {
         std::string solvername;
@@ -5615,7 +6080,9 @@ void System::identifyConflictingRedundantConstraints(
     }
 
     if (res == Success) {
-        subSysTmp->applySolution();
+        for (auto subsys : subSysTmp) {
+            subsys->applySolution();
+        }
         std::ranges::copy_if(
             skipped,
             std::inserter(redundant, redundant.begin()),
@@ -5656,7 +6123,7 @@ void System::identifyConflictingRedundantConstraints(
             constrNum--;
         }
     }
-    delete subSysTmp;
+    deleteAllContent(subSysTmp);
 
     // simplified output of conflicting tags
     SET_I conflictingTagsSet;
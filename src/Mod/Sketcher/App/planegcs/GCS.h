@@ -148,6 +148,11 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // JacobiMatrix is either Eigen::MatrixXd or Eigen::SparseMatrix<double>
+    template<typename JacobiMatrix>
+    int solve_LM(SubSystem* subsys, bool isRedundantsolving);
+    template<typename JacobiMatrix>
+    int solve_DL(SubSystem* subsys, bool isRedundantsolving);
 
     void makeReducedJacobian(
         Eigen::MatrixXd& J,
@@ -187,19 +192,52 @@ private:
         int rank
     );
 
+    // A block of the reduced Jacobian that is decoupled from the rest of it, i.e. the constraints
+    // and parameters of one component, and the results of its QR diagnosis
+    struct DiagnosedBlock
+    {
+        Eigen::MatrixXd J;
+        std::map<int, int> jacobianconstraintmap;
+        GCS::VEC_pD pdiagnoselist;
+        int paramsNum = 0;
+        int constrNum = 0;
+        int rank = 0;
+        std::vector<std::vector<Constraint*>> conflictGroups;
+        std::vector<std::vector<double*>> dependentParametersGroups;
+    };
+
+    void splitReducedJacobian(
+        Eigen::MatrixXd& J,
+        const std::map<int, int>& jacobianconstraintmap,
+        const GCS::VEC_pD& pdiagnoselist,
+        std::vector<DiagnosedBlock>& blocks
+    );
+
+    void diagnoseBlock(DiagnosedBlock& block, bool concurrent, bool silent);
+
     template<typename T>
-    void identifyConflictingRedundantConstraints(
-        Algorithm alg,
+    void identifyConflictGroups(
         const T& qrJT,
         const std::map<int, int>& jacobianconstraintmap,
-        const std::map<int, int>& tagmultiplicity,
-        GCS::VEC_pD& pdiagnoselist,
         Eigen::MatrixXd& R,
         int constrNum,
         int rank,
+        std::vector<std::vector<Constraint*>>& conflictGroups
+    );
+
+    void identifyConflictingRedundantConstraints(
+        Algorithm alg,
+        std::vector<std::vector<Constraint*>>& conflictGroups,
+        const std::map<int, int>& tagmultiplicity,
+        GCS::VEC_pD& pdiagnoselist,
+        int constrNum,
         int& nonredundantconstrNum
     );
 
+    // Solves the subsystems, which must not share any parameters, concurrently and returns the
+    // worst of their results
+    int solveDecoupled(std::vector<SubSystem*>& subsystems, Algorithm alg, bool isRedundantsolving);
+
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
@@ -207,6 +245,7 @@ private:
         const Eigen::MatrixXd& J,
         const std::map<int, int>& jacobianconstraintmap,
         const GCS::VEC_pD& pdiagnoselist,
+        std::vector<std::vector<double*>>& dependentParametersGroups,
         bool silent = true
     );
 #endif
@@ -215,6 +254,7 @@ private:
         const Eigen::MatrixXd& J,
         const std::map<int, int>& jacobianconstraintmap,
         const GCS::VEC_pD& pdiagnoselist,
+        std::vector<std::vector<double*>>& dependentParametersGroups,
         bool silent = true
     );
 
@@ -224,6 +264,7 @@ private:
         Eigen::MatrixXd& Rparams,
         int rank,
         const GCS::VEC_pD& pdiagnoselist,
+        std::vector<std::vector<double*>>& dependentParametersGroups,
         bool silent = true
     );
 
@@ -241,6 +282,8 @@ public:
     QRAlgorithm qrAlgorithm;
     bool autoChooseAlgorithm;
     int autoQRThreshold;
+    int sparseJacobiThreshold;  // LM and DogLeg use a sparse Jacobian for subsystems with at least
+                                // this many parameters
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
@@ -269,6 +269,27 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // c2p refers to the entries of pvals, whose positions are the columns of plist.
+    // Structural zeros are kept, so the sparsity pattern is the same on every call
+    // and solvers can reuse their symbolic analysis.
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        std::map<Constraint*, VEC_pD>::const_iterator it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (VEC_pD::const_iterator param = it->second.begin(); param != it->second.end();
+             ++param) {
+            int j = static_cast<int>(*param - pvals.data());
+            triplets.emplace_back(i, j, clist[i]->grad(*param));
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
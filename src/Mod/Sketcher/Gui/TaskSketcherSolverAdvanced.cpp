@@ -45,6 +45,7 @@
 #define DEFAULT_SOLVER 2          // DL=2, LM=1, BFGS=0
 #define DEFAULT_RSOLVER 2         // DL=2, LM=1, BFGS=0
 #define DEFAULT_QRSOLVER 1        // DENSE=0, SPARSEQR=1
+#define SPARSE_JACOBI_THRESHOLD 300  // LM and DogLeg switch to a sparse Jacobian from this size
 #define QR_PIVOT_THRESHOLD 1E-13  // under this value a Jacobian value is regarded as zero
 #define DEFAULT_SOLVER_DEBUG 1    // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
@@ -73,6 +74,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch* sketc
     ui->comboBoxQRMethod->onRestore();
     ui->spinBoxAutoQRThreshold->onRestore();
     ui->checkBoxAutoChooseAlgo->onRestore();
+    ui->spinBoxSparseJacobiThreshold->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
     ui->comboBoxRedundantDefaultSolver->onRestore();
     ui->spinBoxRedundantSolverMaxIterations->onRestore();
@@ -118,6 +120,12 @@ void TaskSketcherSolverAdvanced::setupConnections()
         this,
         &TaskSketcherSolverAdvanced::onSpinBoxAutoQRAlgoChanged
     );
+    connect(
+        ui->spinBoxSparseJacobiThreshold,
+        qOverload<int>(&QSpinBox::valueChanged),
+        this,
+        &TaskSketcherSolverAdvanced::onSpinBoxSparseJacobiThresholdValueChanged
+    );
 #if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
     connect(
         ui->checkBoxAutoChooseAlgo,
@@ -673,6 +681,13 @@ void TaskSketcherSolverAdvanced::onSpinBoxAutoQRAlgoChanged(int i)
         .setAutoQRThreshold(i);
 }
 
+void TaskSketcherSolverAdvanced::onSpinBoxSparseJacobiThresholdValueChanged(int i)
+{
+    ui->spinBoxSparseJacobiThreshold->onSave();
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setSparseJacobiThreshold(i);
+}
+
 void TaskSketcherSolverAdvanced::onCheckBoxAutoQRAlgoStateChanged(int state)
 {
     if (state == Qt::Checked) {
@@ -833,6 +848,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     hGrp->SetASCII("Convergence", QString::number(CONVERGENCE).toUtf8());
     hGrp->SetASCII("RedundantConvergence", QString::number(CONVERGENCE).toUtf8());
     hGrp->SetInt("QRMethod", DEFAULT_QRSOLVER);
+    hGrp->SetInt("SparseJacobiThreshold", SPARSE_JACOBI_THRESHOLD);
     hGrp->SetASCII("QRPivotThreshold", QString::number(QR_PIVOT_THRESHOLD).toUtf8());
     hGrp->SetInt("DebugMode", DEFAULT_SOLVER_DEBUG);
 
@@ -844,6 +860,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     ui->comboBoxQRMethod->onRestore();
     ui->spinBoxAutoQRThreshold->onRestore();
     ui->checkBoxAutoChooseAlgo->onRestore();
+    ui->spinBoxSparseJacobiThreshold->onRestore();
     ui->lineEditQRPivotThreshold->onRestore();
     ui->comboBoxRedundantDefaultSolver->onRestore();
     ui->spinBoxRedundantSolverMaxIterations->onRestore();
@@ -867,6 +884,7 @@ void TaskSketcherSolverAdvanced::updateSketchObject()
     sketch.setQRAlgorithm((GCS::QRAlgorithm)ui->comboBoxQRMethod->currentIndex());
     sketch.setAutoQRThreshold(ui->spinBoxAutoQRThreshold->value());
     sketch.setSketchAutoAlgo(ui->checkBoxAutoChooseAlgo->isChecked());
+    sketch.setSparseJacobiThreshold(ui->spinBoxSparseJacobiThreshold->value());
     sketch.setQRPivotThreshold(ui->lineEditQRPivotThreshold->text().toDouble());
     sketch.setConvergenceRedundant(ui->lineEditRedundantConvergence->text().toDouble());
     sketch.setConvergence(ui->lineEditConvergence->text().toDouble());
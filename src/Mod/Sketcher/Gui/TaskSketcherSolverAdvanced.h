@@ -54,6 +54,7 @@ private:
     void onSpinBoxMaxIterValueChanged(int i);
     void onSpinBoxAutoQRAlgoChanged(int i);
     void onCheckBoxAutoQRAlgoStateChanged(int state);
+    void onSpinBoxSparseJacobiThresholdValueChanged(int i);
     void onCheckBoxSketchSizeMultiplierStateChanged(int state);
     void onLineEditConvergenceEditingFinished();
     void onComboBoxQRMethodCurrentIndexChanged(int index);
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include <App/Application.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
@@ -238,6 +240,40 @@ TEST_F(ElementMapTest, eraseIndexedName)
     EXPECT_EQ(findAllAfterRepeat.size(), 0);
 }
 
+TEST_F(ElementMapTest, eraseManyKeepsOtherNamesFindable)
+{
+    // Arrange
+    // Enough names to grow the name table several times, so that erasing has
+    // to move names within their probe sequences
+    Data::ElementMap elementMap;
+    const int count = 2000;
+    for (int i = 1; i <= count; ++i) {
+        elementMap.setElementName(
+            Data::IndexedName("Edge", i),
+            Data::MappedName("E" + std::to_string(i)),
+            0
+        );
+    }
+
+    // Act
+    for (int i = 1; i <= count; i += 3) {
+        elementMap.erase(Data::MappedName("E" + std::to_string(i)));
+    }
+    elementMap.setElementName(Data::IndexedName("Edge", 1), Data::MappedName("E1"), 0);
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), count - count / 3);
+    for (int i = 1; i <= count; ++i) {
+        auto found = elementMap.find(Data::MappedName("E" + std::to_string(i)));
+        if (i == 1 || i % 3 != 1) {
+            EXPECT_EQ(found, Data::IndexedName("Edge", i));
+        }
+        else {
+            EXPECT_FALSE(found);
+        }
+    }
+}
+
 TEST_F(ElementMapTest, findMappedName)
 {
     // Arrange
@@ -560,4 +596,75 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
         return e.indexedName.toString() == "Pong2";
     }));
 }
+
+TEST_F(ElementMapTest, findNameSplitIntoPostfix)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    Data::IndexedName edge("Edge", 1);
+    Data::MappedName withPostfix(Data::MappedName("Face1"), ";:M;FUS");
+    cube.elementMapPtr->setElementName(edge, withPostfix, cube.Tag);
+
+    // Act
+    auto result = cube.elementMapPtr->find(Data::MappedName("Face1;:M;FUS"));
+
+    // Assert
+    EXPECT_EQ(result, edge);
+}
+
+TEST_F(ElementMapTest, binaryRoundTripMatchesOriginal)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    Data::IndexedName edge("Edge", 1);
+    Data::ElementIDRefs sids {_hasher->getID("Box")};
+    Data::MappedName withPostfix(Data::MappedName("Face1"), ";:M;FUS");
+    cube.elementMapPtr->setElementName(edge, withPostfix, cube.Tag, &sids);
+    Data::ElementMap::MappedChildElements child = {
+        Data::IndexedName("Vertex", 1),
+        2,
+        0,
+        2L,
+        Data::ElementMapPtr(),
+        QByteArray("abc"),
+        _sid
+    };
+    cube.elementMapPtr->addChildElements(cube.Tag, {child});
+    cube.elementMapPtr->beforeSave(_hasher);
+    std::stringstream stream;
+    cube.elementMapPtr->saveBinary(stream);
+
+    // Act
+    auto restored = std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, stream);
+
+    // Assert
+    auto expected = cube.elementMapPtr->getAll();
+    auto result = restored->getAll();
+    ASSERT_EQ(result.size(), expected.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i].name, expected[i].name);
+        EXPECT_EQ(result[i].index, expected[i].index);
+    }
+    Data::ElementIDRefs restoredSids;
+    EXPECT_EQ(restored->find(edge, &restoredSids), Data::MappedName("Face1;:M;FUS"));
+    ASSERT_EQ(restoredSids.size(), 1);
+    EXPECT_EQ(restoredSids[0].value(), sids[0].value());
+}
+
+TEST_F(ElementMapTest, binaryRestoreRejectsTruncatedData)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    cube.elementMapPtr->beforeSave(_hasher);
+    std::stringstream stream;
+    cube.elementMapPtr->saveBinary(stream);
+    std::string data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+
+    // Act and Assert
+    EXPECT_THROW(
+        std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, truncated),
+        Base::RuntimeError
+    );
+}
 // NOLINTEND(readability-magic-numbers)
@@ -6,9 +6,13 @@
 #include <App/StringHasher.h>
 #include <App/StringHasherPy.h>
 #include <App/StringIDPy.h>
+#include <Base/Writer.h>
 
 #include <QCryptographicHash>
 #include <array>
+#include <chrono>
+#include <map>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1590,113 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, setGetConcurrent)  // NOLINT
+{
+    // Arrange
+    auto ref = givenSomeHashedValues();
+
+    // Act
+    Hasher()->setConcurrent(true);
+    bool expectedTrue = Hasher()->isConcurrent();
+    auto found = Hasher()->getID(ref.value());
+    auto again = Hasher()->getID(givenMappedName("Test1", ";:M;FUS;:Hb:7,F"), {});
+    Hasher()->setConcurrent(false);
+    bool expectedFalse = Hasher()->isConcurrent();
+
+    // Assert
+    EXPECT_TRUE(expectedTrue);
+    EXPECT_FALSE(expectedFalse);
+    EXPECT_EQ(ref, found);
+    EXPECT_EQ(ref, again);
+    EXPECT_EQ(2, Hasher()->size());
+}
+
+TEST_F(StringHasherTest, concurrentGetIDStress)  // NOLINT
+{
+    // Arrange
+    const int numThreads {8};
+    const int numStrings {2000};
+    const int numRounds {20};
+    Hasher()->setConcurrent(true);
+    std::vector<std::vector<long>> results(numThreads, std::vector<long>(numStrings * 2));
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            auto& ids = results[t];
+            for (int round = 0; round < numRounds; ++round) {
+                // Every thread walks the same strings from a different starting point, so that
+                // new strings are raced for and existing ones are looked up at the same time
+                for (int n = 0; n < numStrings; ++n) {
+                    int i = (n + t * numStrings / numThreads) % numStrings;
+                    std::string text = "Edge" + std::to_string(i);
+                    ids[i] = Hasher()->getID(text.c_str()).value();
+                    std::string postfix = ";:M;FUS;:H" + std::to_string(i % 97) + ":7,F";
+                    ids[numStrings + i] =
+                        Hasher()->getID(givenMappedName(text.c_str(), postfix.c_str()), {})
+                            .value();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    RecordProperty("getIDCalls", numThreads * numRounds * numStrings * 2);
+    RecordProperty("milliseconds", static_cast<int>(elapsed.count()));
+    Hasher()->setConcurrent(false);
+
+    // Assert
+    for (int t = 1; t < numThreads; ++t) {
+        EXPECT_EQ(results[0], results[t]);
+    }
+    auto idMap = Hasher()->getIDMap();
+    ASSERT_EQ(idMap.size(), Hasher()->size());
+    EXPECT_EQ(1, idMap.begin()->first);
+    EXPECT_EQ(static_cast<long>(idMap.size()), idMap.rbegin()->first);
+}
+
+TEST_F(StringHasherTest, concurrentSaveOnlyDependsOnIDs)  // NOLINT
+{
+    // Arrange
+    const int numThreads {4};
+    const int numStrings {500};
+    Hasher()->setConcurrent(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int n = 0; n < numStrings; ++n) {
+                auto text = "String" + std::to_string((n * (t + 1)) % numStrings);
+                Hasher()->getID(text.c_str());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Hasher()->setConcurrent(false);
+    Hasher()->setSaveAll(true);
+
+    // Rebuild the same table serially, adding the strings in the order of their IDs
+    Base::Reference<App::StringHasher> other(new App::StringHasher);
+    other->setSaveAll(true);
+    for (const auto& entry : Hasher()->getIDMap()) {
+        auto sid = other->getID(entry.second.deref().data().constData());
+        ASSERT_EQ(entry.first, sid.value());
+    }
+
+    // Act
+    Base::StringWriter writer;
+    Hasher()->Save(writer);
+    Base::StringWriter otherWriter;
+    other->Save(otherWriter);
+
+    // Assert
+    EXPECT_EQ(writer.getString(), otherWriter.getString());
+    other->clear();
+}
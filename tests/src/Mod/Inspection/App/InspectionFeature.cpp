@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
+#include <Base/Stream.h>
+#include <App/Document.h>
+#include <src/App/InitApplication.h>
+#include <Mod/Inspection/App/InspectionFeature.h>
+#include <Mod/Mesh/App/FeatureMeshSolid.h>
+#include <Mod/Points/App/PointsFeature.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class InspectionFeatureTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+        Base::Interpreter().runString("import Mesh, Points, Inspection");
+    }
+
+    void SetUp() override
+    {
+        document = App::GetApplication().newDocument("Inspection");
+        pointFile.setFile(Base::FileInfo::getTempFileName() + ".asc");
+        distanceFile.setFile(Base::FileInfo::getTempFileName() + ".bin");
+
+        cube = document->addObject<Mesh::Cube>("Cube");
+        cube->Length.setValue(10.0);
+        cube->Width.setValue(10.0);
+        cube->Height.setValue(10.0);
+
+        // points above and below the top face, some of them outside of the search radius
+        Points::PointKernel kernel;
+        for (int i = 0; i < 1000; i++) {
+            double x = 0.25 * double(i % 37) + 0.5;
+            double y = 0.25 * double(i % 23) + 1.0;
+            double z = 10.0 + 0.125 * double(i % 9 - 4);
+            kernel.push_back(Base::Vector3d(x, y, z));
+        }
+        points = document->addObject<Points::Feature>("Points");
+        points->Points.setValue(kernel);
+
+        Base::ofstream str(pointFile, std::ios::out);
+        str << std::setprecision(9);
+        for (const auto& it : kernel) {
+            str << it.x << " " << it.y << " " << it.z << '\n';
+        }
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(document->getName());
+        pointFile.deleteFile();
+        distanceFile.deleteFile();
+    }
+
+    App::Document* document {};
+    Mesh::Cube* cube {};
+    Points::Feature* points {};
+    Base::FileInfo pointFile;
+    Base::FileInfo distanceFile;
+};
+
+TEST_F(InspectionFeatureTest, mergedStatisticsEqualSequential)
+{
+    // Arrange
+    const float radius = 0.5F;
+    std::vector<float> values {-0.4F, 0.1F, 0.49F, -0.2F, 0.3F, 0.0F};
+    values.push_back(std::numeric_limits<float>::max());
+    values.push_back(-std::numeric_limits<float>::max());
+    Inspection::DistanceStatistics sequential(radius, 4);
+    Inspection::DistanceStatistics first(radius, 4);
+    Inspection::DistanceStatistics second(radius, 4);
+
+    // Act
+    for (std::size_t i = 0; i < values.size(); i++) {
+        sequential.add(values[i]);
+        (i % 2 == 0 ? first : second).add(values[i]);
+    }
+    first += second;
+
+    // Assert
+    EXPECT_EQ(sequential.count, 8);
+    EXPECT_EQ(sequential.numValid, 6);
+    EXPECT_FLOAT_EQ(sequential.minDist, -0.4F);
+    EXPECT_FLOAT_EQ(sequential.maxDist, 0.49F);
+    EXPECT_EQ(first.count, sequential.count);
+    EXPECT_EQ(first.numValid, sequential.numValid);
+    EXPECT_FLOAT_EQ(first.minDist, sequential.minDist);
+    EXPECT_FLOAT_EQ(first.maxDist, sequential.maxDist);
+    EXPECT_DOUBLE_EQ(first.getMean(), sequential.getMean());
+    EXPECT_DOUBLE_EQ(first.getRMS(), sequential.getRMS());
+    EXPECT_EQ(first.histogram, sequential.histogram);
+}
+
+TEST_F(InspectionFeatureTest, streamedStatisticsEqualInMemory)
+{
+    // Arrange
+    const float radius = 0.4F;
+    const int bins = 10;
+    std::vector<App::DocumentObject*> nominals {cube};
+    auto feature = document->addObject<Inspection::Feature>("Inspection");
+    feature->Actual.setValue(points);
+    feature->Nominals.setValues(nominals);
+    feature->SearchRadius.setValue(radius);
+    document->recompute();
+
+    Inspection::DistanceStatistics expected(radius, bins);
+    for (float dist : feature->Distances.getValues()) {
+        expected.add(dist);
+    }
+
+    // Act
+    Inspection::StreamInspection inspection(nominals, radius);
+    inspection.setChunkSize(64);
+    inspection.setHistogramBins(bins);
+    inspection.setDistanceFile(distanceFile.filePath());
+    Inspection::DistanceStatistics stats = inspection.perform(pointFile.filePath());
+
+    // Assert
+    EXPECT_EQ(stats.count, 1000);
+    EXPECT_EQ(stats.count, expected.count);
+    EXPECT_EQ(stats.numValid, expected.numValid);
+    EXPECT_GT(stats.numValid, 0);
+    EXPECT_LT(stats.numValid, stats.count);
+    EXPECT_FLOAT_EQ(stats.minDist, expected.minDist);
+    EXPECT_FLOAT_EQ(stats.maxDist, expected.maxDist);
+    EXPECT_NEAR(stats.getMean(), expected.getMean(), 1e-6);
+    EXPECT_NEAR(stats.getRMS(), expected.getRMS(), 1e-6);
+    EXPECT_EQ(stats.histogram, expected.histogram);
+
+    std::vector<float> distances(stats.count);
+    Base::ifstream str(distanceFile, std::ios::in | std::ios::binary);
+    str.read(
+        reinterpret_cast<char*>(distances.data()),  // NOLINT
+        static_cast<std::streamsize>(distances.size() * sizeof(float))
+    );
+    EXPECT_EQ(distances, feature->Distances.getValues());
+}
+
+namespace
+{
+
+// The exact distance that InspectNominalShape computed before it used a tessellation
+float exactDistance(const TopoDS_Shape& shape, const Base::Vector3f& point)
+{
+    gp_Pnt pnt(point.x, point.y, point.z);
+    BRepExtrema_DistShapeShape distss(shape, BRepBuilderAPI_MakeVertex(pnt).Vertex());
+    auto dist = static_cast<float>(distss.Value());
+    BRepClass3d_SolidClassifier classifier(shape);
+    classifier.Perform(pnt, 0.001);
+    return classifier.State() == TopAbs_IN ? -dist : dist;
+}
+
+// Points close to the curved side and the flat caps of a cylinder of radius 5 and height 10
+std::vector<Base::Vector3f> pointsNearCylinder()
+{
+    std::vector<Base::Vector3f> pts;
+    for (int i = 0; i < 60; i++) {
+        float angle = 2.0F * std::numbers::pi_v<float> * float(i) / 60.0F;
+        float radius = 5.0F + 0.05F * float(i % 9 - 4);
+        float height = 2.0F + 0.1F * float(i);
+        pts.emplace_back(radius * std::cos(angle), radius * std::sin(angle), height);
+
+        float capRadius = 0.05F * float(i);
+        float offset = 0.05F * float(i % 7 - 3);
+        pts.emplace_back(capRadius * std::cos(angle), capRadius * std::sin(angle), 10.0F + offset);
+    }
+    return pts;
+}
+
+}  // namespace
+
+TEST_F(InspectionFeatureTest, nominalShapeDistancesMatchExactProjection)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    std::vector<Base::Vector3f> pts = pointsNearCylinder();
+
+    // Act
+    Inspection::InspectNominalShape nominal(cylinder, 1.0F);
+
+    // Assert
+    for (const auto& pnt : pts) {
+        EXPECT_NEAR(nominal.getDistance(pnt), exactDistance(cylinder, pnt), 1e-4F);
+    }
+}
+
+TEST_F(InspectionFeatureTest, nominalShapeDistancesDoNotDependOnThreads)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    std::vector<Base::Vector3f> pts = pointsNearCylinder();
+    Inspection::InspectNominalShape nominal(cylinder, 1.0F);
+    std::vector<float> expected;
+    for (const auto& pnt : pts) {
+        expected.push_back(nominal.getDistance(pnt));
+    }
+
+    // Act
+    // Each thread walks all points, so the faces are projected from several threads at once
+    std::vector<std::future<std::vector<float>>> results;
+    for (int i = 0; i < 4; i++) {
+        results.push_back(std::async(std::launch::async, [&nominal, &pts]() {
+            std::vector<float> distances;
+            for (const auto& pnt : pts) {
+                distances.push_back(nominal.getDistance(pnt));
+            }
+            return distances;
+        }));
+    }
+
+    // Assert
+    for (auto& result : results) {
+        EXPECT_EQ(result.get(), expected);
+    }
+}
+
+TEST_F(InspectionFeatureTest, nominalShapeKeepsTheShapeUntouched)
+{
+    // Arrange
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+
+    // Act
+    Inspection::InspectNominalShape nominal(cylinder, 1.0F);
+
+    // Assert
+    for (TopExp_Explorer xp(cylinder, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        EXPECT_TRUE(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull());
+    }
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
 #include <src/App/InitApplication.h>
@@ -108,4 +109,35 @@ TEST_F(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST_F(MeshTest, TestCutWithPlanesMatchesCutWithPlane)
+{
+    // square tube along the z axis
+    MeshCore::MeshKernel kernel;
+    std::vector<Base::Vector3f> corners {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    for (std::size_t i = 0; i < corners.size(); i++) {
+        Base::Vector3f p1 = corners[i];
+        Base::Vector3f p2 = corners[(i + 1) % corners.size()];
+        Base::Vector3f p3 = p2 + Base::Vector3f(0, 0, 1);
+        Base::Vector3f p4 = p1 + Base::Vector3f(0, 0, 1);
+        kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+        kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p3, p4));
+    }
+
+    Base::Vector3f normal {0, 0, 1};
+    std::vector<float> distances {0.75F, 2.0F, 0.25F, 0.5F};
+    MeshCore::MeshAlgorithm algo(kernel);
+    std::vector<std::list<std::vector<Base::Vector3f>>> results;
+    algo.CutWithPlanes(normal, distances, results, 1.0e-2F, true);
+
+    MeshCore::MeshFacetGrid grid(kernel);
+    ASSERT_EQ(results.size(), distances.size());
+    for (std::size_t i = 0; i < distances.size(); i++) {
+        std::list<std::vector<Base::Vector3f>> polylines;
+        algo.CutWithPlane(normal * distances[i], normal, grid, polylines, 1.0e-2F, true);
+        EXPECT_EQ(results[i], polylines);
+    }
+    EXPECT_FALSE(results[0].empty());
+    EXPECT_TRUE(results[1].empty());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
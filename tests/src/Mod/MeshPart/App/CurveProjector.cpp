@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <TopoDS_Edge.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Circ.hxx>
+
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/MeshPart/App/CurveProjector.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+struct Projection
+{
+    bool hit {false};
+    MeshCore::FacetIndex facet {MeshCore::FACET_INDEX_MAX};
+    Base::Vector3f point;
+};
+
+// The check of all facets that was used before the facet grid
+Projection projectWithAllFacets(const MeshCore::MeshKernel& kernel, const Base::Vector3f& pnt)
+{
+    Projection proj;
+    float minLength = std::numeric_limits<float>::max();
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        Base::Vector3f result;
+        if (it->Foraminate(pnt, it->GetNormal(), result)) {
+            float dist = (pnt - result).Length();
+            if (dist < minLength) {
+                minLength = dist;
+                proj.hit = true;
+                proj.facet = it.Position();
+                proj.point = result;
+            }
+        }
+    }
+
+    return proj;
+}
+
+class CurveProjectorTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const float radius = 10.0F;
+        const int nu = 48;
+        const int nv = 24;
+        auto point = [radius](int i, int j) {
+            float phi = 2.0F * std::numbers::pi_v<float> * float(i) / float(nu);
+            float theta = std::numbers::pi_v<float> * float(j) / float(nv);
+            return Base::Vector3f(
+                radius * std::sin(theta) * std::cos(phi),
+                radius * std::sin(theta) * std::sin(phi),
+                radius * std::cos(theta)
+            );
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int j = 0; j < nv; j++) {
+            for (int i = 0; i < nu; i++) {
+                Base::Vector3f p1 = point(i, j);
+                Base::Vector3f p2 = point(i, j + 1);
+                Base::Vector3f p3 = point(i + 1, j + 1);
+                Base::Vector3f p4 = point(i + 1, j);
+                if (j > 0) {
+                    facets.emplace_back(p1, p2, p4);
+                }
+                if (j < nv - 1) {
+                    facets.emplace_back(p4, p2, p3);
+                }
+            }
+        }
+        kernel = facets;
+
+        gp_Circ circle(gp_Ax2(gp_Pnt(0, 0, 3), gp_Dir(0, 0, 1)), 12.0);
+        edge = BRepBuilderAPI_MakeEdge(circle).Edge();
+    }
+
+    MeshCore::MeshKernel kernel;
+    TopoDS_Edge edge;
+};
+
+}  // namespace
+
+TEST_F(CurveProjectorTest, findStartPointEqualsCheckOfAllFacets)
+{
+    MeshPart::CurveProjectorSimple projector(edge, kernel);
+    for (int i = 0; i < 200; i++) {
+        float scale = 0.5F + 0.005F * float(i);
+        Base::Vector3f pnt(
+            scale * 10.0F * std::cos(0.7F * float(i)),
+            scale * 10.0F * std::sin(0.3F * float(i)),
+            scale * 10.0F * std::cos(1.1F * float(i))
+        );
+
+        Projection expected = projectWithAllFacets(kernel, pnt);
+        Base::Vector3f result;
+        MeshCore::FacetIndex facet = MeshCore::FACET_INDEX_MAX;
+        bool hit = projector.findStartPoint(kernel, pnt, result, facet);
+
+        ASSERT_EQ(hit, expected.hit);
+        if (hit) {
+            EXPECT_EQ(facet, expected.facet);
+            EXPECT_EQ(result, expected.point);
+        }
+    }
+}
+
+TEST_F(CurveProjectorTest, projectedCurveEqualsCheckOfAllFacets)
+{
+    MeshPart::CurveProjectorSimple projector(edge, kernel);
+    std::vector<Base::Vector3f> points;
+    projector.GetSampledCurves(edge, points, 1000);
+
+    std::vector<MeshPart::CurveProjector::FaceSplitEdge> expected;
+    Projection last;
+    for (const auto& pnt : points) {
+        Projection proj = projectWithAllFacets(kernel, pnt);
+        if (proj.hit && last.hit) {
+            MeshPart::CurveProjector::FaceSplitEdge splitEdge;
+            splitEdge.ulFaceIndex = proj.facet;
+            splitEdge.p1 = last.point;
+            splitEdge.p2 = proj.point;
+            expected.push_back(splitEdge);
+        }
+        last = proj;
+    }
+
+    const auto& splitEdges = projector.result()[edge];
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(splitEdges.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(splitEdges[i].ulFaceIndex, expected[i].ulFaceIndex);
+        EXPECT_EQ(splitEdges[i].p1, expected[i].p1);
+        EXPECT_EQ(splitEdges[i].p2, expected[i].p2);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
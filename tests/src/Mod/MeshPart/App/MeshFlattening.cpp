@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <Mod/MeshPart/App/MeshFlatteningLscmRelax.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// A part of a cylinder is developable, so a flattening must preserve the edge lengths
+class LscmRelaxTest: public ::testing::Test
+{
+protected:
+    void makeCylinderStrip(long nu, long nv)
+    {
+        const double radius = 10.0;
+        const double angle = 2.0;
+        const double height = 15.0;
+        vertices.resize(3, nu * nv);
+        for (long j = 0; j < nv; j++) {
+            for (long i = 0; i < nu; i++) {
+                double phi = angle * double(i) / double(nu - 1);
+                double z = height * double(j) / double(nv - 1);
+                vertices.col(j * nu + i) << radius * std::cos(phi), radius * std::sin(phi), z;
+            }
+        }
+        triangles.resize(3, (nu - 1) * (nv - 1) * 2);
+        long index = 0;
+        for (long j = 0; j < nv - 1; j++) {
+            for (long i = 0; i < nu - 1; i++) {
+                long p = j * nu + i;
+                triangles.col(index++) << p, p + 1, p + nu + 1;
+                triangles.col(index++) << p, p + nu + 1, p + nu;
+            }
+        }
+    }
+
+    double maxEdgeLengthError(const lscmrelax::LscmRelax& flattener) const
+    {
+        double error = 0.0;
+        for (long i = 0; i < triangles.cols(); i++) {
+            for (int j = 0; j < 3; j++) {
+                long v1 = triangles(j, i);
+                long v2 = triangles((j + 1) % 3, i);
+                double l3d = (vertices.col(v2) - vertices.col(v1)).norm();
+                double l2d = (flattener.flat_vertices.col(v2) - flattener.flat_vertices.col(v1)).norm();
+                error = std::max(error, std::abs(l3d - l2d) / l3d);
+            }
+        }
+        return error;
+    }
+
+    RowMat<double, 3> vertices;
+    RowMat<long, 3> triangles;
+};
+
+}  // namespace
+
+TEST_F(LscmRelaxTest, testDevelopableSurface)
+{
+    makeCylinderStrip(20, 10);
+    lscmrelax::LscmRelax flattener(vertices, triangles, {});
+    flattener.lscm();
+    for (int i = 0; i < 5; i++) {
+        flattener.relax(0.95);
+    }
+
+    EXPECT_LT(maxEdgeLengthError(flattener), 0.01);
+    EXPECT_NEAR(flattener.get_flat_area(), flattener.get_area(), 0.01 * flattener.get_area());
+}
+
+TEST_F(LscmRelaxTest, testRelaxConverges)
+{
+    makeCylinderStrip(20, 10);
+    lscmrelax::LscmRelax flattener(vertices, triangles, {});
+    flattener.lscm();
+
+    // the factorization of the first step is reused by the later steps
+    flattener.relax(1.0);
+    double error1 = maxEdgeLengthError(flattener);
+    flattener.relax(1.0);
+    flattener.relax(1.0);
+    double error3 = maxEdgeLengthError(flattener);
+    EXPECT_LE(error3, error1 + 1e-9);
+}
+
+TEST_F(LscmRelaxTest, testLeastSquaresSolution)
+{
+    Eigen::MatrixXd dense(4, 2);
+    dense << 1, 0, 1, 1, 1, 2, 1, 3;
+    Eigen::VectorXd b(4);
+    b << 1, 3, 4, 7;
+
+    spMat A = dense.sparseView();
+    Eigen::VectorXd sol = lscmrelax::LscmRelax::solve_least_squares(A, b);
+    Eigen::VectorXd expected = dense.colPivHouseholderQr().solve(b);
+    EXPECT_LT((sol - expected).norm(), 1e-12);
+}
+
+TEST_F(LscmRelaxTest, testNearSingularLeastSquares)
+{
+    // the normal equations are nearly singular, a cholesky factorization is off by several percent
+    const double eps = 1e-7;
+    Eigen::MatrixXd dense(3, 2);
+    dense << 1, 1, 1, 1, 1, 1 + eps;
+    Eigen::VectorXd b(3);
+    b << 1, 2, 3;
+
+    spMat A = dense.sparseView();
+    Eigen::VectorXd sol = lscmrelax::LscmRelax::solve_least_squares(A, b);
+    ASSERT_TRUE(sol.allFinite());
+    EXPECT_NEAR(sol[0], 1.5 - 1.5 / eps, 1e-3 * 1.5 / eps);
+    EXPECT_NEAR(sol[1], 1.5 / eps, 1e-3 * 1.5 / eps);
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the flattening of a larger mesh
+TEST_F(LscmRelaxTest, DISABLED_benchmarkFlattening)
+{
+    makeCylinderStrip(300, 200);
+    auto start = std::chrono::steady_clock::now();
+    lscmrelax::LscmRelax flattener(vertices, triangles, {});
+    flattener.lscm();
+    auto lscm = std::chrono::steady_clock::now();
+    for (int i = 0; i < 5; i++) {
+        flattener.relax(0.95);
+    }
+    auto relax = std::chrono::steady_clock::now();
+
+    using ms = std::chrono::milliseconds;
+    RecordProperty("triangles", int(triangles.cols()));
+    RecordProperty("lscm_ms", int(std::chrono::duration_cast<ms>(lscm - start).count()));
+    RecordProperty("relax_ms", int(std::chrono::duration_cast<ms>(relax - lscm).count()));
+    EXPECT_LT(maxEdgeLengthError(flattener), 0.01);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <src/App/InitApplication.h>
+
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRep_Builder.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/MeshPart/App/Mesher.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class MesherTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    static std::vector<TopoDS_Face> getFaces(const TopoDS_Shape& shape)
+    {
+        std::vector<TopoDS_Face> faces;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            faces.push_back(TopoDS::Face(xp.Current()));
+        }
+        return faces;
+    }
+
+    static TopoDS_Compound makeCompound(const std::vector<TopoDS_Face>& faces)
+    {
+        BRep_Builder builder;
+        TopoDS_Compound comp;
+        builder.MakeCompound(comp);
+        for (const auto& face : faces) {
+            builder.Add(comp, face);
+        }
+        return comp;
+    }
+
+    // The faces of a box with a cylinder on top of it
+    static std::vector<TopoDS_Face> makeFaces()
+    {
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+        gp_Ax2 axis(gp_Pnt(5.0, 5.0, 5.0), gp_Dir(0.0, 0.0, 1.0));
+        TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(axis, 3.0, 10.0).Shape();
+        return getFaces(BRepAlgoAPI_Fuse(box, cylinder).Shape());
+    }
+
+    // Meshes the shape with the standard mesher and the cache of the active document
+    static std::unique_ptr<Mesh::MeshObject> mesh(const TopoDS_Shape& shape, std::size_t& numMeshed)
+    {
+        MeshPart::Mesher mesher(shape);
+        mesher.setMethod(MeshPart::Mesher::Standard);
+        mesher.setDeflection(0.1);
+        mesher.setAngularDeflection(0.5);
+        std::unique_ptr<Mesh::MeshObject> meshObject(mesher.createMesh());
+        numMeshed = mesher.getNumMeshedFaces();
+        return meshObject;
+    }
+
+    // Meshes a copy of the shape without a triangulation and without the cache
+    std::unique_ptr<Mesh::MeshObject> meshUncached(
+        const TopoDS_Shape& shape,
+        std::size_t& numMeshed
+    )
+    {
+        TopoDS_Shape copy = BRepBuilderAPI_Copy(shape, Standard_True, Standard_False).Shape();
+        App::GetApplication().setActiveDocument(static_cast<App::Document*>(nullptr));
+        auto meshObject = mesh(copy, numMeshed);
+        App::GetApplication().setActiveDocument(_doc);
+        return meshObject;
+    }
+
+    static void expectSameMesh(const Mesh::MeshObject& meshObject, const Mesh::MeshObject& expected)
+    {
+        const auto& points = meshObject.getKernel().GetPoints();
+        const auto& expectedPoints = expected.getKernel().GetPoints();
+        ASSERT_EQ(points.size(), expectedPoints.size());
+        for (std::size_t i = 0; i < points.size(); i++) {
+            EXPECT_LT((points[i] - expectedPoints[i]).Length(), 1e-6F);
+        }
+
+        const auto& facets = meshObject.getKernel().GetFacets();
+        const auto& expectedFacets = expected.getKernel().GetFacets();
+        ASSERT_EQ(facets.size(), expectedFacets.size());
+        for (std::size_t i = 0; i < facets.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(facets[i]._aulPoints[j], expectedFacets[i]._aulPoints[j]);
+            }
+        }
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+};
+
+TEST_F(MesherTest, remeshingUnchangedShapeTakesAllFacesFromCache)
+{
+    // Arrange
+    TopoDS_Compound shape = makeCompound(makeFaces());
+    std::size_t numMeshed = 0;
+    auto first = mesh(shape, numMeshed);
+    ASSERT_EQ(numMeshed, getFaces(shape).size());
+
+    // Act
+    auto second = mesh(shape, numMeshed);
+
+    // Assert
+    EXPECT_EQ(numMeshed, 0);
+    expectSameMesh(*second, *first);
+}
+
+TEST_F(MesherTest, remeshingEditedShapeOnlyMeshesChangedFace)
+{
+    // Arrange
+    auto faces = makeFaces();
+    auto cylindrical = std::find_if(faces.begin(), faces.end(), [](const TopoDS_Face& face) {
+        return BRepAdaptor_Surface(face).GetType() == GeomAbs_Cylinder;
+    });
+    ASSERT_NE(cylindrical, faces.end());
+
+    TopoDS_Compound shape = makeCompound(faces);
+    std::size_t numMeshed = 0;
+    mesh(shape, numMeshed);
+    ASSERT_EQ(numMeshed, faces.size());
+
+    // the edited face is a new face while all other faces still carry their triangulation
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(0.0, 0.0, 1.0));
+    BRepBuilderAPI_Transform transform(*cylindrical, trsf, Standard_True);
+    *cylindrical = TopoDS::Face(transform.Shape());
+    TopoDS_Compound edited = makeCompound(faces);
+
+    std::size_t numMeshedUncached = 0;
+    auto expected = meshUncached(edited, numMeshedUncached);
+    ASSERT_EQ(numMeshedUncached, faces.size());
+
+    // Act
+    auto meshObject = mesh(edited, numMeshed);
+
+    // Assert
+    EXPECT_EQ(numMeshed, 1);
+    expectSameMesh(*meshObject, *expected);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -128,6 +128,34 @@ protected:
         domains.push_back(domain2);
         return domains;
     }
+
+    std::vector<Part::BRepMesh::Domain> getDomainsWithInteriorNodes() const
+    {
+        // a fan around the center of the square
+        Part::BRepMesh::Domain domain1;
+        domain1.points.emplace_back(0, 0, 0);
+        domain1.points.emplace_back(10, 0, 0);
+        domain1.points.emplace_back(10, 10, 0);
+        domain1.points.emplace_back(0, 10, 0);
+        domain1.points.emplace_back(5, 5, 0);
+
+        for (uint32_t i = 0; i < 4; i++) {
+            Part::BRepMesh::Facet f;
+            f.I1 = i;
+            f.I2 = (i + 1) % 4;
+            f.I3 = 4;
+            domain1.facets.emplace_back(f);
+        }
+
+        // the same square flipped to the other side shares all boundary nodes
+        Part::BRepMesh::Domain domain2 = domain1;
+        domain2.points[4].z = 5;
+
+        std::vector<Part::BRepMesh::Domain> domains;
+        domains.push_back(domain1);
+        domains.push_back(domain2);
+        return domains;
+    }
 };
 
 TEST_F(BRepMeshTest, testNoDomains)
@@ -173,4 +201,20 @@ TEST_F(BRepMeshTest, testUnconnectedDomains)
     EXPECT_EQ(points.size(), 6);
     EXPECT_EQ(faces.size(), 4);
 }
+
+TEST_F(BRepMeshTest, testInteriorNodes)
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(getDomainsWithInteriorNodes(), points, faces);
+
+    EXPECT_EQ(points.size(), 6);
+    EXPECT_EQ(faces.size(), 8);
+
+    auto segments = brepMesh.createSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[0].size(), 4);
+    EXPECT_EQ(segments[1].size(), 4);
+}
 // NOLINTEND
@@ -4,10 +4,13 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include "Mod/Part/App/Geometry.h"
+#include "Mod/Part/App/PartPyCXX.h"
 #include <src/App/InitApplication.h>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include "PartTestHelpers.h"
 #include "App/MappedElement.h"
+#include <Base/Exception.h>
+#include <Base/Interpreter.h>
 
 // using namespace Part;
 // using namespace PartTestHelpers;
@@ -86,3 +89,106 @@ TEST_F(GeometryTest, testTrimBSpline)
     EXPECT_DOUBLE_EQ(nonPeriodicBSpline1.getFirstParameter(), param1);
     EXPECT_DOUBLE_EQ(nonPeriodicBSpline1.getLastParameter(), param2);
 }
+
+TEST_F(GeometryTest, testCurveValuesMatchSingleEvaluation)
+{
+    // Arrange
+    int degree = 3;
+    std::vector<Base::Vector3d> poles {{1, 0, 0}, {1, 1, 0}, {1, 0.5, 1}, {0, 1, 0}, {0, 0, 2}};
+    std::vector<double> weights(5, 1.0);
+    std::vector<double> knots = {0.0, 1.0, 2.0};
+    std::vector<int> multiplicities = {degree + 1, 1, degree + 1};
+    Part::GeomBSplineCurve spline(poles, weights, knots, multiplicities, degree, false);
+    const int count = 1000;
+    std::vector<double> params;
+    for (int i = 0; i < count; ++i) {
+        params.push_back(2.0 * i / (count - 1));
+    }
+
+    // Act
+    auto values = spline.values(params, 2);
+
+    // Assert
+    ASSERT_EQ(values.size(), params.size() * 3);
+    for (int i = 0; i < count; ++i) {
+        double u = params[i];
+        EXPECT_LT((values[3 * i] - spline.pointAtParameter(u)).Length(), 1e-12);
+        EXPECT_LT((values[3 * i + 1] - spline.firstDerivativeAtParameter(u)).Length(), 1e-12);
+        EXPECT_LT((values[3 * i + 2] - spline.secondDerivativeAtParameter(u)).Length(), 1e-12);
+    }
+    EXPECT_THROW(spline.values(params, 4), Base::ValueError);
+}
+
+TEST_F(GeometryTest, testSurfaceValuesMatchSingleEvaluation)
+{
+    // Arrange
+    Part::GeomSphere sphere;
+    const int count = 500;
+    std::vector<double> u;
+    std::vector<double> v;
+    for (int i = 0; i < count; ++i) {
+        u.push_back(6.0 * i / count);
+        v.push_back(-1.5 + 3.0 * i / count);
+    }
+
+    // Act
+    auto values = sphere.values(u, v, 1);
+    auto normals = sphere.normals(u, v);
+
+    // Assert
+    ASSERT_EQ(Part::GeomSurface::valuesStride(1), 3);
+    ASSERT_EQ(values.size(), u.size() * 3);
+    ASSERT_EQ(normals.size(), u.size());
+    for (int i = 0; i < count; ++i) {
+        auto toVector = [](const gp_Vec& vec) {
+            return Base::Vector3d(vec.X(), vec.Y(), vec.Z());
+        };
+        gp_Dir normal;
+        ASSERT_TRUE(sphere.normal(u[i], v[i], normal));
+        EXPECT_LT((values[3 * i] - *sphere.point(u[i], v[i])).Length(), 1e-12);
+        EXPECT_LT((values[3 * i + 1] - toVector(sphere.getDN(u[i], v[i], 1, 0))).Length(), 1e-12);
+        EXPECT_LT((values[3 * i + 2] - toVector(sphere.getDN(u[i], v[i], 0, 1))).Length(), 1e-12);
+        EXPECT_LT((normals[i] - toVector(gp_Vec(normal))).Length(), 1e-12);
+    }
+    EXPECT_THROW(sphere.values(u, {0.0}), Base::ValueError);
+}
+
+TEST_F(GeometryTest, testPyDoublesAcceptsNativeByteOrderOnly)
+{
+    // Arrange
+    Base::PyGILStateLocker lock;
+    Py::Object native = Base::Interpreter().runStringObject(
+        "(__import__('ctypes').c_double * 2)(1.0, 2.0)"
+    );
+    Py::Object swapped = Base::Interpreter().runStringObject(
+        "((__import__('ctypes').c_double.__ctype_be__ if __import__('sys').byteorder == 'little'"
+        " else __import__('ctypes').c_double.__ctype_le__) * 2)(1.0, 2.0)"
+    );
+    bool isBuffer = false;
+
+    // Act
+    auto values = Part::getPyDoubles(native.ptr(), &isBuffer);
+
+    // Assert
+    EXPECT_TRUE(isBuffer);
+    EXPECT_EQ(values, std::vector<double>({1.0, 2.0}));
+    EXPECT_THROW(Part::getPyDoubles(swapped.ptr()), Py::TypeError);
+    PyErr_Clear();
+}
+
+TEST_F(GeometryTest, testEmptyVectorsToPython)
+{
+    // Arrange
+    Base::PyGILStateLocker lock;
+    std::vector<Base::Vector3d> single {{1, 2, 3}};
+
+    // Act
+    Py::Object emptyBuffer = Part::vectors2py({}, 1, true);
+    Py::Object incompleteBuffer = Part::vectors2py(single, 2, true);
+    Py::Object emptyList = Part::vectors2py({}, 1, false);
+
+    // Assert
+    EXPECT_EQ(PyObject_Length(emptyBuffer.ptr()), 0);
+    EXPECT_EQ(PyObject_Length(incompleteBuffer.ptr()), 0);
+    EXPECT_EQ(PyObject_Length(emptyList.ptr()), 0);
+}
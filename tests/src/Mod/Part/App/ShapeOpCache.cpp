@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <App/PropertyStandard.h>
+#include "Mod/Part/App/FeaturePartCut.h"
+#include "Mod/Part/App/FuzzyHelper.h"
+#include "Mod/Part/App/ShapeOpCache.h"
+#include <src/App/InitApplication.h>
+
+#include "PartTestHelpers.h"
+
+class ShapeOpCacheTest: public ::testing::Test, public PartTestHelpers::PartTestHelperClass
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        createTestDoc();
+        _cut = _doc->addObject<Part::Cut>();
+        _cut->Base.setValue(_boxes[0]);
+        _cut->Tool.setValue(_boxes[1]);
+        Part::ShapeOpCache::instance().clear();
+        Part::ShapeOpCache::instance().setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        Part::ShapeOpCache::instance().setEnabled(false);
+        Part::ShapeOpCache::instance().clear();
+    }
+
+    Part::Cut* _cut = nullptr;  // NOLINT Can't be private in a test framework
+};
+
+TEST_F(ShapeOpCacheTest, testRecomputeHitsCache)
+{
+    // Arrange
+    _cut->execute();
+    Part::TopoShape first = _cut->Shape.getShape();
+
+    // Act
+    _cut->Label.setValue("Renamed");
+    _cut->execute();
+    Part::TopoShape second = _cut->Shape.getShape();
+    auto stats = Part::ShapeOpCache::instance().getStatistics();
+
+    // Assert
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_EQ(stats.entries, 1U);
+    EXPECT_GT(stats.memory, 0U);
+    EXPECT_TRUE(second.getShape().IsSame(first.getShape()));
+    EXPECT_EQ(second.getElementMapSize(), first.getElementMapSize());
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(second.getShape()), 3.0);
+}
+
+TEST_F(ShapeOpCacheTest, testChangedInputMissesCache)
+{
+    // Arrange
+    _cut->execute();
+
+    // Act
+    _boxes[1]->Length.setValue(0.5);
+    _cut->execute();
+    auto stats = Part::ShapeOpCache::instance().getStatistics();
+
+    // Assert
+    EXPECT_EQ(stats.misses, 2U);
+    EXPECT_EQ(stats.hits, 0U);
+    EXPECT_EQ(stats.entries, 2U);
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(_cut->Shape.getValue()), 4.5);
+}
+
+TEST_F(ShapeOpCacheTest, testSlightlyChangedFloatMissesCache)
+{
+    // Arrange
+    auto& cache = Part::ShapeOpCache::instance();
+    auto prop = dynamic_cast<App::PropertyFloat*>(
+        _cut->addDynamicProperty("App::PropertyFloat", "Value")
+    );
+    ASSERT_NE(prop, nullptr);
+    prop->setValue(1.0);
+    std::string first = cache.makeKey(_cut);
+
+    // Act
+    prop->setValue(1.0 + 1e-9);
+    std::string second = cache.makeKey(_cut);
+
+    // Assert
+    EXPECT_NE(first, second);
+}
+
+TEST_F(ShapeOpCacheTest, testSlightlyChangedFuzzyMissesCache)
+{
+    // Arrange
+    Part::FuzzyHelper::withBooleanFuzzy(1.0, [this]() { _cut->execute(); });
+
+    // Act
+    Part::FuzzyHelper::withBooleanFuzzy(1.0 + 1e-9, [this]() { _cut->execute(); });
+    auto stats = Part::ShapeOpCache::instance().getStatistics();
+
+    // Assert
+    EXPECT_EQ(stats.misses, 2U);
+    EXPECT_EQ(stats.hits, 0U);
+}
+
+TEST_F(ShapeOpCacheTest, testMemoryLimitEvicts)
+{
+    // Arrange
+    auto& cache = Part::ShapeOpCache::instance();
+    auto limit = cache.memoryLimit();
+    _cut->execute();
+    _boxes[1]->Length.setValue(0.5);
+    _cut->execute();
+
+    // Act
+    cache.setMemoryLimit(cache.getStatistics().memory - 1);
+    auto stats = cache.getStatistics();
+    cache.setMemoryLimit(limit);
+
+    // Assert
+    EXPECT_EQ(stats.entries, 1U);
+    EXPECT_EQ(stats.evictions, 1U);
+}
+
+TEST_F(ShapeOpCacheTest, testDisabledCacheIsNotUsed)
+{
+    // Arrange
+    Part::ShapeOpCache::instance().setEnabled(false);
+
+    // Act
+    _cut->execute();
+    _cut->execute();
+    auto stats = Part::ShapeOpCache::instance().getStatistics();
+
+    // Assert
+    EXPECT_FALSE(stats.enabled);
+    EXPECT_EQ(stats.hits, 0U);
+    EXPECT_EQ(stats.misses, 0U);
+    EXPECT_EQ(stats.entries, 0U);
+}
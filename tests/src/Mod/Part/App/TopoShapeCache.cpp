@@ -11,6 +11,9 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopoDS_Edge.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -257,6 +260,25 @@ TEST_F(TopoShapeCacheTest, FindShapeGivenTypeAndIndex)
     EXPECT_FALSE(shapeResult.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, FindGivenInverseLocationMatchesFindGivenParent)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    gp_Trsf transform;
+    transform.SetTranslation(gp_Vec(1.0, 2.0, 3.0));
+    auto movedBox = box.Moved(TopLoc_Location(transform));
+    Part::TopoShapeCache cache(movedBox);
+    auto& ancestry = cache.getAncestry(TopAbs_EDGE);
+    const auto inverse = movedBox.Location().Inverted();
+
+    // Act & Assert
+    for (int index = 1; index <= ancestry.count(); ++index) {
+        auto edge = ancestry.find(movedBox, index);
+        EXPECT_EQ(index, ancestry.find(inverse, edge));
+        EXPECT_EQ(ancestry.find(movedBox, edge), ancestry.find(inverse, edge));
+    }
+}
+
 std::tuple<TopoDS_Shape, std::pair<TopoDS_Shape, TopoDS_Shape>> CreateFusedCubes()
 {
     auto boxMaker1 = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0);
@@ -289,4 +311,33 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, FindAncestorsMatchesMapShapesAndAncestors)
+{
+    // Arrange
+    const auto [fused, ancestors] = CreateFusedCubes();
+    for (const TopoDS_Shape& shape :
+         {fused, static_cast<TopoDS_Shape>(BRepPrimAPI_MakeCylinder(1.0, 2.0).Shape())}) {
+        Part::TopoShapeCache cache(shape);
+        for (auto [subType, type] : {std::pair {TopAbs_EDGE, TopAbs_FACE},
+                                     std::pair {TopAbs_VERTEX, TopAbs_EDGE},
+                                     std::pair {TopAbs_FACE, TopAbs_SOLID}}) {
+            TopTools_IndexedDataMapOfShapeListOfShape expected;
+            TopExp::MapShapesAndAncestors(shape, subType, type, expected);
+            for (int i = 1; i <= expected.Extent(); ++i) {
+                // Act
+                std::vector<TopoDS_Shape> found;
+                cache.findAncestor(shape, expected.FindKey(i), type, &found);
+
+                // Assert
+                const auto& list = expected.FindFromIndex(i);
+                ASSERT_EQ(found.size(), static_cast<std::size_t>(list.Extent()));
+                auto it = found.begin();
+                for (const auto& ancestor : list) {
+                    EXPECT_TRUE(ancestor.IsEqual(*it++));
+                }
+            }
+        }
+    }
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
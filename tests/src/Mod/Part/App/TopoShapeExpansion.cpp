@@ -30,8 +30,11 @@
 #include <ShapeBuild_ReShape.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Edge.hxx>
+#include <TopTools_ListOfShape.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 
+#include <limits>
+
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
 
 using namespace Part;
@@ -1585,6 +1588,48 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, parallelElementMappingMatchesSerial)
+{
+    // Arrange
+    // A row of overlapping boxes, whose fuse has far more sub-shapes than the
+    // default threshold for mapping the names in parallel
+    std::vector<TopoShape> boxes;
+    TopTools_ListOfShape arguments;
+    TopTools_ListOfShape tools;
+    for (int i = 0; i < 16; ++i) {
+        gp_Trsf move;
+        move.SetTranslation(gp_Vec(0.5 * i, 0.25 * (i % 2), 0.0));
+        auto box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0 + 0.1 * i).Shape().Moved(TopLoc_Location(move));
+        boxes.emplace_back(box, i + 1L);
+        (i == 0 ? arguments : tools).Append(box);
+    }
+    BRepAlgoAPI_Fuse fuse;
+    fuse.SetArguments(arguments);
+    fuse.SetTools(tools);
+    fuse.Build();
+    ASSERT_TRUE(fuse.IsDone());
+
+    // Both runs name the same fused shape, so only the threading differs
+    auto mapNames = [&](int threshold) {
+        int previous = TopoShape::setParallelMappingThreshold(threshold);
+        TopoShape fused(100L);
+        fused.makeElementShape(fuse, boxes, Part::OpCodes::Fuse);
+        TopoShape compound(101L);
+        compound.makeElementCompound({fused});
+        TopoShape::setParallelMappingThreshold(previous);
+        return std::make_pair(fused, compound);
+    };
+
+    // Act
+    auto [serialFused, serialCompound] = mapNames(std::numeric_limits<int>::max());
+    auto [parallelFused, parallelCompound] = mapNames(0);
+
+    // Assert
+    EXPECT_GT(serialFused.getElementMapSize(), 128);
+    EXPECT_EQ(parallelFused.getElementMap(), serialFused.getElementMap());
+    EXPECT_EQ(parallelCompound.getElementMap(), serialCompound.getElementMap());
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementDraft)
 {  // Draft as in Draft Angle or sloped sides for removing shapes from a mold.
     // Arrange
@@ -2509,6 +2554,35 @@ TEST_F(TopoShapeExpansionTest, makeElementSlices)
                                                              // TopoNaming logics
 }
 
+TEST_F(TopoShapeExpansionTest, slicesMatchSingleSlices)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape cube1TS {cube1};
+    Base::Vector3d direction {1.0, 0.0, 0.0};
+    // Planes outside of the cube and a repeated plane
+    std::vector<double> distances {0.25, -1.0, 0.5, 0.75, 2.0, 0.5};
+    // Act
+    auto result = cube1TS.slices(direction, distances);
+    // Assert
+    double expectedLength = 0.0;
+    int expectedWires = 0;
+    for (double distance : distances) {
+        for (const auto& wire : cube1TS.slice(direction, distance)) {
+            expectedLength += getLength(wire);
+            ++expectedWires;
+        }
+    }
+    int wires = 0;
+    for (TopExp_Explorer xp(result, TopAbs_WIRE); xp.More(); xp.Next()) {
+        ++wires;
+    }
+    EXPECT_EQ(expectedWires, 4);
+    EXPECT_EQ(wires, expectedWires);
+    EXPECT_FLOAT_EQ(getLength(result), expectedLength);
+    EXPECT_FLOAT_EQ(getLength(result), 16);
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementMirror)
 {
     // Arrange
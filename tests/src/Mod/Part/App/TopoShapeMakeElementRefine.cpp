@@ -2,8 +2,25 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numbers>
+#include <vector>
+
 #include <src/App/InitApplication.h>
 
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Pln.hxx>
+
+#include <Mod/Part/App/modelRefine.h>
+
 #include "PartTestHelpers.h"
 
 class FeaturePartMakeElementRefineTest: public ::testing::Test,
@@ -54,3 +71,141 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, equalitySplitterGroupsCoplanarFaces)
+{
+    // Arrange
+    auto makeFace = [](const gp_Pnt& location, const gp_Dir& normal) {
+        return BRepBuilderAPI_MakeFace(gp_Pln(location, normal), 0.0, 1.0, 0.0, 1.0).Face();
+    };
+    ModelRefine::FaceVectorType faces {
+        makeFace(gp_Pnt(0.0, 0.0, 1.0), gp_Dir(0.0, 0.0, 1.0)),
+        makeFace(gp_Pnt(0.0, 0.0, 2.0), gp_Dir(0.0, 0.0, 1.0)),
+        makeFace(gp_Pnt(5.0, 5.0, 1.0), gp_Dir(0.0, 0.0, -1.0)),
+        makeFace(gp_Pnt(0.0, 0.0, -1.0), gp_Dir(0.0, 0.0, 1.0)),
+        makeFace(gp_Pnt(1000.0, 0.0, 2.0), gp_Dir(0.0, 0.0, 1.0)),
+    };
+    ModelRefine::FaceEqualitySplitter splitter;
+    // Act
+    splitter.split(faces, &ModelRefine::getPlaneObject());
+    // Assert
+    ASSERT_EQ(splitter.getGroupCount(), 2);
+    ASSERT_EQ(splitter.getGroup(0).size(), 2);
+    EXPECT_TRUE(splitter.getGroup(0)[0].IsSame(faces[0]));
+    EXPECT_TRUE(splitter.getGroup(0)[1].IsSame(faces[2]));
+    ASSERT_EQ(splitter.getGroup(1).size(), 2);
+    EXPECT_TRUE(splitter.getGroup(1)[0].IsSame(faces[1]));
+    EXPECT_TRUE(splitter.getGroup(1)[1].IsSame(faces[4]));
+}
+
+TEST_F(FeaturePartMakeElementRefineTest, refineModelKeepsHistoryOfAllFaces)
+{
+    // Arrange
+    const int count {6};
+    TopoDS_Shape fused = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape();
+    for (int i = 1; i < count; ++i) {
+        auto box = BRepPrimAPI_MakeBox(gp_Pnt(i, 0.0, 0.0), 1.0, 1.0, 1.0).Shape();
+        fused = BRepAlgoAPI_Fuse(fused, box).Shape();
+    }
+    TopTools_IndexedMapOfShape inputFaces;
+    TopExp::MapShapes(fused, TopAbs_FACE, inputFaces);
+    // Act
+    Part::BRepBuilderAPI_RefineModel refine(fused);
+    TopTools_IndexedMapOfShape outputFaces;
+    TopExp::MapShapes(refine.Shape(), TopAbs_FACE, outputFaces);
+    // Assert
+    EXPECT_EQ(inputFaces.Extent(), 4 * count + 2);
+    EXPECT_EQ(outputFaces.Extent(), 6);
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(refine.Shape()), count);
+    for (int i = 1; i <= inputFaces.Extent(); ++i) {
+        // Every face is either kept or has a successor for the element mapping
+        EXPECT_TRUE(
+            outputFaces.Contains(inputFaces(i)) || !refine.Modified(inputFaces(i)).IsEmpty()
+        );
+    }
+}
+
+TEST_F(FeaturePartMakeElementRefineTest, refineMultiFaceSolidMatchesGreedyGrouping)
+{
+    // Arrange
+
+    // A row of four boxes with two boxes on top of the first two and two stacked cylinders
+    // on the last box, so that there are several groups of coplanar and of coaxial faces
+    TopoDS_Shape fused = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape();
+    std::vector<TopoDS_Shape> tools {
+        BRepPrimAPI_MakeBox(gp_Pnt(1.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape(),
+        BRepPrimAPI_MakeBox(gp_Pnt(2.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape(),
+        BRepPrimAPI_MakeBox(gp_Pnt(3.0, 0.0, 0.0), 1.0, 1.0, 1.0).Shape(),
+        BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 1.0), 1.0, 1.0, 1.0).Shape(),
+        BRepPrimAPI_MakeBox(gp_Pnt(1.0, 0.0, 1.0), 1.0, 1.0, 1.0).Shape(),
+        BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(3.5, 0.5, 1.0), gp_Dir(0.0, 0.0, 1.0)), 0.25, 0.5)
+            .Shape(),
+        BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(3.5, 0.5, 1.5), gp_Dir(0.0, 0.0, 1.0)), 0.25, 0.5)
+            .Shape(),
+    };
+    for (const auto& tool : tools) {
+        fused = BRepAlgoAPI_Fuse(fused, tool).Shape();
+    }
+
+    // The grouping before the surface keys: each face joins the first group whose first face
+    // is equal to it
+    auto greedyGroups = [](const ModelRefine::FaceVectorType& faces,
+                           ModelRefine::FaceTypedBase& object) {
+        std::vector<ModelRefine::FaceVectorType> groups;
+        for (const auto& face : faces) {
+            auto it = std::find_if(groups.begin(), groups.end(), [&](const auto& group) {
+                return object.isEqual(group.front(), face);
+            });
+            if (it != groups.end()) {
+                it->push_back(face);
+            }
+            else {
+                groups.push_back({face});
+            }
+        }
+        std::erase_if(groups, [](const auto& group) { return group.size() < 2; });
+        return groups;
+    };
+
+    // Act
+    Part::BRepBuilderAPI_RefineModel refine(fused);
+    Part::TopoShape refined(refine.Shape());
+
+    // Assert
+    std::vector<ModelRefine::FaceTypedBase*> objects {
+        &ModelRefine::getPlaneObject(),
+        &ModelRefine::getCylinderObject()
+    };
+    for (auto object : objects) {
+        ModelRefine::FaceVectorType faces;
+        for (TopExp_Explorer xp(fused, TopAbs_FACE); xp.More(); xp.Next()) {
+            const TopoDS_Face& face = TopoDS::Face(xp.Current());
+            if (ModelRefine::FaceTypedBase::getFaceType(face) == object->getType()) {
+                faces.push_back(face);
+            }
+        }
+        ModelRefine::FaceEqualitySplitter splitter;
+        splitter.split(faces, object);
+        auto expected = greedyGroups(faces, *object);
+        ASSERT_EQ(splitter.getGroupCount(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            const auto& group = splitter.getGroup(i);
+            ASSERT_EQ(group.size(), expected[i].size());
+            for (std::size_t j = 0; j < group.size(); ++j) {
+                EXPECT_TRUE(group[j].IsSame(expected[i][j]));
+            }
+        }
+    }
+
+    // An L-shaped prism with a single cylinder on its lower step
+    EXPECT_TRUE(refined.isValid());
+    EXPECT_EQ(refined.countSubElements("Solid"), 1);
+    EXPECT_EQ(refined.countSubElements("Face"), 10);
+    EXPECT_EQ(refined.countSubElements("Edge"), 21);
+    EXPECT_EQ(refined.countSubElements("Vertex"), 14);
+    EXPECT_NEAR(
+        PartTestHelpers::getVolume(refine.Shape()),
+        6.0 + std::numbers::pi * 0.25 * 0.25,
+        1e-6
+    );
+}
@@ -8,6 +8,11 @@
 #include "PartTestHelpers.h"
 
 #include <BRepBuilderAPI_MakeShape.hxx>
+#include <BRep_Tool.hxx>
+#include <Precision.hxx>
+#include <TopoDS.hxx>
+
+#include <limits>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
 
@@ -928,4 +933,103 @@ TEST_F(WireJoinerTest, IsDeleted)
     EXPECT_TRUE(wjIsDeleted.IsDeleted(edge5));
 }
 
+TEST_F(WireJoinerTest, splitEdgesOfGrid)
+{
+    // Arrange
+
+    // A grid of crossing lines, enough to check the intersections in parallel
+    const int count {12};
+    std::vector<TopoShape> edges;
+    for (int i = 0; i < count; ++i) {
+        edges.emplace_back(
+            BRepBuilderAPI_MakeEdge(gp_Pnt(-0.5, i, 0.0), gp_Pnt(count - 0.5, i, 0.0)).Edge(),
+            i + 1
+        );
+        edges.emplace_back(
+            BRepBuilderAPI_MakeEdge(gp_Pnt(i, -0.5, 0.0), gp_Pnt(i, count - 0.5, 0.0)).Edge(),
+            count + i + 1
+        );
+    }
+    auto wjGrid {WireJoiner()};
+    auto wireGrid {TopoShape(1)};
+
+    // Act
+    wjGrid.addShape(edges);
+    wjGrid.getResultWires(wireGrid);
+
+    // Assert
+
+    // Every line is split at each crossing. Only the pieces between two crossings take part in
+    // the closed wires, the dangling ends are left out.
+    EXPECT_EQ(wireGrid.getSubTopoShapes(TopAbs_EDGE).size(), 2 * count * (count - 1));
+    auto wires = wireGrid.getSubTopoShapes(TopAbs_WIRE);
+    EXPECT_GE(wires.size(), (count - 1) * (count - 1));
+    for (const auto& wire : wires) {
+        EXPECT_TRUE(BRep_Tool::IsClosed(wire.getShape()));
+    }
+}
+
+TEST_F(WireJoinerTest, splitEdgesSerialMatchesParallel)
+{
+    // Arrange
+
+    // The grid from above with a diagonal line that crosses the other lines between their
+    // crossings
+    const int count {12};
+    std::vector<TopoShape> edges;
+    for (int i = 0; i < count; ++i) {
+        edges.emplace_back(
+            BRepBuilderAPI_MakeEdge(gp_Pnt(-0.5, i, 0.0), gp_Pnt(count - 0.5, i, 0.0)).Edge(),
+            i + 1
+        );
+        edges.emplace_back(
+            BRepBuilderAPI_MakeEdge(gp_Pnt(i, -0.5, 0.0), gp_Pnt(i, count - 0.5, 0.0)).Edge(),
+            count + i + 1
+        );
+    }
+    edges.emplace_back(
+        BRepBuilderAPI_MakeEdge(gp_Pnt(-0.75, -0.25, 0.0), gp_Pnt(count - 1.25, count - 0.75, 0.0))
+            .Edge(),
+        2 * count + 1
+    );
+
+    auto joinWires = [&edges](std::size_t threshold) {
+        auto wj {WireJoiner()};
+        wj.setParallelThreshold(threshold);
+        wj.addShape(edges);
+        auto result {TopoShape(1)};
+        wj.getResultWires(result);
+        return result;
+    };
+
+    // Act
+    auto serial = joinWires(std::numeric_limits<std::size_t>::max());
+    auto parallel = joinWires(0);
+
+    // Assert
+    auto serialWires = serial.getSubTopoShapes(TopAbs_WIRE);
+    auto parallelWires = parallel.getSubTopoShapes(TopAbs_WIRE);
+    ASSERT_GE(serialWires.size(), (count - 1) * (count - 1));
+    ASSERT_EQ(parallelWires.size(), serialWires.size());
+    for (std::size_t i = 0; i < serialWires.size(); ++i) {
+        auto serialVertexes = serialWires[i].getSubTopoShapes(TopAbs_VERTEX);
+        auto parallelVertexes = parallelWires[i].getSubTopoShapes(TopAbs_VERTEX);
+        ASSERT_EQ(parallelVertexes.size(), serialVertexes.size());
+        for (std::size_t j = 0; j < serialVertexes.size(); ++j) {
+            gp_Pnt serialPoint = BRep_Tool::Pnt(TopoDS::Vertex(serialVertexes[j].getShape()));
+            gp_Pnt parallelPoint = BRep_Tool::Pnt(TopoDS::Vertex(parallelVertexes[j].getShape()));
+            EXPECT_LT(serialPoint.Distance(parallelPoint), Precision::Confusion());
+        }
+    }
+    EXPECT_EQ(
+        serial.getSubTopoShapes(TopAbs_EDGE).size(),
+        parallel.getSubTopoShapes(TopAbs_EDGE).size()
+    );
+    EXPECT_EQ(
+        serial.getSubTopoShapes(TopAbs_VERTEX).size(),
+        parallel.getSubTopoShapes(TopAbs_VERTEX).size()
+    );
+    EXPECT_EQ(serial.getElementMap(), parallel.getElementMap());
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
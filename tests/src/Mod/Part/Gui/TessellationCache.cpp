@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <src/App/InitApplication.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <gp_Trsf.hxx>
+
+#include <Mod/Part/Gui/TessellationCache.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        auto& cache = PartGui::TessellationCache::instance();
+        _maxSize = cache.getMaxSize();
+        cache.clear();
+    }
+
+    void TearDown() override
+    {
+        auto& cache = PartGui::TessellationCache::instance();
+        cache.clear();
+        cache.setMaxSize(_maxSize);
+    }
+
+    static std::vector<TopoDS_Face> getFaces(const TopoDS_Shape& shape)
+    {
+        std::vector<TopoDS_Face> faces;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            faces.push_back(TopoDS::Face(xp.Current()));
+        }
+        return faces;
+    }
+
+    static std::vector<std::string> getKeys(const TopoDS_Shape& shape, double angle)
+    {
+        std::vector<std::string> keys;
+        for (const auto& face : getFaces(shape)) {
+            keys.push_back(PartGui::TessellationCache::computeKey(face, angle, false));
+        }
+        return keys;
+    }
+
+    // A mesh with the given number of nodes, all meshes of the same size use the same memory
+    static std::shared_ptr<PartGui::FaceTessellation> makeMesh(double deflection, int numNodes)
+    {
+        auto mesh = std::make_shared<PartGui::FaceTessellation>();
+        mesh->deflection = deflection;
+        mesh->nodes.resize(numNodes);
+        return mesh;
+    }
+
+private:
+    std::size_t _maxSize = 0;
+};
+
+TEST_F(TessellationCacheTest, computeKeyDependsOnGeometry)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    TopoDS_Shape same = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    TopoDS_Shape other = BRepPrimAPI_MakeBox(1.0, 2.0, 4.0).Shape();
+
+    // Act
+    auto keys = getKeys(box, 0.5);
+    auto sameKeys = getKeys(same, 0.5);
+    auto otherKeys = getKeys(other, 0.5);
+
+    // Assert
+    ASSERT_EQ(keys.size(), 6);
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        EXPECT_FALSE(keys[i].empty());
+        // the key is a digest of the geometry, not of the identity of the face
+        EXPECT_EQ(keys[i], sameKeys[i]);
+        for (std::size_t j = i + 1; j < keys.size(); j++) {
+            EXPECT_NE(keys[i], keys[j]);
+        }
+    }
+    // only the bottom face of the longer box is unchanged, the others differ in their
+    // geometry or at least in one of their edges
+    auto unchanged = std::count_if(keys.begin(), keys.end(), [&otherKeys](const auto& key) {
+        return std::find(otherKeys.begin(), otherKeys.end(), key) != otherKeys.end();
+    });
+    EXPECT_EQ(unchanged, 1);
+}
+
+TEST_F(TessellationCacheTest, computeKeyIgnoresLocationAndOrientation)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    TopoDS_Shape moved = box.Moved(TopLoc_Location(trsf));
+    TopoDS_Shape reversed = box.Reversed();
+
+    // Act
+    auto keys = getKeys(box, 0.5);
+    auto movedKeys = getKeys(moved, 0.5);
+    auto reversedKeys = getKeys(reversed, 0.5);
+
+    // Assert
+    EXPECT_EQ(keys, movedKeys);
+    EXPECT_EQ(keys, reversedKeys);
+}
+
+TEST_F(TessellationCacheTest, computeKeyDependsOnParameters)
+{
+    // Arrange
+    TopoDS_Face face = getFaces(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape()).front();
+
+    // Act
+    auto key = PartGui::TessellationCache::computeKey(face, 0.5, false);
+    auto otherAngle = PartGui::TessellationCache::computeKey(face, 0.25, false);
+    auto otherNormals = PartGui::TessellationCache::computeKey(face, 0.5, true);
+
+    // Assert
+    EXPECT_NE(key, otherAngle);
+    EXPECT_NE(key, otherNormals);
+}
+
+TEST_F(TessellationCacheTest, findHitsWithinDeflectionTolerance)
+{
+    // Arrange
+    auto& cache = PartGui::TessellationCache::instance();
+    cache.setMaxSize(1 << 20);
+    auto mesh = makeMesh(0.1, 10);
+
+    // Act
+    cache.insert("face", mesh);
+
+    // Assert
+    EXPECT_EQ(cache.count(), 1);
+    EXPECT_EQ(cache.getMemSize(), mesh->getMemSize());
+    EXPECT_EQ(cache.find("face", 0.1), mesh);
+    EXPECT_EQ(cache.find("face", 0.105), mesh);
+    EXPECT_FALSE(cache.find("face", 0.2));
+    EXPECT_FALSE(cache.find("other", 0.1));
+    EXPECT_FALSE(cache.find("", 0.1));
+}
+
+TEST_F(TessellationCacheTest, insertReplacesEntry)
+{
+    // Arrange
+    auto& cache = PartGui::TessellationCache::instance();
+    cache.setMaxSize(1 << 20);
+    auto first = makeMesh(0.1, 10);
+    auto second = makeMesh(0.1, 20);
+
+    // Act
+    cache.insert("face", first);
+    cache.insert("face", second);
+
+    // Assert
+    EXPECT_EQ(cache.count(), 1);
+    EXPECT_EQ(cache.getMemSize(), second->getMemSize());
+    EXPECT_EQ(cache.find("face", 0.1), second);
+}
+
+TEST_F(TessellationCacheTest, insertEvictsLeastRecentlyUsed)
+{
+    // Arrange
+    auto& cache = PartGui::TessellationCache::instance();
+    auto mesh = makeMesh(0.1, 10);
+    cache.setMaxSize(2 * mesh->getMemSize());
+
+    // Act
+    cache.insert("a", mesh);
+    cache.insert("b", makeMesh(0.1, 10));
+    // using "a" makes "b" the least recently used entry
+    ASSERT_TRUE(cache.find("a", 0.1));
+    cache.insert("c", makeMesh(0.1, 10));
+
+    // Assert
+    EXPECT_EQ(cache.count(), 2);
+    EXPECT_LE(cache.getMemSize(), cache.getMaxSize());
+    EXPECT_TRUE(cache.find("a", 0.1));
+    EXPECT_FALSE(cache.find("b", 0.1));
+    EXPECT_TRUE(cache.find("c", 0.1));
+}
+
+TEST_F(TessellationCacheTest, insertSkipsMeshLargerThanCache)
+{
+    // Arrange
+    auto& cache = PartGui::TessellationCache::instance();
+    auto small = makeMesh(0.1, 10);
+    cache.setMaxSize(small->getMemSize());
+
+    // Act
+    cache.insert("small", small);
+    cache.insert("large", makeMesh(0.1, 20));
+
+    // Assert
+    EXPECT_EQ(cache.count(), 1);
+    EXPECT_TRUE(cache.find("small", 0.1));
+    EXPECT_FALSE(cache.find("large", 0.1));
+}
+
+TEST_F(TessellationCacheTest, shrinkingEvictsEntries)
+{
+    // Arrange
+    auto& cache = PartGui::TessellationCache::instance();
+    cache.setMaxSize(1 << 20);
+    cache.insert("a", makeMesh(0.1, 10));
+    cache.insert("b", makeMesh(0.1, 10));
+
+    // Act
+    cache.setMaxSize(0);
+
+    // Assert
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_EQ(cache.count(), 0);
+    EXPECT_EQ(cache.getMemSize(), 0);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
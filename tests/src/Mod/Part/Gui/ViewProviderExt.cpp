@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+
+#include <src/App/InitApplication.h>
+
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+
+#include <Mod/Part/Gui/TessellationCache.h>
+#include <Mod/Part/Gui/ViewProviderExt.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class ViewProviderExtTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        auto& cache = PartGui::TessellationCache::instance();
+        _maxSize = cache.getMaxSize();
+        cache.setMaxSize(0);
+
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+        gp_Ax2 axis(gp_Pnt(5.0, 5.0, 5.0), gp_Dir(0.0, 0.0, 1.0));
+        TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(axis, 3.0, 10.0).Shape();
+        gp_Trsf trsf;
+        trsf.SetTranslation(gp_Vec(1.0, 2.0, 3.0));
+        _shape = BRepAlgoAPI_Fuse(box, cylinder).Shape().Moved(TopLoc_Location(trsf));
+    }
+
+    void TearDown() override
+    {
+        auto& cache = PartGui::TessellationCache::instance();
+        cache.clear();
+        cache.setMaxSize(_maxSize);
+    }
+
+    const TopoDS_Shape& getShape() const
+    {
+        return _shape;
+    }
+
+    // Like the background job, a copy of the topology is meshed so the shape itself is untouched
+    static TopoDS_Shape copyShape(const TopoDS_Shape& shape)
+    {
+        return BRepBuilderAPI_Copy(shape, Standard_False, Standard_False).Shape();
+    }
+
+    static std::shared_ptr<PartGui::ShapeTessellation> mesh(
+        const TopoDS_Shape& shape,
+        const std::atomic<bool>* canceled = nullptr
+    )
+    {
+        return PartGui::ViewProviderPartExt::computeCoinGeometry(shape, 0.5, 28.5, false, canceled);
+    }
+
+    static void expectSameGeometry(
+        const PartGui::ShapeTessellation& data,
+        const PartGui::ShapeTessellation& expected
+    )
+    {
+        ASSERT_EQ(data.points.size(), expected.points.size());
+        for (std::size_t i = 0; i < data.points.size(); i++) {
+            EXPECT_LT((data.points[i] - expected.points[i]).length(), 1e-5F);
+        }
+        ASSERT_EQ(data.normals.size(), expected.normals.size());
+        for (std::size_t i = 0; i < data.normals.size(); i++) {
+            EXPECT_LT((data.normals[i] - expected.normals[i]).length(), 1e-5F);
+        }
+        EXPECT_EQ(data.faceIndex, expected.faceIndex);
+        EXPECT_EQ(data.partIndex, expected.partIndex);
+        EXPECT_EQ(data.lineIndex, expected.lineIndex);
+        EXPECT_EQ(data.pointStart, expected.pointStart);
+    }
+
+private:
+    TopoDS_Shape _shape;
+    std::size_t _maxSize = 0;
+};
+
+TEST_F(ViewProviderExtTest, forcedUpdateMatchesSynchronousMeshing)
+{
+    // Arrange
+    auto expected = mesh(copyShape(getShape()));
+    ASSERT_TRUE(expected);
+    ASSERT_FALSE(expected->points.empty());
+
+    // Act
+
+    // A forced update cancels the running job and meshes the shape in the calling thread
+    std::atomic<bool> canceled {false};
+    TopoDS_Shape copy = copyShape(getShape());
+    auto job = std::async(std::launch::async, [&copy, &canceled]() {
+        return mesh(copy, &canceled);
+    });
+    canceled = true;
+    auto forced = mesh(getShape());
+    auto background = job.get();
+
+    // Assert
+    ASSERT_TRUE(forced);
+    EXPECT_TRUE(forced->error.empty());
+    expectSameGeometry(*forced, *expected);
+    // the job either finished before it noticed the cancellation or returned nothing
+    if (background) {
+        expectSameGeometry(*background, *expected);
+    }
+}
+
+TEST_F(ViewProviderExtTest, backgroundMeshingMatchesSynchronousMeshing)
+{
+    // Arrange
+    auto expected = mesh(copyShape(getShape()));
+    ASSERT_TRUE(expected);
+
+    // Act
+    std::atomic<bool> canceled {false};
+    TopoDS_Shape copy = copyShape(getShape());
+    auto job = std::async(std::launch::async, [&copy, &canceled]() {
+        return mesh(copy, &canceled);
+    });
+    auto background = job.get();
+
+    // Assert
+    ASSERT_TRUE(background);
+    expectSameGeometry(*background, *expected);
+}
+
+TEST_F(ViewProviderExtTest, forcedUpdateWithCachedFacesMatchesSynchronousMeshing)
+{
+    // Arrange
+    auto expected = mesh(copyShape(getShape()));
+    ASSERT_TRUE(expected);
+    auto& cache = PartGui::TessellationCache::instance();
+    cache.setMaxSize(1 << 24);
+
+    // Act
+
+    // the first run fills the cache and the forced update takes all faces from it
+    auto background = mesh(copyShape(getShape()));
+    std::size_t numCached = cache.count();
+    auto forced = mesh(getShape());
+
+    // Assert
+    ASSERT_TRUE(background);
+    ASSERT_TRUE(forced);
+    EXPECT_GT(numCached, 0);
+    EXPECT_EQ(cache.count(), numCached);
+    expectSameGeometry(*background, *expected);
+    expectSameGeometry(*forced, *expected);
+}
+
+TEST_F(ViewProviderExtTest, canceledMeshingReturnsNothing)
+{
+    // Arrange
+    std::atomic<bool> canceled {true};
+
+    // Act
+    auto data = mesh(copyShape(getShape()), &canceled);
+
+    // Assert
+    EXPECT_FALSE(data);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <map>
+#include <string>
+
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Part/App/Geometry.h>
+#include <Mod/PartDesign/App/Body.h>
+#include <Mod/PartDesign/App/FeatureLinearPattern.h>
+#include <Mod/PartDesign/App/FeaturePad.h>
+#include <Mod/PartDesign/App/PartDesignParameter.h>
+#include <Mod/Sketcher/App/SketchObject.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+class LinearPatternTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _threshold = PartDesign::PartDesignParameter::instance()->getPatternFuseTreeThreshold();
+        _doc = App::GetApplication().newDocument("LinearPattern_test", "testUser");
+        _body = _doc->addObject<PartDesign::Body>();
+        _sketch = _doc->addObject<Sketcher::SketchObject>("Sketch");
+        _body->addObject(_sketch);
+
+        _sketch->AttachmentSupport.setValue(_doc->getObject("XY_Plane"), "");
+        _sketch->MapMode.setValue("FlatFace");
+        Part::GeomCircle circle;
+        circle.setRadius(10.0);
+        _sketch->addGeometry(&circle, false);
+
+        _pad = _doc->addObject<PartDesign::Pad>("Pad");
+        _body->addObject(_pad);
+        _pad->Profile.setValue(_sketch, {""});
+        _pad->Length.setValue(10.0);
+    }
+
+    void TearDown() override
+    {
+        PartDesign::PartDesignParameter::instance()->setPatternFuseTreeThreshold(_threshold);
+        App::GetApplication().closeDocument(_doc->getName());
+    }
+
+    App::Document* getDocument() const
+    {
+        return _doc;
+    }
+
+    PartDesign::Body* getBody() const
+    {
+        return _body;
+    }
+
+    Sketcher::SketchObject* getSketch() const
+    {
+        return _sketch;
+    }
+
+    PartDesign::Pad* getPad() const
+    {
+        return _pad;
+    }
+
+    static double getVolume(const TopoDS_Shape& shape)
+    {
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(shape, props);
+        return props.Mass();
+    }
+
+    // Returns the center of the element of each mapped name
+    static std::map<std::string, Base::Vector3d> getMappedElements(const Part::TopoShape& shape)
+    {
+        std::map<std::string, Base::Vector3d> elements;
+        for (const auto& it : shape.getElementMap()) {
+            auto element = shape.getSubTopoShape(it.index.toString().c_str());
+            elements[it.name.toString()] = element.getBoundBox().GetCenter();
+        }
+        return elements;
+    }
+
+private:
+    App::Document* _doc = nullptr;
+    PartDesign::Body* _body = nullptr;
+    Sketcher::SketchObject* _sketch = nullptr;
+    PartDesign::Pad* _pad = nullptr;
+    long _threshold = 0;
+};
+
+TEST_F(LinearPatternTest, TestClusteredFuseMatchesSingleFuse)
+{
+    auto doc = getDocument();
+    auto param = PartDesign::PartDesignParameter::instance();
+
+    auto pattern = doc->addObject<PartDesign::LinearPattern>("LinearPattern");
+    getBody()->addObject(pattern);
+    pattern->TransformMode.setValue("Whole shape");
+    pattern->Direction.setValue(getSketch(), {"H_Axis"});
+    pattern->Mode.setValue("Spacing");
+    pattern->Offset.setValue(15.0);
+    pattern->Occurrences.setValue(12);
+
+    // single boolean of all instances
+    param->setPatternFuseTreeThreshold(0);
+    doc->recompute();
+    ASSERT_TRUE(pattern->isValid());
+    auto single = pattern->Shape.getShape();
+
+    // clustered boolean
+    param->setPatternFuseTreeThreshold(4);
+    pattern->touch();
+    doc->recompute();
+    ASSERT_TRUE(pattern->isValid());
+    auto clustered = pattern->Shape.getShape();
+
+    double volume = getVolume(single.getShape());
+    EXPECT_NEAR(getVolume(clustered.getShape()), volume, 1e-6 * volume);
+    EXPECT_EQ(clustered.countSubShapes(TopAbs_SOLID), 1UL);
+    EXPECT_EQ(clustered.countSubShapes(TopAbs_FACE), single.countSubShapes(TopAbs_FACE));
+    EXPECT_EQ(clustered.getElementMapSize(), single.getElementMapSize());
+
+    // the same names map to the same elements, whatever their indices are
+    auto singleElements = getMappedElements(single);
+    auto clusteredElements = getMappedElements(clustered);
+    ASSERT_EQ(clusteredElements.size(), singleElements.size());
+    for (const auto& [name, center] : singleElements) {
+        auto it = clusteredElements.find(name);
+        ASSERT_NE(it, clusteredElements.end()) << name;
+        EXPECT_LT(Base::Distance(it->second, center), 1e-6) << name;
+    }
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
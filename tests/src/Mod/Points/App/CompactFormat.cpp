@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+#include <Mod/Points/App/CompactFormat.h>
+#include <Mod/Points/App/Properties.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using Layout = Points::CompactFormat::Layout;
+
+class CompactFormatTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // more than one chunk
+        for (int i = 0; i < 100000; i++) {
+            points.emplace_back(float(i) * 0.01F, std::sin(float(i) * 0.1F), float(i % 7) - 5.0F);
+        }
+        points[5].x = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(CompactFormatTest, TestPoints)
+{
+    std::stringstream str;
+    Points::CompactFormat::writePoints(str, points, Layout::Compact);
+    std::vector<Base::Vector3f> result;
+    Points::CompactFormat::readPoints(str, result, true);
+
+    ASSERT_EQ(result.size(), points.size());
+    EXPECT_TRUE(std::isnan(result[5].x));
+    for (std::size_t i = 6; i < points.size(); i++) {
+        EXPECT_EQ(result[i], points[i]);
+    }
+}
+
+TEST_F(CompactFormatTest, TestQuantizedPoints)
+{
+    std::stringstream str;
+    Points::CompactFormat::writePoints(str, points, Layout::Quantized);
+    std::vector<Base::Vector3f> result;
+    Points::CompactFormat::readPoints(str, result, true);
+
+    ASSERT_EQ(result.size(), points.size());
+    EXPECT_TRUE(std::isnan(result[5].x));
+    for (std::size_t i = 6; i < points.size(); i++) {
+        EXPECT_NEAR(result[i].x, points[i].x, 0.01F);
+        EXPECT_NEAR(result[i].y, points[i].y, 1e-4F);
+        EXPECT_NEAR(result[i].z, points[i].z, 1e-4F);
+    }
+}
+
+TEST_F(CompactFormatTest, TestLegacyFormat)
+{
+    std::stringstream str;
+    Base::OutputStream out(str);
+    out << uint32_t(2) << 1.0F << 2.0F << 3.0F << 4.0F << 5.0F << 6.0F;
+
+    std::vector<Base::Vector3f> result;
+    Points::CompactFormat::readPoints(str, result, false);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0], Base::Vector3f(1, 2, 3));
+    EXPECT_EQ(result[1], Base::Vector3f(4, 5, 6));
+}
+
+TEST_F(CompactFormatTest, TestWriteLegacyFormat)
+{
+    std::vector<Base::Vector3f> values {Base::Vector3f(1, 2, 3), Base::Vector3f(4, 5, 6)};
+    std::stringstream str;
+    Points::CompactFormat::writePoints(str, values, Layout::Legacy);
+
+    std::stringstream expected;
+    Base::OutputStream out(expected);
+    out << uint32_t(2) << 1.0F << 2.0F << 3.0F << 4.0F << 5.0F << 6.0F;
+    EXPECT_EQ(str.str(), expected.str());
+
+    std::vector<Points::CurvatureInfo> curvatures(2);
+    std::stringstream str2;
+    Points::CompactFormat::writeCurvatures(str2, curvatures, Layout::Legacy);
+    EXPECT_EQ(str2.str().size(), sizeof(uint32_t) + 2 * 8 * sizeof(float));
+}
+
+TEST_F(CompactFormatTest, TestLayoutMismatch)
+{
+    std::stringstream str;
+    Points::CompactFormat::writePoints(str, points, Layout::Legacy);
+
+    std::vector<Base::Vector3f> result;
+    EXPECT_THROW(Points::CompactFormat::readPoints(str, result, true), Base::BadFormatError);
+}
+
+TEST_F(CompactFormatTest, TestQuantizedNormals)
+{
+    std::vector<Base::Vector3f> normals;
+    for (int i = 0; i < 1000; i++) {
+        Base::Vector3f normal(
+            std::sin(float(i)),
+            std::cos(float(i) * 0.7F),
+            std::sin(float(i) * 0.3F) - 0.5F
+        );
+        normals.push_back(normal.Normalize());
+    }
+
+    std::stringstream str;
+    Points::CompactFormat::writeNormals(str, normals, Layout::Quantized);
+    std::vector<Base::Vector3f> result;
+    Points::CompactFormat::readNormals(str, result, true);
+
+    ASSERT_EQ(result.size(), normals.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_LT((result[i] - normals[i]).Length(), 1e-3F);
+    }
+}
+
+TEST_F(CompactFormatTest, TestGreyValuesAndCurvatures)
+{
+    std::vector<float> values {0.0F, 0.5F, 1.0F, 0.25F};
+    std::stringstream str;
+    Points::CompactFormat::writeGreyValues(str, values, Layout::Quantized);
+    std::vector<float> result;
+    Points::CompactFormat::readGreyValues(str, result, true);
+    ASSERT_EQ(result.size(), values.size());
+    for (std::size_t i = 0; i < values.size(); i++) {
+        EXPECT_NEAR(result[i], values[i], 0.005F);
+    }
+
+    std::vector<Points::CurvatureInfo> curvatures(3);
+    curvatures[2].fMinCurvature = 3.0F;
+    curvatures[1].cMinCurvDir.z = 7.0F;
+    std::stringstream str2;
+    Points::CompactFormat::writeCurvatures(str2, curvatures, Layout::Quantized);
+    std::vector<Points::CurvatureInfo> result2;
+    Points::CompactFormat::readCurvatures(str2, result2, true);
+    ASSERT_EQ(result2.size(), curvatures.size());
+    EXPECT_EQ(result2[2].fMinCurvature, 3.0F);
+    EXPECT_EQ(result2[1].cMinCurvDir.z, 7.0F);
+}
+
+TEST_F(CompactFormatTest, TestTruncatedData)
+{
+    std::stringstream str;
+    Points::CompactFormat::writePoints(str, points, Layout::Compact);
+    std::string data = str.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+
+    std::vector<Base::Vector3f> result;
+    EXPECT_THROW(Points::CompactFormat::readPoints(truncated, result, true), Base::BadFormatError);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
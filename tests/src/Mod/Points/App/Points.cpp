@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
@@ -140,6 +143,24 @@ TEST_F(PointsTest, TestASCII)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestASCIIComments)
+{
+    std::string name = getFileName() + ".asc";
+    {
+        std::ofstream str(name, std::ios::out | std::ios::binary);
+        str << "# comment\n1 2 3\n\n4 5 6 7\n  -1.5e1 +2 .5\r\n";
+    }
+
+    Points::AscReader reader;
+    reader.read(name);
+
+    const Points::PointKernel& kernel = reader.getPoints();
+    ASSERT_EQ(kernel.size(), 2);
+    EXPECT_EQ(kernel.getPoint(0), Base::Vector3d(1, 2, 3));
+    EXPECT_EQ(kernel.getPoint(1), Base::Vector3d(-15, 2, 0.5));
+    Base::FileInfo(name).deleteFile();
+}
+
 TEST_F(PointsTest, TestPlainPLY)
 {
     std::string name = getFileName();
@@ -179,6 +200,49 @@ TEST_F(PointsTest, TestPLYWithProperties)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestTruncatedASCIIPLY)
+{
+    std::string name = getFileName();
+    std::ofstream str(name);
+    str << "ply\n"
+        << "format ascii 1.0\n"
+        << "element vertex 3\n"
+        << "property float x\n"
+        << "property float y\n"
+        << "property float z\n"
+        << "end_header\n"
+        << "1 2 3\n"
+        << "4 5\n";
+    str.close();
+
+    Points::PlyReader reader;
+    reader.read(name);
+
+    const Points::PointKernel& points = reader.getPoints();
+    ASSERT_EQ(points.size(), 3);
+    EXPECT_EQ(points.getPoint(0), Base::Vector3d(1, 2, 3));
+    EXPECT_EQ(points.getPoint(1), Base::Vector3d(4, 5, 0));
+    EXPECT_EQ(points.getPoint(2), Base::Vector3d(0, 0, 0));
+}
+
+TEST_F(PointsTest, TestUnknownPLYType)
+{
+    std::string name = getFileName();
+    std::ofstream str(name, std::ios::binary);
+    str << "ply\n"
+        << "format binary_little_endian 1.0\n"
+        << "element vertex 1\n"
+        << "property float x\n"
+        << "property float y\n"
+        << "property float128 z\n"
+        << "end_header\n";
+    str.write(std::string(24, '\0').data(), 24);
+    str.close();
+
+    Points::PlyReader reader;
+    EXPECT_THROW(reader.read(name), Base::BadFormatError);
+}
+
 TEST_F(PointsTest, TestPlainPCD)
 {
     std::string name = getFileName();
@@ -240,4 +304,204 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestChunkedASCII)
+{
+    std::string name = getFileName() + ".asc";
+    Points::AscWriter writer(getKernel());
+    writer.write(name);
+
+    auto reader = Points::ChunkedReader::create(name);
+    ASSERT_TRUE(reader);
+    reader->open(name);
+
+    std::vector<Base::Vector3f> chunk;
+    std::vector<std::size_t> sizes;
+    while (reader->next(chunk, 3)) {
+        sizes.push_back(chunk.size());
+    }
+
+    EXPECT_EQ(sizes, std::vector<std::size_t>({3, 3, 2}));
+    EXPECT_EQ(chunk.size(), 0);
+    Base::FileInfo(name).deleteFile();
+}
+
+TEST_F(PointsTest, TestChunkedPLY)
+{
+    std::string name = getFileName() + ".ply";
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    auto reader = Points::ChunkedReader::create(name);
+    ASSERT_TRUE(reader);
+    reader->open(name);
+
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> chunk;
+    while (reader->next(chunk, 3)) {
+        points.insert(points.end(), chunk.begin(), chunk.end());
+    }
+
+    ASSERT_EQ(points.size(), 8);
+    EXPECT_EQ(points[0], Base::Vector3f(0, 0, 0));
+    EXPECT_EQ(points[5], Base::Vector3f(1, 0, 1));
+    EXPECT_EQ(points[7], Base::Vector3f(1, 1, 1));
+    Base::FileInfo(name).deleteFile();
+}
+
+TEST_F(PointsTest, TestChunkedUnsupported)
+{
+    EXPECT_FALSE(Points::ChunkedReader::create("points.xyz"));
+}
+namespace
+{
+// A plane grid of n x n points with the given offset in x direction
+std::vector<Base::Vector3d> makeGrid(int n, double offset)
+{
+    std::vector<Base::Vector3d> points;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            points.emplace_back(offset + 0.1 * i, 0.1 * j, 0.0);
+        }
+    }
+    return points;
+}
+
+// A scan whose intensity of each point is the x coordinate of the point
+Points::ScanPoints makeScan(int n, double offset)
+{
+    Points::ScanPoints scan;
+    scan.points = makeGrid(n, offset);
+    for (const auto& it : scan.points) {
+        scan.intensity.push_back(float(it.x));
+    }
+    return scan;
+}
+}  // namespace
+
+TEST(VoxelSubsamplerTest, TestNoBudget)
+{
+    Points::VoxelSubsampler sampler(0);
+    auto points = makeGrid(10, 0.0);
+
+    EXPECT_FALSE(sampler.isExceeded(points.size()));
+    EXPECT_TRUE(sampler.insert(points[0]));
+    EXPECT_TRUE(sampler.insert(points[0]));
+
+    auto keep = sampler.rebuild(points);
+    EXPECT_EQ(std::count(keep.begin(), keep.end(), true), 100);
+    EXPECT_EQ(sampler.getVoxelSize(), 0.0);
+}
+
+TEST(VoxelSubsamplerTest, TestInsert)
+{
+    Points::VoxelSubsampler sampler(10);
+    sampler.setVoxelSize(1.0);
+
+    EXPECT_TRUE(sampler.insert(Base::Vector3d(0.1, 0.1, 0.1)));
+    EXPECT_FALSE(sampler.insert(Base::Vector3d(0.9, 0.2, 0.3)));
+    EXPECT_TRUE(sampler.insert(Base::Vector3d(1.5, 0.1, 0.1)));
+    EXPECT_TRUE(sampler.insert(Base::Vector3d(-0.5, 0.1, 0.1)));
+}
+
+TEST(VoxelSubsamplerTest, TestRebuildWithinBudget)
+{
+    Points::VoxelSubsampler sampler(50);
+    auto points = makeGrid(10, 0.0);
+
+    auto keep = sampler.rebuild(points);
+    ASSERT_EQ(keep.size(), points.size());
+    EXPECT_TRUE(keep.front());
+    EXPECT_LE(std::count(keep.begin(), keep.end(), true), 50);
+    EXPECT_GT(std::count(keep.begin(), keep.end(), true), 0);
+    EXPECT_GT(sampler.getVoxelSize(), 0.0);
+}
+
+TEST(VoxelSubsamplerTest, TestCoarsen)
+{
+    Points::VoxelSubsampler sampler(50);
+    auto points = makeGrid(10, 0.0);
+
+    auto keep = sampler.rebuild(points);
+    double voxelSize = sampler.getVoxelSize();
+    auto coarse = sampler.coarsen(points);
+
+    EXPECT_GT(sampler.getVoxelSize(), voxelSize);
+    EXPECT_TRUE(coarse.front());
+    EXPECT_LE(
+        std::count(coarse.begin(), coarse.end(), true),
+        std::count(keep.begin(), keep.end(), true)
+    );
+}
+
+TEST(ScanMergerTest, TestMergeInScanOrder)
+{
+    Points::ScanMerger merger(0);
+    Points::ScanPoints merged;
+    std::vector<Points::ScanPoints> scans {makeScan(3, 0.0), makeScan(2, 10.0), makeScan(4, 20.0)};
+    for (const auto& it : scans) {
+        merger.merge(merged, it);
+    }
+
+    ASSERT_EQ(merged.points.size(), 29);
+    ASSERT_EQ(merged.intensity.size(), 29);
+    std::size_t index = 0;
+    for (const auto& scan : scans) {
+        for (const auto& it : scan.points) {
+            EXPECT_EQ(merged.points[index++], it);
+        }
+    }
+    EXPECT_TRUE(merged.error.empty());
+}
+
+TEST(ScanMergerTest, TestMergeWithinBudget)
+{
+    Points::ScanMerger merger(100);
+    Points::ScanPoints merged;
+    std::vector<Points::ScanPoints> scans {
+        makeScan(10, 0.0),
+        makeScan(10, 10.0),
+        makeScan(10, 20.0)
+    };
+    for (const auto& it : scans) {
+        merger.merge(merged, it);
+    }
+
+    ASSERT_LE(merged.points.size(), 100);
+    ASSERT_EQ(merged.intensity.size(), merged.points.size());
+    EXPECT_GT(merged.voxelSize, 0.0);
+    EXPECT_EQ(merged.points.front(), scans.front().points.front());
+    // the attributes stay with their points and the points stay in scan order
+    for (std::size_t i = 0; i < merged.points.size(); i++) {
+        EXPECT_FLOAT_EQ(merged.intensity[i], float(merged.points[i].x));
+        if (i > 0) {
+            EXPECT_LE(merged.points[i - 1].x, merged.points[i].x);
+        }
+    }
+    // every scan keeps some of its points
+    for (double offset : {0.0, 10.0, 20.0}) {
+        auto inScan = [offset](const Base::Vector3d& pnt) {
+            return pnt.x >= offset && pnt.x < offset + 1.0;
+        };
+        EXPECT_TRUE(std::any_of(merged.points.begin(), merged.points.end(), inScan));
+    }
+}
+
+TEST(ScanMergerTest, TestMergeError)
+{
+    Points::ScanMerger merger(0);
+    Points::ScanPoints merged;
+    Points::ScanPoints failed;
+    failed.error = "Missing channels xyz";
+
+    merger.merge(merged, makeScan(2, 0.0));
+    merger.merge(merged, failed);
+    merger.merge(merged, makeScan(2, 10.0));
+
+    EXPECT_EQ(merged.error, "Missing channels xyz");
+    EXPECT_EQ(merged.points.size(), 4);
+}
+
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsKdTree.h>
+#include <Mod/Points/App/PointsNormals.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+std::vector<Base::Vector3f> makeRandomCloud(std::size_t count)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-10.0F, 10.0F);
+    std::vector<Base::Vector3f> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        points.emplace_back(dist(gen), dist(gen), dist(gen));
+    }
+    return points;
+}
+
+std::vector<Base::Vector3f> makeSphere(float radius, int count)
+{
+    // evenly distributed points on a Fibonacci spiral
+    std::vector<Base::Vector3f> points;
+    float golden = std::numbers::pi_v<float> * (3.0F - std::sqrt(5.0F));
+    for (int i = 0; i < count; i++) {
+        float z = 1.0F - 2.0F * (float(i) + 0.5F) / float(count);
+        float r = std::sqrt(1.0F - z * z);
+        float phi = golden * float(i);
+        points.emplace_back(radius * r * std::cos(phi), radius * r * std::sin(phi), radius * z);
+    }
+    return points;
+}
+}  // namespace
+
+TEST(PointsKdTreeTest, TestNearestMatchesBruteForce)
+{
+    auto points = makeRandomCloud(5000);
+    points[17].Set(NAN, NAN, NAN);
+
+    Points::PointsKdTree tree(8);
+    tree.build(points);
+    EXPECT_EQ(tree.size(), points.size() - 1);
+
+    auto queries = makeRandomCloud(50);
+    for (const auto& pnt : queries) {
+        std::vector<Points::PointsKdTree::Neighbour> found;
+        tree.nearest(pnt, 12, found);
+        ASSERT_EQ(found.size(), 12);
+
+        std::vector<float> dist;
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (i != 17) {
+                dist.push_back(Base::DistanceP2(pnt, points[i]));
+            }
+        }
+        std::sort(dist.begin(), dist.end());
+        for (std::size_t i = 0; i < found.size(); i++) {
+            EXPECT_FLOAT_EQ(found[i].first, dist[i]);
+            EXPECT_FLOAT_EQ(Base::DistanceP2(pnt, points[found[i].second]), found[i].first);
+            EXPECT_NE(found[i].second, 17);
+        }
+    }
+}
+
+TEST(PointsNormalsTest, TestPlane)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            points.emplace_back(float(i), float(j), 0.5F * float(i));
+        }
+    }
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> curvatures;
+    Points::NormalEstimation estimation(kernel);
+    estimation.perform(normals, &curvatures);
+    ASSERT_EQ(normals.size(), points.size());
+
+    Base::Vector3f expected(-0.5F, 0.0F, 1.0F);
+    expected.Normalize();
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_NEAR(normals[i] * expected, 1.0F, 1e-4F);
+        EXPECT_NEAR(curvatures[i], 0.0F, 1e-4F);
+    }
+}
+
+TEST(PointsNormalsTest, TestSphereOrientation)
+{
+    auto points = makeSphere(5.0F, 3000);
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+
+    std::vector<Base::Vector3f> normals;
+    Points::NormalEstimation estimation(kernel);
+    estimation.setKSearch(12);
+    estimation.perform(normals);
+
+    // all normals point outwards because the highest point is oriented upwards
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        Base::Vector3f dir = points[i];
+        dir.Normalize();
+        EXPECT_GT(normals[i] * dir, 0.95F);
+    }
+
+    estimation.setOrientation(Points::NormalEstimation::Orientation::Viewpoint);
+    estimation.setViewpoint(Base::Vector3f());
+    estimation.perform(normals);
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_LT(normals[i] * points[i], 0.0F);
+    }
+}
+
+TEST(PointsNormalsTest, TestRegionGrowing)
+{
+    // two perpendicular planes meeting at x = 0
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            points.emplace_back(float(i + 1), float(j), 0.0F);
+            points.emplace_back(0.0F, float(j), float(i + 1));
+        }
+    }
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> curvatures;
+    Points::NormalEstimation estimation(kernel);
+    estimation.perform(normals, &curvatures);
+
+    std::vector<std::vector<unsigned long>> clusters;
+    Points::RegionGrowing segm(kernel, normals, curvatures);
+    segm.setSmoothnessAngle(5.0F * std::numbers::pi_v<float> / 180.0F);
+    segm.setMinClusterSize(50);
+    segm.perform(clusters);
+    ASSERT_EQ(clusters.size(), 2);
+
+    std::size_t total = 0;
+    for (const auto& cluster : clusters) {
+        // each region lies on one plane
+        bool onFloor = points[cluster.front()].z == 0.0F;
+        for (auto index : cluster) {
+            EXPECT_EQ(points[index].z == 0.0F, onFloor);
+        }
+        total += cluster.size();
+    }
+    // only the points at the edge don't belong to a region
+    EXPECT_GT(total, points.size() * 9 / 10);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
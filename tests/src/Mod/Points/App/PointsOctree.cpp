@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <Mod/Points/App/PointsOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                for (int k = 0; k < 20; k++) {
+                    points.emplace_back(float(i), float(j), float(k));
+                }
+            }
+        }
+        octree.build(points);
+    }
+
+    std::vector<Base::Vector3f> points;
+    Points::PointsOctree octree {64, 8};
+};
+
+TEST_F(PointsOctreeTest, TestBuild)
+{
+    EXPECT_EQ(octree.size(), points.size());
+    EXPECT_GT(octree.getNodes().size(), 1);
+
+    const auto& indices = octree.getIndices();
+    std::set<uint32_t> unique(indices.begin(), indices.end());
+    EXPECT_EQ(unique.size(), points.size());
+
+    for (const auto& node : octree.getNodes()) {
+        for (std::size_t i = node.first; i < node.first + node.count; i++) {
+            EXPECT_TRUE(node.box.IsInBox(points[indices[i]]));
+        }
+    }
+}
+
+TEST_F(PointsOctreeTest, TestSelect)
+{
+    Base::BoundBox3f region(2.5F, 2.5F, 2.5F, 7.5F, 12.5F, 7.5F);
+    auto cull = [&region](const Base::BoundBox3f& box) {
+        if (!box.Intersect(region)) {
+            return Points::PointsOctree::Visibility::Outside;
+        }
+        return Points::PointsOctree::Visibility::Partial;
+    };
+    auto test = [&region](const Base::Vector3f& pnt) {
+        return region.IsInBox(pnt);
+    };
+
+    std::vector<unsigned long> result;
+    octree.select(points, cull, test, result);
+
+    std::vector<unsigned long> expected;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (region.IsInBox(points[i])) {
+            expected.push_back(i);
+        }
+    }
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(PointsOctreeTest, TestLevelOfDetail)
+{
+    std::vector<uint32_t> order = octree.progressiveOrder();
+    ASSERT_EQ(order.size(), points.size());
+    std::set<uint32_t> unique(order.begin(), order.end());
+    EXPECT_EQ(unique.size(), points.size());
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
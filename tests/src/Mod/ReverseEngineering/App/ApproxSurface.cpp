@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+
+#include <Mod/ReverseEngineering/App/ApproxSurface.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Samples the plane z = 0.3x - 0.2y + 1 on a grid whose spacing is given by 'spacing'
+TColgp_Array1OfPnt samplePlane(int num, const std::function<double(double)>& spacing)
+{
+    TColgp_Array1OfPnt points(1, num * num);
+    int index = 1;
+    for (int i = 0; i < num; i++) {
+        for (int j = 0; j < num; j++) {
+            double x = 10.0 * spacing(double(i) / double(num - 1));
+            double y = 10.0 * spacing(double(j) / double(num - 1));
+            points.SetValue(index++, gp_Pnt(x, y, 0.3 * x - 0.2 * y + 1.0));
+        }
+    }
+
+    return points;
+}
+
+double maxDeviation(const Handle(Geom_BSplineSurface) & surface, const TColgp_Array1OfPnt& points)
+{
+    double maxDist = 0.0;
+    for (int i = points.Lower(); i <= points.Upper(); i++) {
+        GeomAPI_ProjectPointOnSurf proj(points(i), surface);
+        maxDist = std::max(maxDist, proj.LowerDistance());
+    }
+
+    return maxDist;
+}
+
+}  // namespace
+
+TEST(ApproxSurface, fitWithoutSmoothingReproducesPlane)
+{
+    TColgp_Array1OfPnt points = samplePlane(20, [](double t) { return t; });
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    Handle(Geom_BSplineSurface) surface = pc.CreateSurface(points, 0, false);
+    ASSERT_FALSE(surface.IsNull());
+    EXPECT_LT(maxDeviation(surface, points), 1e-6);
+}
+
+TEST(ApproxSurface, fitWithSmoothingReproducesPlane)
+{
+    TColgp_Array1OfPnt points = samplePlane(20, [](double t) { return t; });
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    pc.EnableSmoothing(true, 0.1);
+    Handle(Geom_BSplineSurface) surface = pc.CreateSurface(points, 0, false);
+    ASSERT_FALSE(surface.IsNull());
+    EXPECT_LT(maxDeviation(surface, points), 1e-6);
+}
+
+TEST(ApproxSurface, fitOfClusteredPointsReproducesPlane)
+{
+    // Nearly all points are crowded into one corner so that the control points of the
+    // opposite corner are only weakly determined and the normal equations are badly conditioned
+    TColgp_Array1OfPnt points = samplePlane(15, [](double t) { return std::pow(t, 4.0); });
+    Reen::BSplineParameterCorrection pc(4, 4, 6, 6);
+    Handle(Geom_BSplineSurface) surface = pc.CreateSurface(points, 0, false);
+    ASSERT_FALSE(surface.IsNull());
+    EXPECT_LT(maxDeviation(surface, points), 1e-6);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
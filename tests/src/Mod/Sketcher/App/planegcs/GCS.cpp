@@ -1,5 +1,11 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "Mod/Sketcher/App/planegcs/GCS.h"
@@ -13,6 +19,91 @@ public:
     }
 };
 
+namespace
+{
+
+// A staircase of unit steps from a fixed origin, alternately horizontal and vertical, as a
+// stand-in for large imported outlines. Every step carries a distance and a horizontal or
+// vertical constraint, so the sketch is fully constrained and the Jacobian is very sparse.
+class Staircase
+{
+public:
+    explicit Staircase(int steps)
+        : coords(2 * (steps + 1))
+        , points(steps + 1)
+    {
+        for (int i = 0; i <= steps; ++i) {
+            // start slightly off the solution
+            coords[2 * i] = expectedX(i) + (i > 0 ? 0.05 * std::sin(i) : 0.0);
+            coords[2 * i + 1] = expectedY(i) + (i > 0 ? 0.05 * std::cos(i) : 0.0);
+            points[i] = GCS::Point(&coords[2 * i], &coords[2 * i + 1]);
+        }
+    }
+
+    void addConstraints(GCS::System& system, GCS::VEC_pD& unknowns, int tagId = 1)
+    {
+        for (size_t i = 0; i + 1 < points.size(); ++i) {
+            system.addConstraintP2PDistance(points[i], points[i + 1], &length, tagId);
+            if (i % 2 == 0) {
+                system.addConstraintHorizontal(points[i], points[i + 1], tagId);
+            }
+            else {
+                system.addConstraintVertical(points[i], points[i + 1], tagId);
+            }
+        }
+        for (size_t i = 2; i < coords.size(); ++i) {
+            unknowns.push_back(&coords[i]);
+        }
+    }
+
+    void init(GCS::System& system, GCS::Algorithm alg)
+    {
+        GCS::VEC_pD unknowns;
+        addConstraints(system, unknowns);
+        system.declareUnknowns(unknowns);
+        system.initSolution(alg);
+    }
+
+    int solve(GCS::System& system, GCS::Algorithm alg)
+    {
+        int ret = system.solve(true, alg);
+        system.applySolution();
+        return ret;
+    }
+
+    GCS::Point& point(int i)
+    {
+        return points[i];
+    }
+
+    double maxDeviation() const
+    {
+        double deviation = 0.0;
+        for (int i = 0; i < int(points.size()); ++i) {
+            deviation = std::max(deviation, std::abs(coords[2 * i] - expectedX(i)));
+            deviation = std::max(deviation, std::abs(coords[2 * i + 1] - expectedY(i)));
+        }
+        return deviation;
+    }
+
+private:
+    static double expectedX(int i)
+    {
+        return (i + 1) / 2;
+    }
+
+    static double expectedY(int i)
+    {
+        return i / 2;
+    }
+
+    std::vector<double> coords;
+    std::vector<GCS::Point> points;
+    double length {1.0};
+};
+
+}  // namespace
+
 class GCSTest: public ::testing::Test
 {
 protected:
@@ -50,3 +141,117 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, sparseJacobianMatchesDense)  // NOLINT
+{
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto gaussStep : {GCS::FullPivLU, GCS::LeastNormLdlt}) {
+            // Arrange
+            GCS::System dense;
+            dense.sparseJacobiThreshold = std::numeric_limits<int>::max();
+            dense.dogLegGaussStep = gaussStep;
+            GCS::System sparse;
+            sparse.sparseJacobiThreshold = 0;
+            sparse.dogLegGaussStep = gaussStep;
+            Staircase denseSketch(40);
+            Staircase sparseSketch(40);
+
+            denseSketch.init(dense, alg);
+            sparseSketch.init(sparse, alg);
+
+            // Act
+            int denseResult = denseSketch.solve(dense, alg);
+            int sparseResult = sparseSketch.solve(sparse, alg);
+
+            // Assert
+            EXPECT_EQ(denseResult, GCS::Success);
+            EXPECT_EQ(sparseResult, GCS::Success);
+            EXPECT_LT(denseSketch.maxDeviation(), 1e-6);
+            EXPECT_LT(sparseSketch.maxDeviation(), 1e-6);
+        }
+    }
+}
+
+TEST_F(GCSTest, decoupledComponentsSolvedConcurrently)  // NOLINT
+{
+    // Arrange
+    // enough components and parameters to be solved concurrently
+    const int numComponents {20};
+    std::vector<std::unique_ptr<Staircase>> sketches;
+    GCS::VEC_pD unknowns;
+    for (int i = 0; i < numComponents; ++i) {
+        sketches.push_back(std::make_unique<Staircase>(10));
+        sketches.back()->addConstraints(*System(), unknowns, i + 1);
+    }
+    System()->declareUnknowns(unknowns);
+    System()->initSolution(GCS::DogLeg);
+
+    // Act
+    int result = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_EQ(System()->dofsNumber(), 0);
+    for (const auto& sketch : sketches) {
+        EXPECT_LT(sketch->maxDeviation(), 1e-6);
+    }
+}
+
+TEST_F(GCSTest, decoupledComponentsDiagnosedConcurrently)  // NOLINT
+{
+    // Arrange
+    // every component gets a redundant constraint of its own
+    const int numComponents {20};
+    std::vector<std::unique_ptr<Staircase>> sketches;
+    GCS::VEC_pD unknowns;
+    for (int i = 0; i < numComponents; ++i) {
+        sketches.push_back(std::make_unique<Staircase>(10));
+        sketches.back()->addConstraints(*System(), unknowns, i + 1);
+        System()->addConstraintHorizontal(
+            sketches.back()->point(0),
+            sketches.back()->point(1),
+            numComponents + i + 1
+        );
+    }
+    System()->declareUnknowns(unknowns);
+
+    // Act
+    System()->initSolution(GCS::DogLeg);
+
+    // Assert
+    EXPECT_EQ(System()->dofsNumber(), 0);
+    GCS::VEC_I conflicting, redundant;
+    System()->getConflicting(conflicting);
+    System()->getRedundant(redundant);
+    EXPECT_TRUE(conflicting.empty());
+    ASSERT_EQ(redundant.size(), size_t(numComponents));
+    for (int i = 0; i < numComponents; ++i) {
+        EXPECT_EQ(redundant[i], numComponents + i + 1);
+    }
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the solve time of large sketches
+TEST_F(GCSTest, DISABLED_benchmarkLargeSketch)  // NOLINT
+{
+    using ms = std::chrono::milliseconds;
+    for (int steps : {250, 1000}) {
+        for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+            for (bool sparse : {false, true}) {
+                GCS::System system;
+                system.sparseJacobiThreshold = sparse ? 0 : std::numeric_limits<int>::max();
+                Staircase sketch(steps);
+                sketch.init(system, alg);
+                auto start = std::chrono::steady_clock::now();
+                int result = sketch.solve(system, alg);
+                auto end = std::chrono::steady_clock::now();
+
+                std::string name = std::string(alg == GCS::DogLeg ? "dl_" : "lm_")
+                    + (sparse ? "sparse_" : "dense_") + std::to_string(steps) + "_ms";
+                RecordProperty(name, int(std::chrono::duration_cast<ms>(end - start).count()));
+                EXPECT_EQ(result, GCS::Success);
+                EXPECT_LT(sketch.maxDeviation(), 1e-6);
+            }
+        }
+    }
+}